@@ -43,6 +43,7 @@ typedef enum {
   NNS_EDGE_ERROR_IO = -EIO,
   NNS_EDGE_ERROR_CONNECTION_FAILURE = -ECONNREFUSED,
   NNS_EDGE_ERROR_UNKNOWN = (-1073741824LL),
+  NNS_EDGE_ERROR_TIMEOUT = (NNS_EDGE_ERROR_UNKNOWN + 1),
   NNS_EDGE_ERROR_NOT_SUPPORTED = (NNS_EDGE_ERROR_UNKNOWN + 2),
 } nns_edge_error_e;
 
@@ -52,6 +53,8 @@ typedef enum {
   NNS_EDGE_EVENT_NEW_DATA_RECEIVED,
   NNS_EDGE_EVENT_CALLBACK_RELEASED,
   NNS_EDGE_EVENT_CONNECTION_CLOSED,
+  NNS_EDGE_EVENT_NEW_BATCH_RECEIVED,
+  NNS_EDGE_EVENT_REQUEST_EXPIRED,
 
   NNS_EDGE_EVENT_CUSTOM = 0x01000000
 } nns_edge_event_e;
@@ -86,6 +89,39 @@ typedef int (*nns_edge_event_cb) (nns_edge_event_h event_h, void *user_data);
  */
 typedef void (*nns_edge_data_destroy_cb) (void *data);
 
+/**
+ * @brief Memory allocator for the buffers of nnstreamer-edge data.
+ * @note All callbacks are mandatory. The memory allocated with alloc or aligned_alloc is released with free.
+ */
+typedef struct {
+  void *(*alloc) (nns_size_t size, void *user_data); /**< allocate the memory */
+  void *(*aligned_alloc) (nns_size_t alignment, nns_size_t size, void *user_data); /**< allocate the memory aligned to given bytes (power of 2) */
+  void (*free) (void *data, void *user_data); /**< release the memory */
+  void *user_data; /**< the context passed to the callbacks */
+} nns_edge_allocator_s;
+
+/**
+ * @brief Codec to compress the raw data transferred over TCP connection.
+ * @note All callbacks are mandatory. The codec is identified with its name, the connected nodes should register the codec with same name.
+ */
+typedef struct {
+  const char *name; /**< the name of the codec, alphanumeric characters, '-' and '_' only */
+  nns_size_t (*bound) (nns_size_t size, void *user_data); /**< get the max byte size of the encoded data */
+  int (*encode) (const void *src, nns_size_t src_len, void *dest, nns_size_t *dest_len, void *user_data); /**< encode the data, dest_len is the size of dest buffer and it should be updated with the size of encoded data. Return NNS_EDGE_ERROR_NONE if succeeded */
+  int (*decode) (const void *src, nns_size_t src_len, void *dest, nns_size_t dest_len, void *user_data); /**< decode the data into dest buffer having the size of original data. Return NNS_EDGE_ERROR_NONE if succeeded */
+  void *user_data; /**< the context passed to the callbacks */
+} nns_edge_codec_s;
+
+/**
+ * @brief Callback called when nnstreamer-edge needs the memory to receive the raw data.
+ * @param[in] index The index of the memory in received edge data.
+ * @param[in] size The byte size of the memory.
+ * @param[out] destroy_cb The callback to release the memory. If it is null, the application keeps the ownership of the memory and it should be valid until the received data is released.
+ * @param[in] user_data The user data passed with the callback.
+ * @return The memory to receive the raw data. Return null to receive the data into the buffer allocated by nnstreamer-edge.
+ */
+typedef void *(*nns_edge_alloc_cb) (unsigned int index, nns_size_t size, nns_edge_data_destroy_cb *destroy_cb, void *user_data);
+
 /**
  * @brief Create a handle representing an instance of edge-AI connection between a server and client (query) or a data publisher and scriber.
  * @param[in] id Unique id in local network
@@ -221,6 +257,7 @@ int nns_edge_set_event_callback (nns_edge_h edge_h, nns_edge_event_cb cb, void *
  * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
  * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
  * @retval #NNS_EDGE_ERROR_CONNECTION_FAILURE Failed to connect to destination.
+ * @note If the query client balances the requests (See the info LB_POLICY), call this function for each server to connect to many servers.
  *
  * Here is an example of the usage:
  * @code
@@ -265,6 +302,7 @@ int nns_edge_disconnect (nns_edge_h edge_h);
 /**
  * @brief Send data to destination (broker or connected node), asynchronously. If client_id is not set in data_h, send data to all connected edge nodes. To set client_id in data_h, use nns_edge_data_set_info().
  * @param[in] edge_h The edge handle.
+ * @note Query client sets new request ID in data_h (info "request_id", int64) and keeps the request outstanding until the response having same ID is received. The query server receives the request ID in the data, the response should have the same info "request_id" to be matched in the client. The response without the request ID completes the oldest request sent to the server, the server should respond the requests in order. Many requests can be sent without waiting for the responses, and the responses may be received out of order.
  * @return 0 on success. Otherwise a negative error value.
  * @retval #NNS_EDGE_ERROR_NONE Successful.
  * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
@@ -273,6 +311,34 @@ int nns_edge_disconnect (nns_edge_h edge_h);
  */
 int nns_edge_send (nns_edge_h edge_h, nns_edge_data_h data_h);
 
+/**
+ * @brief Send the request to query server and wait for its response, synchronously. Only the calling thread is blocked, many threads can send the queries at the same time.
+ * @param[in] edge_h The edge handle of query client.
+ * @param[in] request_h The edge data handle of the request. New request ID is set in the data (info "request_id") as nns_edge_send() does.
+ * @param[out] response_h The edge data handle of the response. Caller should release it using nns_edge_data_destroy().
+ * @param[in] timeout_ms The timeout in milliseconds. 0 to wait until the response is received. The timeout (or REQUEST_TIMEOUT if 0) is sent as the deadline of the request, query server drops the request expired before it is handled.
+ * @note The response is not passed to the event callback (NNS_EDGE_EVENT_NEW_DATA_RECEIVED). The response received after the timeout is passed to the event callback.
+ * @note If the request is dropped in the leaky send-queue, the query is timed out. (See the option QUEUE_SIZE)
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @retval #NNS_EDGE_ERROR_IO Failed to transfer the data, or the connection is closed.
+ * @retval #NNS_EDGE_ERROR_TIMEOUT The response is not received until the timeout.
+ *
+ * Here is an example of the usage:
+ * @code
+ * nns_edge_data_h response_h;
+ *
+ * ret = nns_edge_query (edge_h, request_h, &response_h, 1000U);
+ * if (NNS_EDGE_ERROR_NONE == ret) {
+ *   // Handle the response, and release it.
+ *   nns_edge_data_destroy (response_h);
+ * }
+ * @endcode
+ */
+int nns_edge_query (nns_edge_h edge_h, nns_edge_data_h request_h, nns_edge_data_h *response_h, unsigned int timeout_ms);
+
 /**
  * @brief Check whether edge is connected or not.
  * @param[in] edge_h The edge handle.
@@ -304,6 +370,33 @@ int nns_edge_is_connected (nns_edge_h edge_h);
  * TOPIC                | Topic used to publish/subscribe to/from the broker.
  * QUEUE_SIZE           | Max number of data in the queue, when sending edge data to other node. Default 0 means unlimited. N:<leaky [NEW, OLD]> where leaky 'OLD' drops old buffer (default NEW). (e.g., QUEUE_SIZE=5:OLD drops old buffer and pushes new data when queue size reaches 5.)
  * ID or CLIENT_ID      | Unique identifier of the edge handle or client ID. (Read-only)
+ * CONNECT_TIMEOUT      | Timeout in milliseconds to connect to the destination node. Default 10000, 0 means no timeout. In case of Hybrid connection, discovered servers are connected in parallel and the first server completing the handshake is used.
+ * BACKLOG              | The maximum length of pending connections of each listener socket. Default 10. This should be set before starting the edge handle.
+ * LISTENERS            | The number of listener sockets on the same port with SO_REUSEPORT in server (or publisher) node, each accepts socket in its own thread. Default 1. This should be set before starting the edge handle.
+ * HANDSHAKE_TIMEOUT    | Timeout in milliseconds of each handshake stage with the accepted socket. Default 5000, 0 means no timeout.
+ * HANDSHAKE_WORKERS    | The number of threads to handle the handshake of accepted sockets in server (or publisher) node. Default 4. This should be set before starting the edge handle.
+ * FAST_RECONNECT       | true or false (default false). Enables TCP fast open if the kernel supports it, and the client sends its host info in the first flight. The client skips the capability check when reconnecting to the node whose capability was accepted before, if the node also enables it. The node waits for the first flight of the client up to 100 milliseconds. This should be set before starting the edge handle.
+ * CODEC                | The name of the codec to compress the raw data sent over TCP connection, or none (default). The codec is used only if the connected node has registered it, it is negotiated when connecting. This should be set before starting the edge handle. (See nns_edge_register_codec())
+ * CODEC_THRESHOLD      | The min byte size of the raw data to be compressed. Default 1024.
+ * CODEC_FILTER         | The filter applied to the raw data before compression, none (default) or shuffle. The shuffle filter groups the bytes of same significance in the elements, it improves the ratio of tensors (e.g., float32 feature maps).
+ * CODEC_ELEMENT_SIZE   | The byte size of the element to shuffle the raw data (1 to 256). Default 4. The edge data may have the info "element_size" (int64) to override it.
+ * WIRE_PRECISION       | The precision of float32 raw data sent over TCP connection, none (default), fp16 or bf16. The values are converted only if the connected node supports the precision, it is negotiated when connecting. Only the memories marked with the info "float32_mask" of the edge data (int64, bit mask of memory index 0 to 63, or -1 for all memories) are converted, other memories are sent as they are. This should be set before starting the edge handle.
+ * RESTORE_PRECISION    | true (default) or false. Restores float32 values of received data. If false, the memories have 16-bit values and the edge data has the info "wire_precision" (fp16 or bf16).
+ * DELTA                | true or false (default). Sends the XOR delta from the memories of previous frame, the unchanged bytes are compressed well (e.g., sensor data or segmentation masks). The delta is used only with the codec, if the connected node supports it. The receiver restores the memories before invoking the event NNS_EDGE_EVENT_NEW_DATA_RECEIVED. This should be set before starting the edge handle.
+ * DELTA_KEYFRAME       | The interval of keyframes when DELTA is true, the memories are sent without delta in the keyframe. Default 30. This should be set before starting the edge handle.
+ * CODEC_STATS          | Statistics of the compressed raw data, comma separated key=value pairs (sent_raw, sent_encoded, received_raw, received_encoded) in bytes. The ratio of the stream is encoded / raw. (Read-only)
+ * DATA_ALIGNMENT       | The alignment in bytes of each raw data in serialized edge data sent via MQTT or AITT (power of 2 from 8 to 65536, e.g., 64 or the page size). Default 0, the raw data are packed. The receiver can use aligned raw data in place.
+ * DATA_POOL_SIZE       | The max number of edge data handles kept in the pool to receive data. Default 16, 0 disables the pool.
+ * BUFFER_POOL_SIZE     | The max bytes of memory buffers kept in the pool to receive data. Default 4194304 (4MB), 0 disables the pool.
+ * LB_POLICY            | The policy of query client to send the request to one of the connected servers. 'none' (default, the client connects to one server), 'least-outstanding' (the server having the fewest outstanding requests) or 'ewma' (the server having the lowest EWMA latency, weighted by its outstanding requests). With the policy, the client connects to all servers given with nns_edge_connect() or discovered in hybrid mode. This should be set before starting the edge handle.
+ * LB_EJECT_FAILURES    | The number of consecutive failures (failed to send the request or nns_edge_query() timed out) to eject the server. The ejected server is not selected for LB_EJECT_TIME, unless all servers are ejected. Default 3.
+ * LB_EJECT_TIME        | The time in milliseconds the ejected server is not selected. Default 10000.
+ * HEDGE_PERCENTILE     | The percentile (1 to 99) of recent latencies for query client with LB_POLICY. If the response is not received within this latency, the duplicated request is sent to other server. The first response is delivered and the other one is dropped. Default 0, the hedged request is disabled. This should be set before starting the edge handle.
+ * REQUEST_TIMEOUT      | The time in milliseconds the request of query client is expired. The deadline is sent with the request, query server drops the expired request and the client receives the event NNS_EDGE_EVENT_REQUEST_EXPIRED (info "request_id") instead of the response. Query server delivers the requests with earliest deadline first in the batch. Default 0, the request is not expired.
+ * BATCH_SIZE           | The max number of requests in a batch of query server. The requests from all connections are gathered and delivered with the event NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, instead of NNS_EDGE_EVENT_NEW_DATA_RECEIVED. Default 0, the batch is disabled. This should be set before starting the edge handle.
+ * BATCH_TIMEOUT        | The max time in milliseconds to wait for more requests after the first request in a batch is received. Default 5. This should be set before starting the edge handle.
+ * OUTSTANDING_REQUESTS | The number of requests of query client waiting for the response, 4096 at most. If too many requests are outstanding, the oldest request sent with nns_edge_send() is not waited anymore. (Read-only)
+ * POOL_STATS           | Statistics of the data and buffer pool, comma separated key=value pairs (data_hit, data_miss, data_cached, buffer_hit, buffer_miss, buffer_cached_bytes). (Read-only)
  */
 int nns_edge_set_info (nns_edge_h edge_h, const char *key, const char *value);
 
@@ -320,6 +413,29 @@ int nns_edge_set_info (nns_edge_h edge_h, const char *key, const char *value);
  */
 int nns_edge_get_info (nns_edge_h edge_h, const char *key, char **value);
 
+/**
+ * @brief Set the memory allocator of the edge handle, which is used to allocate the received data (handles, buffers and metadata) and the buffers to encode and decode the data transferred with the handle.
+ * @note This should be called before starting the edge handle. The allocator is copied into the handle and the received data, and the user data of allocator should be valid until the edge handle and the received data are released.
+ * @param[in] edge_h The edge handle.
+ * @param[in] allocator The memory allocator. Set null to use the default allocator (See nns_edge_set_default_allocator()).
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_set_allocator (nns_edge_h edge_h, const nns_edge_allocator_s *allocator);
+
+/**
+ * @brief Set the callback to allocate the memory of received data. With this callback, nnstreamer-edge receives the raw data directly into the memory of the application.
+ * @note This should be called before starting the edge handle. To get the received data without copying the memory allocated with the callback, use nns_edge_event_take_new_data().
+ * @param[in] edge_h The edge handle.
+ * @param[in] cb The callback to allocate the memory. Set null to unset the callback.
+ * @param[in] user_data The user data passed with the callback.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_set_alloc_callback (nns_edge_h edge_h, nns_edge_alloc_cb cb, void *user_data);
+
 /**
  * @brief Get the nnstreamer edge event type.
  * @param[in] event_h The edge event handle.
@@ -332,7 +448,7 @@ int nns_edge_get_info (nns_edge_h edge_h, const char *key, char **value);
 int nns_edge_event_get_type (nns_edge_event_h event_h, nns_edge_event_e *event);
 
 /**
- * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED) and get received data.
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED or NNS_EDGE_EVENT_REQUEST_EXPIRED) and get received data.
  * @note Caller should release returned edge data using nns_edge_data_destroy().
  * @param[in] event_h The edge event handle.
  * @param[out] data_h Handle of received data.
@@ -343,6 +459,19 @@ int nns_edge_event_get_type (nns_edge_event_h event_h, nns_edge_event_e *event);
  */
 int nns_edge_event_parse_new_data (nns_edge_event_h event_h, nns_edge_data_h *data_h);
 
+/**
+ * @brief Take received data from edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED or NNS_EDGE_EVENT_REQUEST_EXPIRED).
+ * @note Caller should release returned edge data using nns_edge_data_destroy().
+ * @note The memory allocated with the callback (See nns_edge_set_alloc_callback()) is moved to returned edge data without copying, other memories are copied. After taking the data, the event cannot be parsed or taken again.
+ * @param[in] event_h The edge event handle.
+ * @param[out] data_h Handle of received data.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid
+ */
+int nns_edge_event_take_new_data (nns_edge_event_h event_h, nns_edge_data_h *data_h);
+
 /**
  * @brief Parse edge event (NNS_EDGE_EVENT_CAPABILITY) and get capability string.
  * @note Caller should release returned string using free().
@@ -355,6 +484,21 @@ int nns_edge_event_parse_new_data (nns_edge_event_h event_h, nns_edge_data_h *da
  */
 int nns_edge_event_parse_capability (nns_edge_event_h event_h, char **capability);
 
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) and get the requests received in query server.
+ * @note Caller should release each edge data using nns_edge_data_destroy(), and the array using free().
+ * @note Each request has the info "client_id" of the query client. The response should be sent with same client ID, to be routed to the query client.
+ * @param[in] event_h The edge event handle.
+ * @param[out] batch The array of edge data handles.
+ * @param[out] num The number of edge data handles in the batch.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid
+ */
+int nns_edge_event_parse_new_batch (nns_edge_event_h event_h, nns_edge_data_h **batch, unsigned int *num);
+
 /**
  * @brief Create a handle used for data transmission.
  * @note Caller should release returned edge data using nns_edge_data_destroy().
@@ -466,6 +610,90 @@ int nns_edge_data_set_info (nns_edge_data_h data_h, const char *key, const char
  */
 int nns_edge_data_get_info (nns_edge_data_h data_h, const char *key, char **value);
 
+/**
+ * @brief Set the information of edge data with int64 value.
+ * @note The param key is case-insensitive. If same key string already exists, it will replace old value.
+ * @param[in] data_h The edge data handle.
+ * @param[in] key A key of the information.
+ * @param[in] value The information to be set.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_set_info_int64 (nns_edge_data_h data_h, const char *key, int64_t value);
+
+/**
+ * @brief Get the int64 value of the information in edge data.
+ * @note The param key is case-insensitive. The information set as a string is converted to int64.
+ * @param[in] data_h The edge data handle.
+ * @param[in] key A key of the information.
+ * @param[out] value The information to get.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_get_info_int64 (nns_edge_data_h data_h, const char *key, int64_t *value);
+
+/**
+ * @brief Set the information of edge data with double value.
+ * @note The param key is case-insensitive. If same key string already exists, it will replace old value.
+ * @param[in] data_h The edge data handle.
+ * @param[in] key A key of the information.
+ * @param[in] value The information to be set.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_set_info_double (nns_edge_data_h data_h, const char *key, double value);
+
+/**
+ * @brief Get the double value of the information in edge data.
+ * @note The param key is case-insensitive. The information set as an int64 or a string is converted to double.
+ * @param[in] data_h The edge data handle.
+ * @param[in] key A key of the information.
+ * @param[out] value The information to get.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_get_info_double (nns_edge_data_h data_h, const char *key, double *value);
+
+/**
+ * @brief Set the information of edge data with binary value.
+ * @note The param key is case-insensitive. If same key string already exists, it will replace old value. The binary value cannot be read with nns_edge_data_get_info().
+ * @param[in] data_h The edge data handle.
+ * @param[in] key A key of the information.
+ * @param[in] value The information to be set. The value is copied into edge data.
+ * @param[in] value_len The byte size of the value.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_set_info_binary (nns_edge_data_h data_h, const char *key, const void *value, nns_size_t value_len);
+
+/**
+ * @brief Get the binary value of the information in edge data.
+ * @note The param key is case-insensitive. Caller should release the returned value using free().
+ * @param[in] data_h The edge data handle.
+ * @param[in] key A key of the information.
+ * @param[out] value The information to get.
+ * @param[out] value_len The byte size of the value.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_NOT_SUPPORTED Not supported.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_data_get_info_binary (nns_edge_data_h data_h, const char *key, void **value, nns_size_t *value_len);
+
 /**
  * @brief Clear information of edge data.
  * @param[in] data_h The edge data handle.
@@ -476,6 +704,38 @@ int nns_edge_data_get_info (nns_edge_data_h data_h, const char *key, char **valu
  */
 int nns_edge_data_clear_info (nns_edge_data_h data_h);
 
+/**
+ * @brief Set the default memory allocator of the process, which is used to allocate the edge handles, nnstreamer-edge data (handles, raw data copied or received, serialized data and metadata) and the internal structures.
+ * @note The default allocator can be changed only when no edge handle and edge data exist, before creating the first one or after releasing all of them. The memory is released with the default allocator at the time of release, changing it while the edge handle or edge data exists releases the memory with wrong allocator.
+ * The strings returned by the API (e.g., nns_edge_get_info()) and the array of data handles in the batch event are not allocated with this allocator, caller should release them using free().
+ * @param[in] allocator The memory allocator. Set null to use the standard library.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_set_default_allocator (const nns_edge_allocator_s *allocator);
+
+/**
+ * @brief Register the codec to compress the raw data transferred over TCP connection.
+ * @note The codec "lz" is built in. The codec is copied, and the user data of codec should be valid until the codec is unregistered.
+ * @param[in] codec The codec to be registered.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the codec with same name is already registered.
+ */
+int nns_edge_register_codec (const nns_edge_codec_s *codec);
+
+/**
+ * @brief Unregister the codec.
+ * @note This should not be called while the edge handles using the codec are started.
+ * @param[in] name The name of the codec.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the codec is not registered.
+ */
+int nns_edge_unregister_codec (const char *name);
+
 /**
  * @brief Get the version of nnstreamer-edge.
  * @param[out] major MAJOR.minor.micro, won't set if it's null.
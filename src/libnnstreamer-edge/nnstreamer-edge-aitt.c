@@ -39,6 +39,10 @@ typedef struct
   void *user_data;
   aitt_option_h option;
   aitt_protocol_e protocol;
+
+  /* buffer to serialize edge data, accessed in the send thread only */
+  void *send_buf;
+  nns_size_t send_buf_size;
 } nns_edge_aitt_handle_s;
 
 /**
@@ -82,14 +86,14 @@ nns_edge_aitt_connect (nns_edge_aitt_h handle, const char *id,
 
   if (!ah->aitt_handle) {
     nns_edge_loge ("Failed to create AITT handle. AITT internal error.");
-    SAFE_FREE (ah);
+    SAFE_EDGE_FREE (ah);
     return NNS_EDGE_ERROR_UNKNOWN;
   }
 
   if (AITT_ERROR_NONE != aitt_connect (ah->aitt_handle, host, port)) {
     nns_edge_loge ("Failed to connect to AITT. IP:port = %s:%d", host, port);
     aitt_destroy (ah->aitt_handle);
-    SAFE_FREE (ah);
+    SAFE_EDGE_FREE (ah);
     return NNS_EDGE_ERROR_UNKNOWN;
   }
 
@@ -132,10 +136,11 @@ nns_edge_aitt_close (nns_edge_aitt_h handle)
 
   if (ah->option)
     aitt_option_destroy (ah->option);
+  nns_edge_free (ah->send_buf);
   SAFE_FREE (ah->id);
   SAFE_FREE (ah->topic);
   SAFE_FREE (ah->host);
-  SAFE_FREE (ah);
+  SAFE_EDGE_FREE (ah);
 
   return NNS_EDGE_ERROR_NONE;
 }
@@ -236,12 +241,18 @@ aitt_cb_message_arrived (aitt_msg_h msg_handle, const void *msg,
     return;
   }
 
-  nns_edge_data_deserialize (data_h, (void *) msg, (nns_size_t) msg_len);
-
-  ret = nns_edge_event_invoke_callback (ah->event_cb, ah->user_data,
-      NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h), NULL);
-  if (ret != NNS_EDGE_ERROR_NONE)
-    nns_edge_loge ("Failed to send an event for received message.");
+  /* The message is valid until this callback returns, deserialize it without copying the raw data. */
+  ret = nns_edge_data_deserialize_view (data_h, (void *) msg,
+      (nns_size_t) msg_len, NULL);
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    ret = nns_edge_event_invoke_callback (ah->event_cb, ah->user_data,
+        NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h),
+        NULL);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      nns_edge_loge ("Failed to send an event for received message.");
+  } else {
+    nns_edge_loge ("Failed to deserialize received message.");
+  }
 
   nns_edge_data_destroy (data_h);
 }
@@ -295,23 +306,32 @@ nns_edge_aitt_set_event_callback (nns_edge_aitt_h handle, nns_edge_event_cb cb,
  * @brief Internal util function to send edge-data.
  */
 int
-nns_edge_aitt_send_data (nns_edge_aitt_h handle, nns_edge_data_h data_h)
+nns_edge_aitt_send_data (nns_edge_aitt_h handle, nns_edge_data_h data_h,
+    nns_size_t alignment)
 {
-  int ret;
-  void *data = NULL;
+  nns_edge_aitt_handle_s *ah;
   nns_size_t size;
+  int ret;
+
+  if (!handle) {
+    nns_edge_loge ("Invalid param, given AITT handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  ah = (nns_edge_aitt_handle_s *) handle;
 
-  ret = nns_edge_data_serialize (data_h, &data, &size);
+  /* AITT copies the message, reuse the buffer to serialize edge data. */
+  ret = nns_edge_data_serialize_reuse (data_h, alignment, &ah->send_buf,
+      &ah->send_buf_size, &size);
   if (NNS_EDGE_ERROR_NONE != ret) {
     nns_edge_loge ("Failed to serialize the edge data.");
     return ret;
   }
 
-  ret = nns_edge_aitt_publish (handle, data, size);
+  ret = nns_edge_aitt_publish (handle, ah->send_buf, size);
   if (NNS_EDGE_ERROR_NONE != ret)
     nns_edge_loge ("Failed to send data to destination.");
 
-  SAFE_FREE (data);
   return ret;
 }
 
@@ -445,7 +465,8 @@ nns_edge_aitt_create (nns_edge_aitt_h * handle)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  ah = (nns_edge_aitt_handle_s *) calloc (1, sizeof (nns_edge_aitt_handle_s));
+  ah = (nns_edge_aitt_handle_s *) nns_edge_calloc (1,
+      sizeof (nns_edge_aitt_handle_s));
   if (!ah) {
     nns_edge_loge ("Failed to allocate memory for AITT handle.");
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -454,7 +475,7 @@ nns_edge_aitt_create (nns_edge_aitt_h * handle)
   option = aitt_option_new ();
   if (!option) {
     nns_edge_loge ("Failed to allocate memory for AITT handle.");
-    nns_edge_free (ah);
+    SAFE_EDGE_FREE (ah);
     return NNS_EDGE_ERROR_UNKNOWN;
   }
   ah->option = option;
@@ -65,9 +65,9 @@ int nns_edge_aitt_set_event_callback (nns_edge_aitt_h handle, nns_edge_event_cb
 int nns_edge_aitt_is_connected (nns_edge_aitt_h handle);
 
 /**
- * @brief Internal util function to send edge-data.
+ * @brief Internal util function to send edge-data. If alignment is larger than 0, edge-data is serialized with aligned format.
  */
-int nns_edge_aitt_send_data (nns_edge_aitt_h handle, nns_edge_data_h data_h);
+int nns_edge_aitt_send_data (nns_edge_aitt_h handle, nns_edge_data_h data_h, nns_size_t alignment);
 
 /**
  * @brief Internal util function to set AITT option.
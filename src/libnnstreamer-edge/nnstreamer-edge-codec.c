@@ -0,0 +1,1459 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2022 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nnstreamer-edge-codec.c
+ * @date   16 October 2026
+ * @brief  Codecs to compress the raw data transferred between edge nodes.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @bug    No known bugs except for NYI items.
+ */
+
+#include <ctype.h>
+#include "nnstreamer-edge-codec.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-util.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CODEC_HAVE_X86_DISPATCH 1
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief The max number of vectors to shuffle the elements (max element size with SIMD kernels).
+ */
+#define SHUFFLE_VECTOR_MAX (16U)
+
+/**
+ * @brief The max number of codecs registered by application.
+ */
+#define CODEC_MAX (16U)
+#define CODEC_NAME_MAX (32U)
+
+/**
+ * @brief Parameters of the built-in LZ codec (LZ4 block format).
+ * The match is at least 4 bytes, and the last 5 bytes are always literals.
+ */
+#define LZ_HASH_BITS (12U)
+#define LZ_MIN_MATCH (4U)
+#define LZ_MAX_OFFSET (65535U)
+#define LZ_LAST_LITERALS (5U)
+#define LZ_MATCH_LIMIT (12U)
+#define LZ_MAX_INPUT (0x7e000000ULL)
+
+/**
+ * @brief Internal structure for registered codec.
+ */
+typedef struct
+{
+  uint32_t id;
+  char *name;
+  nns_edge_codec_s codec;
+} nns_edge_codec_entry_s;
+
+/**
+ * @brief Registered codecs. The built-in codec is not in the list.
+ */
+static pthread_mutex_t g_codec_lock = PTHREAD_MUTEX_INITIALIZER;
+static nns_edge_codec_entry_s g_codecs[CODEC_MAX];
+static unsigned int g_num_codecs = 0U;
+
+/**
+ * @brief Read 4 bytes from the unaligned address.
+ */
+static inline uint32_t
+_lz_read32 (const uint8_t * p)
+{
+  uint32_t v;
+
+  memcpy (&v, p, sizeof (uint32_t));
+  return v;
+}
+
+/**
+ * @brief Get the hash of 4 bytes sequence.
+ */
+static inline uint32_t
+_lz_hash (uint32_t seq)
+{
+  return (seq * 2654435761U) >> (32U - LZ_HASH_BITS);
+}
+
+/**
+ * @brief Write the length of literals or match, longer than the token can hold.
+ */
+static inline uint8_t *
+_lz_write_length (uint8_t * op, nns_size_t len)
+{
+  while (len >= 255U) {
+    *op++ = 255U;
+    len -= 255U;
+  }
+
+  *op++ = (uint8_t) len;
+  return op;
+}
+
+/**
+ * @brief Read the length of literals or match, longer than the token can hold.
+ */
+static inline bool
+_lz_read_length (const uint8_t ** ip, const uint8_t * end, nns_size_t * len)
+{
+  uint8_t b;
+
+  do {
+    if (*ip >= end)
+      return false;
+
+    b = *(*ip)++;
+    *len += b;
+  } while (b == 255U);
+
+  return true;
+}
+
+/**
+ * @brief Get the max byte size of the data encoded with built-in LZ codec.
+ */
+static nns_size_t
+_lz_bound (nns_size_t size, void *user_data)
+{
+  UNUSED (user_data);
+
+  if (size > LZ_MAX_INPUT)
+    return 0U;
+
+  return size + size / 255U + 16U;
+}
+
+/**
+ * @brief Write a sequence (literals and match) of LZ block. Returns null if the buffer is small.
+ */
+static uint8_t *
+_lz_write_sequence (uint8_t * op, const uint8_t * oend,
+    const uint8_t * literal, nns_size_t literal_len, nns_size_t offset,
+    nns_size_t match_len)
+{
+  uint8_t *token;
+  nns_size_t need;
+
+  /* token, literals, offset and the length bytes */
+  need = 1U + literal_len + literal_len / 255U + 1U + 2U + match_len / 255U + 1U;
+  if (need > (nns_size_t) (oend - op))
+    return NULL;
+
+  token = op++;
+  *token = (uint8_t) ((literal_len >= 15U ? 15U : literal_len) << 4);
+  if (literal_len >= 15U)
+    op = _lz_write_length (op, literal_len - 15U);
+
+  memcpy (op, literal, literal_len);
+  op += literal_len;
+
+  /* The last sequence has literals only. */
+  if (match_len == 0U)
+    return op;
+
+  *op++ = (uint8_t) (offset & 0xff);
+  *op++ = (uint8_t) (offset >> 8);
+
+  match_len -= LZ_MIN_MATCH;
+  *token |= (uint8_t) (match_len >= 15U ? 15U : match_len);
+  if (match_len >= 15U)
+    op = _lz_write_length (op, match_len - 15U);
+
+  return op;
+}
+
+/**
+ * @brief Encode the data with built-in LZ codec.
+ */
+static int
+_lz_encode (const void *src, nns_size_t src_len, void *dest,
+    nns_size_t * dest_len, void *user_data)
+{
+  uint32_t table[1U << LZ_HASH_BITS];
+  const uint8_t *in = (const uint8_t *) src;
+  uint8_t *op = (uint8_t *) dest;
+  const uint8_t *oend = op + *dest_len;
+  nns_size_t ip = 0U, anchor = 0U, ref, len;
+  uint32_t seq, h;
+
+  UNUSED (user_data);
+
+  if (src_len > LZ_MAX_INPUT)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  memset (table, 0, sizeof (table));
+
+  if (src_len > LZ_MATCH_LIMIT) {
+    while (ip < src_len - LZ_MATCH_LIMIT) {
+      seq = _lz_read32 (in + ip);
+      h = _lz_hash (seq);
+      ref = table[h];
+      table[h] = (uint32_t) ip;
+
+      if (ref >= ip || ip - ref > LZ_MAX_OFFSET || _lz_read32 (in + ref) != seq) {
+        ip++;
+        continue;
+      }
+
+      len = LZ_MIN_MATCH;
+      while (ip + len < src_len - LZ_LAST_LITERALS && in[ref + len] == in[ip + len])
+        len++;
+
+      op = _lz_write_sequence (op, oend, in + anchor, ip - anchor, ip - ref,
+          len);
+      if (!op)
+        return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+      ip += len;
+      anchor = ip;
+    }
+  }
+
+  op = _lz_write_sequence (op, oend, in + anchor, src_len - anchor, 0U, 0U);
+  if (!op)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  *dest_len = (nns_size_t) (op - (uint8_t *) dest);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Decode the data with built-in LZ codec.
+ */
+static int
+_lz_decode (const void *src, nns_size_t src_len, void *dest,
+    nns_size_t dest_len, void *user_data)
+{
+  const uint8_t *ip = (const uint8_t *) src;
+  const uint8_t *iend = ip + src_len;
+  uint8_t *out = (uint8_t *) dest;
+  nns_size_t op = 0U, len, offset;
+  uint8_t token;
+
+  UNUSED (user_data);
+
+  while (ip < iend) {
+    token = *ip++;
+
+    /* literals */
+    len = token >> 4;
+    if (len == 15U && !_lz_read_length (&ip, iend, &len))
+      goto error;
+
+    if (len > (nns_size_t) (iend - ip) || len > dest_len - op)
+      goto error;
+
+    memcpy (out + op, ip, len);
+    ip += len;
+    op += len;
+
+    /* The last sequence has literals only. */
+    if (ip == iend)
+      break;
+
+    /* match */
+    if (iend - ip < 2)
+      goto error;
+
+    offset = (nns_size_t) ip[0] | ((nns_size_t) ip[1] << 8);
+    ip += 2;
+    if (offset == 0U || offset > op)
+      goto error;
+
+    len = token & 0x0f;
+    if (len == 15U && !_lz_read_length (&ip, iend, &len))
+      goto error;
+    len += LZ_MIN_MATCH;
+
+    if (len > dest_len - op)
+      goto error;
+
+    if (offset >= len) {
+      memcpy (out + op, out + op - offset, len);
+      op += len;
+    } else {
+      /* Overlapped match repeats the previous bytes. */
+      while (len-- > 0U) {
+        out[op] = out[op - offset];
+        op++;
+      }
+    }
+  }
+
+  if (op != dest_len)
+    goto error;
+
+  return NNS_EDGE_ERROR_NONE;
+
+error:
+  nns_edge_loge ("[Codec] Failed to decode, the data is corrupted.");
+  return NNS_EDGE_ERROR_INVALID_PARAMETER;
+}
+
+/**
+ * @brief The built-in LZ codec.
+ */
+static const nns_edge_codec_s g_codec_lz = {
+  NNS_EDGE_CODEC_LZ, _lz_bound, _lz_encode, _lz_decode, NULL
+};
+
+/**
+ * @brief Shuffle the bytes of the elements in the block, with the scalar loop.
+ */
+static void
+_shuffle_scalar (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  nns_size_t i;
+  unsigned int b;
+
+  for (i = start; i < num; i++) {
+    for (b = 0; b < element_size; b++)
+      dest[b * num + i] = src[i * element_size + b];
+  }
+}
+
+/**
+ * @brief Unshuffle the bytes of the elements in the block, with the scalar loop.
+ */
+static void
+_unshuffle_scalar (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  nns_size_t i;
+  unsigned int b;
+
+  for (i = start; i < num; i++) {
+    for (b = 0; b < element_size; b++)
+      dest[i * element_size + b] = src[b * num + i];
+  }
+}
+
+/**
+ * @brief Get the number of interleaving steps to unshuffle the vectors.
+ * Interleaving the bytes of vector i and i + n/2 transposes n vectors in 4 steps,
+ * and the vectors are restored after log2(n) more steps.
+ */
+static inline unsigned int
+_shuffle_get_unshuffle_steps (unsigned int element_size)
+{
+  switch (element_size) {
+    case 2:
+      return 1U;
+    case 4:
+      return 2U;
+    case 8:
+      return 3U;
+    default:
+      return 4U;
+  }
+}
+
+/**
+ * @brief Check the element size is supported with SIMD kernels.
+ */
+static inline bool
+_shuffle_simd_supported (unsigned int element_size)
+{
+  return (element_size == 2U || element_size == 4U || element_size == 8U ||
+      element_size == 16U);
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Interleave the bytes of the vectors, with SSE2.
+ */
+static inline void
+_interleave_sse2 (__m128i * v, unsigned int n)
+{
+  __m128i t[SHUFFLE_VECTOR_MAX];
+  unsigned int i, h = n / 2U;
+
+  for (i = 0; i < h; i++) {
+    t[2 * i] = _mm_unpacklo_epi8 (v[i], v[i + h]);
+    t[2 * i + 1] = _mm_unpackhi_epi8 (v[i], v[i + h]);
+  }
+
+  memcpy (v, t, sizeof (__m128i) * n);
+}
+
+/**
+ * @brief Shuffle the bytes of the elements, with SSE2. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_shuffle_sse2 (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  __m128i v[SHUFFLE_VECTOR_MAX];
+  nns_size_t i;
+  unsigned int b, s;
+
+  for (i = start; i + 16U <= num; i += 16U) {
+    for (b = 0; b < element_size; b++)
+      v[b] = _mm_loadu_si128 ((const __m128i *) (src + i * element_size +
+              b * 16U));
+
+    for (s = 0; s < 4U; s++)
+      _interleave_sse2 (v, element_size);
+
+    for (b = 0; b < element_size; b++)
+      _mm_storeu_si128 ((__m128i *) (dest + b * num + i), v[b]);
+  }
+
+  return i;
+}
+
+/**
+ * @brief Unshuffle the bytes of the elements, with SSE2. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_unshuffle_sse2 (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  __m128i v[SHUFFLE_VECTOR_MAX];
+  nns_size_t i;
+  unsigned int b, s, steps;
+
+  steps = _shuffle_get_unshuffle_steps (element_size);
+
+  for (i = start; i + 16U <= num; i += 16U) {
+    for (b = 0; b < element_size; b++)
+      v[b] = _mm_loadu_si128 ((const __m128i *) (src + b * num + i));
+
+    for (s = 0; s < steps; s++)
+      _interleave_sse2 (v, element_size);
+
+    for (b = 0; b < element_size; b++)
+      _mm_storeu_si128 ((__m128i *) (dest + i * element_size + b * 16U),
+          v[b]);
+  }
+
+  return i;
+}
+#endif /* __SSE2__ */
+
+#if defined(CODEC_HAVE_X86_DISPATCH)
+/**
+ * @brief Interleave the bytes of the vectors in each 128-bit lane, with AVX2.
+ */
+__attribute__ ((target ("avx2")))
+static inline void
+_interleave_avx2 (__m256i * v, unsigned int n)
+{
+  __m256i t[SHUFFLE_VECTOR_MAX];
+  unsigned int i, h = n / 2U;
+
+  for (i = 0; i < h; i++) {
+    t[2 * i] = _mm256_unpacklo_epi8 (v[i], v[i + h]);
+    t[2 * i + 1] = _mm256_unpackhi_epi8 (v[i], v[i + h]);
+  }
+
+  memcpy (v, t, sizeof (__m256i) * n);
+}
+
+/**
+ * @brief Shuffle the bytes of the elements, with AVX2. Returns the index of next element to be processed.
+ * @note The low lanes hold the first 16 elements and the high lanes hold next 16 elements.
+ */
+__attribute__ ((target ("avx2")))
+static nns_size_t
+_shuffle_avx2 (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  __m256i y[SHUFFLE_VECTOR_MAX], v[SHUFFLE_VECTOR_MAX];
+  nns_size_t i;
+  unsigned int b, s, h = element_size / 2U;
+
+  for (i = start; i + 32U <= num; i += 32U) {
+    for (b = 0; b < element_size; b++)
+      y[b] = _mm256_loadu_si256 ((const __m256i *) (src + i * element_size +
+              b * 32U));
+
+    for (b = 0; b < element_size; b += 2U) {
+      v[b] = _mm256_permute2x128_si256 (y[b / 2U], y[h + b / 2U], 0x20);
+      v[b + 1] = _mm256_permute2x128_si256 (y[b / 2U], y[h + b / 2U], 0x31);
+    }
+
+    for (s = 0; s < 4U; s++)
+      _interleave_avx2 (v, element_size);
+
+    for (b = 0; b < element_size; b++)
+      _mm256_storeu_si256 ((__m256i *) (dest + b * num + i), v[b]);
+  }
+
+  return i;
+}
+
+/**
+ * @brief Unshuffle the bytes of the elements, with AVX2. Returns the index of next element to be processed.
+ */
+__attribute__ ((target ("avx2")))
+static nns_size_t
+_unshuffle_avx2 (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  __m256i y[SHUFFLE_VECTOR_MAX], v[SHUFFLE_VECTOR_MAX];
+  nns_size_t i;
+  unsigned int b, s, steps, h = element_size / 2U;
+
+  steps = _shuffle_get_unshuffle_steps (element_size);
+
+  for (i = start; i + 32U <= num; i += 32U) {
+    for (b = 0; b < element_size; b++)
+      v[b] = _mm256_loadu_si256 ((const __m256i *) (src + b * num + i));
+
+    for (s = 0; s < steps; s++)
+      _interleave_avx2 (v, element_size);
+
+    for (b = 0; b < element_size; b += 2U) {
+      y[b / 2U] = _mm256_permute2x128_si256 (v[b], v[b + 1], 0x20);
+      y[h + b / 2U] = _mm256_permute2x128_si256 (v[b], v[b + 1], 0x31);
+    }
+
+    for (b = 0; b < element_size; b++)
+      _mm256_storeu_si256 ((__m256i *) (dest + i * element_size + b * 32U),
+          y[b]);
+  }
+
+  return i;
+}
+#endif /* CODEC_HAVE_X86_DISPATCH */
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+/**
+ * @brief Interleave the bytes of the vectors, with NEON.
+ */
+static inline void
+_interleave_neon (uint8x16_t * v, unsigned int n)
+{
+  uint8x16_t t[SHUFFLE_VECTOR_MAX];
+  uint8x16x2_t z;
+  unsigned int i, h = n / 2U;
+
+  for (i = 0; i < h; i++) {
+    z = vzipq_u8 (v[i], v[i + h]);
+    t[2 * i] = z.val[0];
+    t[2 * i + 1] = z.val[1];
+  }
+
+  memcpy (v, t, sizeof (uint8x16_t) * n);
+}
+
+/**
+ * @brief Shuffle the bytes of the elements, with NEON. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_shuffle_neon (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  uint8x16_t v[SHUFFLE_VECTOR_MAX];
+  nns_size_t i;
+  unsigned int b, s;
+
+  for (i = start; i + 16U <= num; i += 16U) {
+    for (b = 0; b < element_size; b++)
+      v[b] = vld1q_u8 (src + i * element_size + b * 16U);
+
+    for (s = 0; s < 4U; s++)
+      _interleave_neon (v, element_size);
+
+    for (b = 0; b < element_size; b++)
+      vst1q_u8 (dest + b * num + i, v[b]);
+  }
+
+  return i;
+}
+
+/**
+ * @brief Unshuffle the bytes of the elements, with NEON. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_unshuffle_neon (const uint8_t * src, uint8_t * dest, nns_size_t num,
+    nns_size_t start, unsigned int element_size)
+{
+  uint8x16_t v[SHUFFLE_VECTOR_MAX];
+  nns_size_t i;
+  unsigned int b, s, steps;
+
+  steps = _shuffle_get_unshuffle_steps (element_size);
+
+  for (i = start; i + 16U <= num; i += 16U) {
+    for (b = 0; b < element_size; b++)
+      v[b] = vld1q_u8 (src + b * num + i);
+
+    for (s = 0; s < steps; s++)
+      _interleave_neon (v, element_size);
+
+    for (b = 0; b < element_size; b++)
+      vst1q_u8 (dest + i * element_size + b * 16U, v[b]);
+  }
+
+  return i;
+}
+#endif /* __ARM_NEON */
+
+/**
+ * @brief Check the CPU supports AVX2.
+ */
+static inline bool
+_shuffle_use_avx2 (void)
+{
+#if defined(CODEC_HAVE_X86_DISPATCH)
+  static int supported = -1;
+
+  if (supported < 0)
+    supported = __builtin_cpu_supports ("avx2") ? 1 : 0;
+
+  return (supported > 0);
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief Shuffle the bytes of the elements, to group the bytes of same significance.
+ */
+void
+nns_edge_codec_shuffle (const void *src, void *dest, nns_size_t size,
+    unsigned int element_size)
+{
+  const uint8_t *s = (const uint8_t *) src;
+  uint8_t *d = (uint8_t *) dest;
+  nns_size_t num, done = 0U;
+
+  if (element_size <= 1U || size < element_size) {
+    memcpy (dest, src, size);
+    return;
+  }
+
+  num = size / element_size;
+
+  if (_shuffle_simd_supported (element_size)) {
+#if defined(CODEC_HAVE_X86_DISPATCH)
+    if (_shuffle_use_avx2 ())
+      done = _shuffle_avx2 (s, d, num, done, element_size);
+#endif
+#if defined(__SSE2__)
+    done = _shuffle_sse2 (s, d, num, done, element_size);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    done = _shuffle_neon (s, d, num, done, element_size);
+#endif
+  }
+
+  _shuffle_scalar (s, d, num, done, element_size);
+
+  /* The remaining bytes are not shuffled. */
+  memcpy (d + num * element_size, s + num * element_size,
+      size - num * element_size);
+}
+
+/**
+ * @brief Unshuffle the bytes of the elements, to restore the data shuffled with nns_edge_codec_shuffle().
+ */
+void
+nns_edge_codec_unshuffle (const void *src, void *dest, nns_size_t size,
+    unsigned int element_size)
+{
+  const uint8_t *s = (const uint8_t *) src;
+  uint8_t *d = (uint8_t *) dest;
+  nns_size_t num, done = 0U;
+
+  if (element_size <= 1U || size < element_size) {
+    memcpy (dest, src, size);
+    return;
+  }
+
+  num = size / element_size;
+
+  if (_shuffle_simd_supported (element_size)) {
+#if defined(CODEC_HAVE_X86_DISPATCH)
+    if (_shuffle_use_avx2 ())
+      done = _unshuffle_avx2 (s, d, num, done, element_size);
+#endif
+#if defined(__SSE2__)
+    done = _unshuffle_sse2 (s, d, num, done, element_size);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    done = _unshuffle_neon (s, d, num, done, element_size);
+#endif
+  }
+
+  _unshuffle_scalar (s, d, num, done, element_size);
+
+  memcpy (d + num * element_size, s + num * element_size,
+      size - num * element_size);
+}
+
+/**
+ * @brief Convert a float32 value to float16, rounding to nearest even.
+ */
+static inline uint16_t
+_fp32_to_fp16 (uint32_t x)
+{
+  uint32_t sign, mant, h, rem, mid, shift;
+  int32_t e;
+
+  sign = (x >> 16) & 0x8000U;
+  mant = x & 0x7fffffU;
+  e = (int32_t) ((x >> 23) & 0xffU);
+
+  /* Inf or NaN, keep NaN quiet. */
+  if (e == 0xff)
+    return (uint16_t) (sign | 0x7c00U | (mant ? 0x200U | (mant >> 13) : 0U));
+
+  e = e - 127 + 15;
+  if (e >= 31)
+    return (uint16_t) (sign | 0x7c00U);
+
+  if (e <= 0) {
+    /* Subnormal or zero. */
+    if (e < -10)
+      return (uint16_t) sign;
+
+    mant |= 0x800000U;
+    shift = (uint32_t) (14 - e);
+    h = mant >> shift;
+    rem = mant & ((1U << shift) - 1U);
+    mid = 1U << (shift - 1U);
+  } else {
+    h = ((uint32_t) e << 10) | (mant >> 13);
+    rem = mant & 0x1fffU;
+    mid = 0x1000U;
+  }
+
+  /* The carry may increase the exponent, it is still valid. */
+  if (rem > mid || (rem == mid && (h & 1U)))
+    h++;
+
+  return (uint16_t) (sign | h);
+}
+
+/**
+ * @brief Convert a float16 value to float32.
+ */
+static inline uint32_t
+_fp16_to_fp32 (uint16_t h)
+{
+  uint32_t sign, mant, e;
+
+  sign = ((uint32_t) h & 0x8000U) << 16;
+  e = ((uint32_t) h >> 10) & 0x1fU;
+  mant = (uint32_t) h & 0x3ffU;
+
+  if (e == 0U) {
+    if (mant == 0U)
+      return sign;
+
+    /* Normalize the subnormal value. */
+    e = 113U;
+    while (!(mant & 0x400U)) {
+      mant <<= 1;
+      e--;
+    }
+
+    return sign | (e << 23) | ((mant & 0x3ffU) << 13);
+  }
+
+  if (e == 0x1fU)
+    return sign | 0x7f800000U | (mant << 13);
+
+  return sign | ((e + 112U) << 23) | (mant << 13);
+}
+
+/**
+ * @brief Convert a float32 value to bfloat16, rounding to nearest even.
+ */
+static inline uint16_t
+_fp32_to_bf16 (uint32_t x)
+{
+  /* Keep NaN quiet. */
+  if ((x & 0x7fffffffU) > 0x7f800000U)
+    return (uint16_t) ((x >> 16) | 0x40U);
+
+  return (uint16_t) ((x + 0x7fffU + ((x >> 16) & 1U)) >> 16);
+}
+
+/**
+ * @brief Convert float32 values with the scalar loop.
+ */
+static void
+_convert_scalar (const uint32_t * src, uint16_t * dest, nns_size_t num,
+    nns_size_t start, nns_edge_codec_precision_e precision)
+{
+  nns_size_t i;
+
+  if (precision == NNS_EDGE_CODEC_PRECISION_FP16) {
+    for (i = start; i < num; i++)
+      dest[i] = _fp32_to_fp16 (src[i]);
+  } else {
+    for (i = start; i < num; i++)
+      dest[i] = _fp32_to_bf16 (src[i]);
+  }
+}
+
+/**
+ * @brief Restore float32 values with the scalar loop.
+ */
+static void
+_restore_scalar (const uint16_t * src, uint32_t * dest, nns_size_t num,
+    nns_size_t start, nns_edge_codec_precision_e precision)
+{
+  nns_size_t i;
+
+  if (precision == NNS_EDGE_CODEC_PRECISION_FP16) {
+    for (i = start; i < num; i++)
+      dest[i] = _fp16_to_fp32 (src[i]);
+  } else {
+    for (i = start; i < num; i++)
+      dest[i] = (uint32_t) src[i] << 16;
+  }
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Convert float32 values to bfloat16, with SSE2. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_convert_bf16_sse2 (const uint32_t * src, uint16_t * dest, nns_size_t num)
+{
+  const __m128i one = _mm_set1_epi32 (1);
+  const __m128i bias = _mm_set1_epi32 (0x7fff);
+  const __m128i quiet = _mm_set1_epi32 (0x40);
+  const __m128i abs_mask = _mm_set1_epi32 (0x7fffffff);
+  const __m128i inf = _mm_set1_epi32 (0x7f800000);
+  __m128i x, r, nan, m, v[2];
+  nns_size_t i;
+  unsigned int k;
+
+  for (i = 0; i + 8U <= num; i += 8U) {
+    for (k = 0; k < 2U; k++) {
+      x = _mm_loadu_si128 ((const __m128i *) (src + i + k * 4U));
+
+      r = _mm_and_si128 (_mm_srli_epi32 (x, 16), one);
+      r = _mm_srli_epi32 (_mm_add_epi32 (x, _mm_add_epi32 (bias, r)), 16);
+      nan = _mm_or_si128 (_mm_srli_epi32 (x, 16), quiet);
+      m = _mm_cmpgt_epi32 (_mm_and_si128 (x, abs_mask), inf);
+      r = _mm_or_si128 (_mm_and_si128 (m, nan), _mm_andnot_si128 (m, r));
+
+      /* Sign-extend to pack 16-bit values without saturation. */
+      v[k] = _mm_srai_epi32 (_mm_slli_epi32 (r, 16), 16);
+    }
+
+    _mm_storeu_si128 ((__m128i *) (dest + i), _mm_packs_epi32 (v[0], v[1]));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Restore float32 values from bfloat16, with SSE2. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_restore_bf16_sse2 (const uint16_t * src, uint32_t * dest, nns_size_t num)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i v;
+  nns_size_t i;
+
+  for (i = 0; i + 8U <= num; i += 8U) {
+    v = _mm_loadu_si128 ((const __m128i *) (src + i));
+    _mm_storeu_si128 ((__m128i *) (dest + i), _mm_unpacklo_epi16 (zero, v));
+    _mm_storeu_si128 ((__m128i *) (dest + i + 4U),
+        _mm_unpackhi_epi16 (zero, v));
+  }
+
+  return i;
+}
+#endif /* __SSE2__ */
+
+#if defined(CODEC_HAVE_X86_DISPATCH)
+/**
+ * @brief Convert float32 values to float16, with F16C. Returns the index of next element to be processed.
+ */
+__attribute__ ((target ("avx,f16c")))
+static nns_size_t
+_convert_fp16_f16c (const uint32_t * src, uint16_t * dest, nns_size_t num)
+{
+  __m256 v;
+  nns_size_t i;
+
+  for (i = 0; i + 8U <= num; i += 8U) {
+    v = _mm256_loadu_ps ((const float *) (src + i));
+    _mm_storeu_si128 ((__m128i *) (dest + i),
+        _mm256_cvtps_ph (v, _MM_FROUND_TO_NEAREST_INT));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Restore float32 values from float16, with F16C. Returns the index of next element to be processed.
+ */
+__attribute__ ((target ("avx,f16c")))
+static nns_size_t
+_restore_fp16_f16c (const uint16_t * src, uint32_t * dest, nns_size_t num)
+{
+  __m128i v;
+  nns_size_t i;
+
+  for (i = 0; i + 8U <= num; i += 8U) {
+    v = _mm_loadu_si128 ((const __m128i *) (src + i));
+    _mm256_storeu_ps ((float *) (dest + i), _mm256_cvtph_ps (v));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Check the CPU supports F16C.
+ */
+static inline bool
+_precision_use_f16c (void)
+{
+  static int supported = -1;
+
+  if (supported < 0)
+    supported = (__builtin_cpu_supports ("avx") &&
+        __builtin_cpu_supports ("f16c")) ? 1 : 0;
+
+  return (supported > 0);
+}
+#endif /* CODEC_HAVE_X86_DISPATCH */
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+/**
+ * @brief Convert float32 values to bfloat16, with NEON. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_convert_bf16_neon (const uint32_t * src, uint16_t * dest, nns_size_t num)
+{
+  const uint32x4_t one = vdupq_n_u32 (1U);
+  const uint32x4_t bias = vdupq_n_u32 (0x7fffU);
+  const uint32x4_t quiet = vdupq_n_u32 (0x40U);
+  const uint32x4_t abs_mask = vdupq_n_u32 (0x7fffffffU);
+  const uint32x4_t inf = vdupq_n_u32 (0x7f800000U);
+  uint32x4_t x, r, nan, m;
+  nns_size_t i;
+
+  for (i = 0; i + 4U <= num; i += 4U) {
+    x = vld1q_u32 (src + i);
+
+    r = vandq_u32 (vshrq_n_u32 (x, 16), one);
+    r = vshrq_n_u32 (vaddq_u32 (x, vaddq_u32 (bias, r)), 16);
+    nan = vorrq_u32 (vshrq_n_u32 (x, 16), quiet);
+    m = vcgtq_u32 (vandq_u32 (x, abs_mask), inf);
+    r = vbslq_u32 (m, nan, r);
+
+    vst1_u16 (dest + i, vmovn_u32 (r));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Restore float32 values from bfloat16, with NEON. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_restore_bf16_neon (const uint16_t * src, uint32_t * dest, nns_size_t num)
+{
+  nns_size_t i;
+
+  for (i = 0; i + 4U <= num; i += 4U)
+    vst1q_u32 (dest + i, vshll_n_u16 (vld1_u16 (src + i), 16));
+
+  return i;
+}
+
+#if defined(__aarch64__)
+/**
+ * @brief Convert float32 values to float16, with NEON. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_convert_fp16_neon (const uint32_t * src, uint16_t * dest, nns_size_t num)
+{
+  nns_size_t i;
+
+  for (i = 0; i + 4U <= num; i += 4U) {
+    float16x4_t h = vcvt_f16_f32 (vld1q_f32 ((const float *) (src + i)));
+    vst1_u16 (dest + i, vreinterpret_u16_f16 (h));
+  }
+
+  return i;
+}
+
+/**
+ * @brief Restore float32 values from float16, with NEON. Returns the index of next element to be processed.
+ */
+static nns_size_t
+_restore_fp16_neon (const uint16_t * src, uint32_t * dest, nns_size_t num)
+{
+  nns_size_t i;
+
+  for (i = 0; i + 4U <= num; i += 4U) {
+    float32x4_t f = vcvt_f32_f16 (vreinterpret_f16_u16 (vld1_u16 (src + i)));
+    vst1q_f32 ((float *) (dest + i), f);
+  }
+
+  return i;
+}
+#endif /* __aarch64__ */
+#endif /* __ARM_NEON */
+
+/**
+ * @brief Convert float32 values to the precision on the wire.
+ */
+void
+nns_edge_codec_convert_precision (const void *src, void *dest, nns_size_t num,
+    nns_edge_codec_precision_e precision)
+{
+  const uint32_t *s = (const uint32_t *) src;
+  uint16_t *d = (uint16_t *) dest;
+  nns_size_t done = 0U;
+
+  if (precision == NNS_EDGE_CODEC_PRECISION_FP16) {
+#if defined(CODEC_HAVE_X86_DISPATCH)
+    if (_precision_use_f16c ())
+      done = _convert_fp16_f16c (s, d, num);
+#elif defined(__aarch64__)
+    done = _convert_fp16_neon (s, d, num);
+#endif
+  } else if (precision == NNS_EDGE_CODEC_PRECISION_BF16) {
+#if defined(__SSE2__)
+    done = _convert_bf16_sse2 (s, d, num);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    done = _convert_bf16_neon (s, d, num);
+#endif
+  } else {
+    return;
+  }
+
+  _convert_scalar (s, d, num, done, precision);
+}
+
+/**
+ * @brief Restore float32 values from the precision on the wire.
+ */
+void
+nns_edge_codec_restore_precision (const void *src, void *dest, nns_size_t num,
+    nns_edge_codec_precision_e precision)
+{
+  const uint16_t *s = (const uint16_t *) src;
+  uint32_t *d = (uint32_t *) dest;
+  nns_size_t done = 0U;
+
+  if (precision == NNS_EDGE_CODEC_PRECISION_FP16) {
+#if defined(CODEC_HAVE_X86_DISPATCH)
+    if (_precision_use_f16c ())
+      done = _restore_fp16_f16c (s, d, num);
+#elif defined(__aarch64__)
+    done = _restore_fp16_neon (s, d, num);
+#endif
+  } else if (precision == NNS_EDGE_CODEC_PRECISION_BF16) {
+#if defined(__SSE2__)
+    done = _restore_bf16_sse2 (s, d, num);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    done = _restore_bf16_neon (s, d, num);
+#endif
+  } else {
+    return;
+  }
+
+  _restore_scalar (s, d, num, done, precision);
+}
+
+/**
+ * @brief Get the name of the precision.
+ */
+const char *
+nns_edge_codec_get_precision_name (nns_edge_codec_precision_e precision)
+{
+  switch (precision) {
+    case NNS_EDGE_CODEC_PRECISION_FP16:
+      return "fp16";
+    case NNS_EDGE_CODEC_PRECISION_BF16:
+      return "bf16";
+    default:
+      return "none";
+  }
+}
+
+/**
+ * @brief Get the precision from its name.
+ */
+nns_edge_codec_precision_e
+nns_edge_codec_get_precision (const char *name)
+{
+  if (!STR_IS_VALID (name))
+    return NNS_EDGE_CODEC_PRECISION_MAX;
+
+  if (0 == strcasecmp (name, "none"))
+    return NNS_EDGE_CODEC_PRECISION_NONE;
+  if (0 == strcasecmp (name, "fp16"))
+    return NNS_EDGE_CODEC_PRECISION_FP16;
+  if (0 == strcasecmp (name, "bf16"))
+    return NNS_EDGE_CODEC_PRECISION_BF16;
+
+  return NNS_EDGE_CODEC_PRECISION_MAX;
+}
+
+/**
+ * @brief XOR the memory with the reference.
+ */
+void
+nns_edge_codec_xor (const void *src, const void *ref, void *dest,
+    nns_size_t size)
+{
+  const uint8_t *s = (const uint8_t *) src;
+  const uint8_t *r = (const uint8_t *) ref;
+  uint8_t *d = (uint8_t *) dest;
+  nns_size_t i = 0;
+
+#if defined(__SSE2__)
+  for (; i + 16U <= size; i += 16U) {
+    __m128i a = _mm_loadu_si128 ((const __m128i *) (s + i));
+    __m128i b = _mm_loadu_si128 ((const __m128i *) (r + i));
+
+    _mm_storeu_si128 ((__m128i *) (d + i), _mm_xor_si128 (a, b));
+  }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  for (; i + 16U <= size; i += 16U)
+    vst1q_u8 (d + i, veorq_u8 (vld1q_u8 (s + i), vld1q_u8 (r + i)));
+#endif
+
+  for (; i < size; i++)
+    d[i] = s[i] ^ r[i];
+}
+
+/**
+ * @brief Keep the memory to be referenced by the delta of next frame.
+ */
+int
+nns_edge_codec_delta_set (nns_edge_codec_delta_s * delta, unsigned int index,
+    const void *mem, nns_size_t size)
+{
+  if (!delta || index >= NNS_EDGE_DATA_LIMIT || !mem || size == 0U)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (delta->size[index] != size) {
+    nns_edge_allocator_free (&delta->allocator, delta->ref[index]);
+    delta->size[index] = 0U;
+
+    delta->ref[index] = nns_edge_allocator_alloc (&delta->allocator, size);
+    if (!delta->ref[index]) {
+      nns_edge_loge ("[Codec] Failed to allocate the reference of delta.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    delta->size[index] = size;
+  }
+
+  if (delta->ref[index] != mem)
+    memcpy (delta->ref[index], mem, size);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Release the references of delta, next frame should be a keyframe.
+ */
+void
+nns_edge_codec_delta_clear (nns_edge_codec_delta_s * delta)
+{
+  unsigned int i;
+
+  if (!delta)
+    return;
+
+  for (i = 0; i < NNS_EDGE_DATA_LIMIT; i++) {
+    nns_edge_allocator_free (&delta->allocator, delta->ref[i]);
+    delta->ref[i] = NULL;
+    delta->size[i] = 0U;
+  }
+
+  delta->frames = 0U;
+}
+
+/**
+ * @brief Check the name of codec.
+ */
+static bool
+_codec_name_is_valid (const char *name)
+{
+  size_t i, len;
+
+  if (!STR_IS_VALID (name))
+    return false;
+
+  len = strlen (name);
+  if (len > CODEC_NAME_MAX || 0 == strcasecmp (name, "none"))
+    return false;
+
+  for (i = 0; i < len; i++) {
+    if (!isalnum ((unsigned char) name[i]) && name[i] != '-' && name[i] != '_')
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Find the index of registered codec. Returns -1 if not found.
+ * @note This function should be called with codec lock.
+ */
+static int
+_codec_find_index (uint32_t id)
+{
+  unsigned int i;
+
+  for (i = 0; i < g_num_codecs; i++) {
+    if (g_codecs[i].id == id)
+      return (int) i;
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Get the identifier of the codec, which is transferred with the encoded data.
+ */
+uint32_t
+nns_edge_codec_get_id (const char *name)
+{
+  uint64_t hash;
+  uint32_t id;
+
+  if (!STR_IS_VALID (name))
+    return 0U;
+
+  hash = nns_edge_hash_string (name);
+  id = (uint32_t) (hash ^ (hash >> 32));
+
+  /* 0 means the data is not encoded. */
+  return (id != 0U) ? id : 1U;
+}
+
+/**
+ * @brief Register the codec to compress the raw data transferred over TCP connection.
+ */
+int
+nns_edge_register_codec (const nns_edge_codec_s * codec)
+{
+  nns_edge_codec_entry_s *entry;
+  uint32_t id;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!codec || !codec->bound || !codec->encode || !codec->decode) {
+    nns_edge_loge ("[Codec] Invalid param, all callbacks of the codec should be set.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!_codec_name_is_valid (codec->name)) {
+    nns_edge_loge ("[Codec] Invalid param, the name of codec is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  id = nns_edge_codec_get_id (codec->name);
+
+  pthread_mutex_lock (&g_codec_lock);
+
+  if (id == nns_edge_codec_get_id (NNS_EDGE_CODEC_LZ) ||
+      _codec_find_index (id) >= 0) {
+    nns_edge_loge ("[Codec] Invalid param, the codec '%s' is already registered.",
+        codec->name);
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (g_num_codecs >= CODEC_MAX) {
+    nns_edge_loge ("[Codec] Cannot register the codec, the max number of codecs is %u.",
+        CODEC_MAX);
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  entry = &g_codecs[g_num_codecs];
+  entry->name = nns_edge_strdup (codec->name);
+  if (!entry->name) {
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  entry->id = id;
+  entry->codec = *codec;
+  entry->codec.name = entry->name;
+  g_num_codecs++;
+
+done:
+  pthread_mutex_unlock (&g_codec_lock);
+  return ret;
+}
+
+/**
+ * @brief Unregister the codec.
+ */
+int
+nns_edge_unregister_codec (const char *name)
+{
+  int index;
+
+  if (!STR_IS_VALID (name)) {
+    nns_edge_loge ("[Codec] Invalid param, given name is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (0 == strcmp (name, NNS_EDGE_CODEC_LZ)) {
+    nns_edge_loge ("[Codec] Invalid param, cannot unregister built-in codec.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  pthread_mutex_lock (&g_codec_lock);
+
+  index = _codec_find_index (nns_edge_codec_get_id (name));
+  if (index >= 0) {
+    SAFE_FREE (g_codecs[index].name);
+    g_num_codecs--;
+    memmove (&g_codecs[index], &g_codecs[index + 1],
+        sizeof (nns_edge_codec_entry_s) * (g_num_codecs - index));
+  }
+
+  pthread_mutex_unlock (&g_codec_lock);
+
+  if (index < 0) {
+    nns_edge_loge ("[Codec] Invalid param, the codec '%s' is not registered.",
+        name);
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Find the registered codec with its identifier.
+ */
+int
+nns_edge_codec_find_by_id (uint32_t id, nns_edge_codec_s * codec)
+{
+  int index;
+
+  if (id == 0U || !codec)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (id == nns_edge_codec_get_id (NNS_EDGE_CODEC_LZ)) {
+    *codec = g_codec_lz;
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  pthread_mutex_lock (&g_codec_lock);
+  index = _codec_find_index (id);
+  if (index >= 0)
+    *codec = g_codecs[index].codec;
+  pthread_mutex_unlock (&g_codec_lock);
+
+  return (index >= 0) ? NNS_EDGE_ERROR_NONE : NNS_EDGE_ERROR_INVALID_PARAMETER;
+}
+
+/**
+ * @brief Find the registered codec with its name.
+ */
+int
+nns_edge_codec_find (const char *name, nns_edge_codec_s * codec)
+{
+  return nns_edge_codec_find_by_id (nns_edge_codec_get_id (name), codec);
+}
+
+/**
+ * @brief Get the names of registered codecs, separated by comma.
+ */
+char *
+nns_edge_codec_get_names (void)
+{
+  char *names, *tmp;
+  unsigned int i;
+
+  names = nns_edge_strdup (NNS_EDGE_CODEC_LZ);
+
+  pthread_mutex_lock (&g_codec_lock);
+  for (i = 0; i < g_num_codecs && names; i++) {
+    tmp = nns_edge_strdup_printf ("%s,%s", names, g_codecs[i].name);
+    SAFE_FREE (names);
+    names = tmp;
+  }
+  pthread_mutex_unlock (&g_codec_lock);
+
+  return names;
+}
+
+/**
+ * @brief Check the codec is in the list of names separated by comma.
+ */
+bool
+nns_edge_codec_is_listed (const char *names, const char *name)
+{
+  const char *p, *end;
+  size_t len, n;
+
+  if (!STR_IS_VALID (names) || !STR_IS_VALID (name))
+    return false;
+
+  len = strlen (name);
+  p = names;
+
+  while (p) {
+    end = strchr (p, ',');
+    n = end ? (size_t) (end - p) : strlen (p);
+
+    if (n == len && 0 == strncmp (p, name, len))
+      return true;
+
+    p = end ? end + 1 : NULL;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Add the byte size of transferred data into the statistics.
+ */
+void
+nns_edge_codec_stats_add (nns_edge_codec_stats_s * stats, bool sent,
+    nns_size_t raw, nns_size_t encoded)
+{
+  if (!stats)
+    return;
+
+  if (sent) {
+    __atomic_add_fetch (&stats->sent_raw, raw, __ATOMIC_RELAXED);
+    __atomic_add_fetch (&stats->sent_encoded, encoded, __ATOMIC_RELAXED);
+  } else {
+    __atomic_add_fetch (&stats->received_raw, raw, __ATOMIC_RELAXED);
+    __atomic_add_fetch (&stats->received_encoded, encoded, __ATOMIC_RELAXED);
+  }
+}
+
+/**
+ * @brief Get the statistics string.
+ */
+char *
+nns_edge_codec_stats_to_string (nns_edge_codec_stats_s * stats)
+{
+  if (!stats)
+    return NULL;
+
+  return nns_edge_strdup_printf ("sent_raw=%llu,sent_encoded=%llu,"
+      "received_raw=%llu,received_encoded=%llu",
+      (unsigned long long) __atomic_load_n (&stats->sent_raw, __ATOMIC_RELAXED),
+      (unsigned long long) __atomic_load_n (&stats->sent_encoded,
+          __ATOMIC_RELAXED),
+      (unsigned long long) __atomic_load_n (&stats->received_raw,
+          __ATOMIC_RELAXED),
+      (unsigned long long) __atomic_load_n (&stats->received_encoded,
+          __ATOMIC_RELAXED));
+}
@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2022 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nnstreamer-edge-codec.h
+ * @date   16 October 2026
+ * @brief  Codecs to compress the raw data transferred between edge nodes.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items.
+ */
+
+#ifndef __NNSTREAMER_EDGE_CODEC_H__
+#define __NNSTREAMER_EDGE_CODEC_H__
+
+#include <stdbool.h>
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @brief The name of built-in codec.
+ */
+#define NNS_EDGE_CODEC_LZ "lz"
+
+/**
+ * @brief Filters applied to the raw data before encoding.
+ */
+typedef enum {
+  NNS_EDGE_CODEC_FILTER_NONE = 0,
+  NNS_EDGE_CODEC_FILTER_SHUFFLE, /**< byte-shuffle, group the bytes of same significance in the elements */
+
+  NNS_EDGE_CODEC_FILTER_MAX
+} nns_edge_codec_filter_e;
+
+/**
+ * @brief Precisions of float32 raw data on the wire.
+ */
+typedef enum {
+  NNS_EDGE_CODEC_PRECISION_NONE = 0, /**< float32 is transferred as it is */
+  NNS_EDGE_CODEC_PRECISION_FP16, /**< IEEE 754 half precision */
+  NNS_EDGE_CODEC_PRECISION_BF16, /**< bfloat16, the upper 16 bits of float32 */
+
+  NNS_EDGE_CODEC_PRECISION_MAX
+} nns_edge_codec_precision_e;
+
+/**
+ * @brief Delta of the memory from the memory in previous frame.
+ */
+typedef enum {
+  NNS_EDGE_CODEC_DELTA_NONE = 0, /**< the memory is not referenced by next frame */
+  NNS_EDGE_CODEC_DELTA_KEY, /**< keyframe, the memory is referenced by next frame */
+  NNS_EDGE_CODEC_DELTA_XOR, /**< XOR with the memory in previous frame, and referenced by next frame */
+
+  NNS_EDGE_CODEC_DELTA_MAX
+} nns_edge_codec_delta_e;
+
+/**
+ * @brief The memories of previous frame on the wire, referenced by the delta of next frame.
+ */
+typedef struct
+{
+  void *ref[NNS_EDGE_DATA_LIMIT];
+  nns_size_t size[NNS_EDGE_DATA_LIMIT];
+  unsigned int frames; /**< the number of frames sent after the keyframe */
+  nns_edge_allocator_s allocator; /**< allocator of the references, empty to use the default allocator */
+} nns_edge_codec_delta_s;
+
+/**
+ * @brief The names of supported precisions, separated by comma.
+ */
+#define NNS_EDGE_CODEC_PRECISIONS "fp16,bf16"
+
+/**
+ * @brief The max byte size of the element to shuffle the raw data.
+ */
+#define NNS_EDGE_CODEC_ELEMENT_SIZE_MAX (256U)
+
+/**
+ * @brief Statistics of the raw data transferred with the codec.
+ */
+typedef struct
+{
+  uint64_t sent_raw; /**< byte size of the raw data before encoding */
+  uint64_t sent_encoded; /**< byte size of the data written to the socket */
+  uint64_t received_raw; /**< byte size of the raw data after decoding */
+  uint64_t received_encoded; /**< byte size of the data read from the socket */
+} nns_edge_codec_stats_s;
+
+/**
+ * @brief Get the identifier of the codec, which is transferred with the encoded data.
+ * @return The identifier of the codec. 0 means the data is not encoded.
+ */
+uint32_t nns_edge_codec_get_id (const char *name);
+
+/**
+ * @brief Find the registered codec with its name.
+ * @param[in] name The name of the codec.
+ * @param[out] codec The codec. The name in the codec should not be used after the codec is unregistered.
+ * @return 0 on success. Otherwise a negative error value.
+ */
+int nns_edge_codec_find (const char *name, nns_edge_codec_s *codec);
+
+/**
+ * @brief Find the registered codec with its identifier.
+ * @param[in] id The identifier of the codec.
+ * @param[out] codec The codec. The name in the codec should not be used after the codec is unregistered.
+ * @return 0 on success. Otherwise a negative error value.
+ */
+int nns_edge_codec_find_by_id (uint32_t id, nns_edge_codec_s *codec);
+
+/**
+ * @brief Get the names of registered codecs, separated by comma.
+ * @note Caller should release returned string using free().
+ */
+char *nns_edge_codec_get_names (void);
+
+/**
+ * @brief Check the codec is in the list of names separated by comma.
+ */
+bool nns_edge_codec_is_listed (const char *names, const char *name);
+
+/**
+ * @brief Shuffle the bytes of the elements, to group the bytes of same significance.
+ * @note The remaining bytes smaller than the element size are copied. The source and destination should not overlap.
+ */
+void nns_edge_codec_shuffle (const void *src, void *dest, nns_size_t size, unsigned int element_size);
+
+/**
+ * @brief Unshuffle the bytes of the elements, to restore the data shuffled with nns_edge_codec_shuffle().
+ */
+void nns_edge_codec_unshuffle (const void *src, void *dest, nns_size_t size, unsigned int element_size);
+
+/**
+ * @brief Convert float32 values to the precision on the wire. The destination has 16-bit values.
+ * @note The values are rounded to nearest even. The source and destination should not overlap.
+ */
+void nns_edge_codec_convert_precision (const void *src, void *dest, nns_size_t num, nns_edge_codec_precision_e precision);
+
+/**
+ * @brief Restore float32 values from the precision on the wire. The source has 16-bit values.
+ */
+void nns_edge_codec_restore_precision (const void *src, void *dest, nns_size_t num, nns_edge_codec_precision_e precision);
+
+/**
+ * @brief Get the name of the precision.
+ */
+const char *nns_edge_codec_get_precision_name (nns_edge_codec_precision_e precision);
+
+/**
+ * @brief Get the precision from its name. Returns NNS_EDGE_CODEC_PRECISION_MAX if the name is invalid.
+ */
+nns_edge_codec_precision_e nns_edge_codec_get_precision (const char *name);
+
+/**
+ * @brief XOR the memory with the reference. The destination may be same as the reference.
+ */
+void nns_edge_codec_xor (const void *src, const void *ref, void *dest, nns_size_t size);
+
+/**
+ * @brief Keep the memory to be referenced by the delta of next frame.
+ * @note The reference is released if failed to allocate the memory.
+ */
+int nns_edge_codec_delta_set (nns_edge_codec_delta_s *delta, unsigned int index, const void *mem, nns_size_t size);
+
+/**
+ * @brief Release the references of delta, next frame should be a keyframe.
+ */
+void nns_edge_codec_delta_clear (nns_edge_codec_delta_s *delta);
+
+/**
+ * @brief Add the byte size of transferred data into the statistics.
+ * @note This function is thread-safe.
+ */
+void nns_edge_codec_stats_add (nns_edge_codec_stats_s *stats, bool sent, nns_size_t raw, nns_size_t encoded);
+
+/**
+ * @brief Get the statistics string. Caller should release returned string using free().
+ */
+char *nns_edge_codec_stats_to_string (nns_edge_codec_stats_s *stats);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_CODEC_H__ */
@@ -10,11 +10,26 @@
  * @bug    No known bugs except for NYI items
  */
 
+#include <inttypes.h>
 #include "nnstreamer-edge-data.h"
 #include "nnstreamer-edge-log.h"
 #include "nnstreamer-edge-util.h"
 
 #define NNS_EDGE_DATA_KEY (0xeddaedda)
+#define NNS_EDGE_DATA_KEY_ALIGNED (0xeddaedd2)
+
+/**
+ * @brief The range of the alignment of memories in serialized edge data.
+ */
+#define NNS_EDGE_DATA_ALIGNMENT_MIN (8)
+#define NNS_EDGE_DATA_ALIGNMENT_MAX (65536)
+
+#define ALIGN_UP(v,a) (((v) + (a) - 1) & ~((nns_size_t) (a) - 1))
+
+/**
+ * @brief The number of memories embedded in edge data. Overflow storage is allocated if more memories are added.
+ */
+#define NNS_EDGE_DATA_INLINE (4)
 
 /**
  * @brief Internal data structure for the header of the serialzied edge data.
@@ -28,6 +43,37 @@ typedef struct
   nns_size_t meta_len;
 } nns_edge_data_header_s;
 
+/**
+ * @brief Internal data structure for the header of the serialized edge data with aligned format.
+ * Each memory starts at the offset aligned to given bytes, and the metadata follows the last memory.
+ */
+typedef struct
+{
+  uint32_t key;
+  uint32_t alignment;
+  uint64_t version;
+  uint32_t num_mem;
+  uint32_t reserved;
+  nns_size_t data_offset[NNS_EDGE_DATA_LIMIT];
+  nns_size_t data_len[NNS_EDGE_DATA_LIMIT];
+  nns_size_t meta_offset;
+  nns_size_t meta_len;
+} nns_edge_data_header_aligned_s;
+
+/**
+ * @brief Internal data structure for the layout of serialized edge data.
+ */
+typedef struct
+{
+  nns_size_t alignment; /**< 0 if the memories are packed */
+  uint32_t num_mem;
+  nns_size_t data_offset[NNS_EDGE_DATA_LIMIT];
+  nns_size_t data_len[NNS_EDGE_DATA_LIMIT];
+  nns_size_t meta_offset;
+  nns_size_t meta_len;
+  nns_size_t total;
+} nns_edge_data_layout_s;
+
 /**
  * @brief Internal data structure for edge data.
  */
@@ -36,15 +82,101 @@ typedef struct
   uint32_t magic;
   pthread_mutex_t lock;
   uint32_t num;
-  nns_edge_raw_data_s data[NNS_EDGE_DATA_LIMIT];
+  uint32_t capacity;
+  nns_edge_raw_data_s *data; /**< points inline array or overflow storage */
+  nns_edge_raw_data_s inline_data[NNS_EDGE_DATA_INLINE];
   nns_edge_metadata_h metadata;
+  void *buffer; /**< serialized buffer the memories point into (see nns_edge_data_deserialize_view()) */
+  nns_edge_data_destroy_cb buffer_destroy_cb;
+  nns_edge_allocator_s allocator; /**< allocator of the handle, the storage of memories and metadata */
 } nns_edge_data_s;
 
+/**
+ * @brief Internal function to make sure the edge data can hold given number of memories.
+ * @note This function should be called with data lock.
+ */
+static int
+_nns_edge_data_reserve (nns_edge_data_s * ed, uint32_t num)
+{
+  nns_edge_raw_data_s *data;
+  uint32_t capacity;
+
+  if (num <= ed->capacity)
+    return NNS_EDGE_ERROR_NONE;
+
+  if (num > NNS_EDGE_DATA_LIMIT) {
+    nns_edge_loge ("Cannot add data, the maximum number of edge data is %d.",
+        NNS_EDGE_DATA_LIMIT);
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  capacity = ed->capacity * 2;
+  while (capacity < num)
+    capacity *= 2;
+  if (capacity > NNS_EDGE_DATA_LIMIT)
+    capacity = NNS_EDGE_DATA_LIMIT;
+
+  if (ed->data == ed->inline_data) {
+    data = (nns_edge_raw_data_s *) nns_edge_allocator_alloc (&ed->allocator,
+        sizeof (nns_edge_raw_data_s) * capacity);
+    if (data)
+      memcpy (data, ed->inline_data, sizeof (nns_edge_raw_data_s) * ed->num);
+  } else {
+    data = (nns_edge_raw_data_s *) nns_edge_allocator_realloc (&ed->allocator,
+        ed->data, sizeof (nns_edge_raw_data_s) * ed->capacity,
+        sizeof (nns_edge_raw_data_s) * capacity);
+  }
+
+  if (!data) {
+    nns_edge_loge ("Failed to allocate memory for edge data.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  ed->data = data;
+  ed->capacity = capacity;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to release all memories and the serialized buffer the memories point into.
+ * @note This function should be called with data lock.
+ */
+static void
+_nns_edge_data_release_memories (nns_edge_data_s * ed)
+{
+  unsigned int i;
+
+  for (i = 0; i < ed->num; i++) {
+    if (ed->data[i].destroy_cb)
+      ed->data[i].destroy_cb (ed->data[i].data);
+    ed->data[i].data = NULL;
+    ed->data[i].data_len = 0;
+    ed->data[i].destroy_cb = NULL;
+    ed->data[i].transferable = false;
+  }
+  ed->num = 0;
+
+  if (ed->buffer && ed->buffer_destroy_cb)
+    ed->buffer_destroy_cb (ed->buffer);
+  ed->buffer = NULL;
+  ed->buffer_destroy_cb = NULL;
+}
+
 /**
  * @brief Create nnstreamer edge data.
  */
 int
 nns_edge_data_create (nns_edge_data_h * data_h)
+{
+  return nns_edge_data_create_with_allocator (data_h, NULL);
+}
+
+/**
+ * @brief Create nnstreamer edge data with given allocator.
+ */
+int
+nns_edge_data_create_with_allocator (nns_edge_data_h * data_h,
+    const nns_edge_allocator_s * allocator)
 {
   nns_edge_data_s *ed;
 
@@ -53,7 +185,8 @@ nns_edge_data_create (nns_edge_data_h * data_h)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  ed = (nns_edge_data_s *) calloc (1, sizeof (nns_edge_data_s));
+  ed = (nns_edge_data_s *) nns_edge_allocator_calloc (allocator, 1,
+      sizeof (nns_edge_data_s));
   if (!ed) {
     nns_edge_loge ("Failed to allocate memory for edge data.");
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -61,7 +194,11 @@ nns_edge_data_create (nns_edge_data_h * data_h)
 
   nns_edge_lock_init (ed);
   nns_edge_handle_set_magic (ed, NNS_EDGE_MAGIC);
-  nns_edge_metadata_create (&ed->metadata);
+  ed->data = ed->inline_data;
+  ed->capacity = NNS_EDGE_DATA_INLINE;
+  if (allocator)
+    ed->allocator = *allocator;
+  nns_edge_metadata_create_with_allocator (&ed->metadata, allocator);
 
   *data_h = ed;
   return NNS_EDGE_ERROR_NONE;
@@ -74,7 +211,7 @@ int
 nns_edge_data_destroy (nns_edge_data_h data_h)
 {
   nns_edge_data_s *ed;
-  unsigned int i;
+  nns_edge_allocator_s allocator;
 
   ed = (nns_edge_data_s *) data_h;
   if (!ed) {
@@ -90,16 +227,20 @@ nns_edge_data_destroy (nns_edge_data_h data_h)
   nns_edge_lock (ed);
   nns_edge_handle_set_magic (ed, NNS_EDGE_MAGIC_DEAD);
 
-  for (i = 0; i < ed->num; i++) {
-    if (ed->data[i].destroy_cb)
-      ed->data[i].destroy_cb (ed->data[i].data);
-  }
+  _nns_edge_data_release_memories (ed);
+
+  if (ed->data != ed->inline_data)
+    nns_edge_allocator_free (&ed->allocator, ed->data);
+  ed->data = NULL;
 
   nns_edge_metadata_destroy (ed->metadata);
 
   nns_edge_unlock (ed);
   nns_edge_lock_destroy (ed);
-  SAFE_FREE (ed);
+
+  /* The allocator is in the handle, copy it before releasing the handle. */
+  allocator = ed->allocator;
+  nns_edge_allocator_free (&allocator, ed);
   return NNS_EDGE_ERROR_NONE;
 }
 
@@ -140,10 +281,12 @@ nns_edge_data_is_valid (nns_edge_data_h data_h)
 }
 
 /**
- * @brief Copy edge data and return new handle.
+ * @brief Internal function to copy edge data. If transfer is true, the transferable memory is moved into new handle.
+ * @note The moved memory is cleared in given handle, it cannot be copied again.
  */
-int
-nns_edge_data_copy (nns_edge_data_h data_h, nns_edge_data_h * new_data_h)
+static int
+_nns_edge_data_copy (nns_edge_data_h data_h, nns_edge_data_h * new_data_h,
+    bool transfer)
 {
   nns_edge_data_s *ed;
   nns_edge_data_s *copied;
@@ -177,8 +320,27 @@ nns_edge_data_copy (nns_edge_data_h data_h, nns_edge_data_h * new_data_h)
 
   copied = (nns_edge_data_s *) (*new_data_h);
 
+  ret = _nns_edge_data_reserve (copied, ed->num);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    goto done;
+
   copied->num = ed->num;
   for (i = 0; i < ed->num; i++) {
+    if (!ed->data[i].data) {
+      nns_edge_loge ("Failed to copy data, the memory was already moved.");
+      copied->num = i;
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      goto done;
+    }
+
+    if (transfer && ed->data[i].transferable && ed->data[i].destroy_cb) {
+      copied->data[i] = ed->data[i];
+      ed->data[i].data = NULL;
+      ed->data[i].destroy_cb = NULL;
+      ed->data[i].transferable = false;
+      continue;
+    }
+
     copied->data[i].data = nns_edge_memdup (ed->data[i].data,
         ed->data[i].data_len);
 
@@ -206,13 +368,33 @@ done:
 }
 
 /**
- * @brief Add raw data into nnstreamer edge data.
+ * @brief Copy edge data and return new handle.
  */
 int
-nns_edge_data_add (nns_edge_data_h data_h, void *data, nns_size_t data_len,
-    nns_edge_data_destroy_cb destroy_cb)
+nns_edge_data_copy (nns_edge_data_h data_h, nns_edge_data_h * new_data_h)
+{
+  return _nns_edge_data_copy (data_h, new_data_h, false);
+}
+
+/**
+ * @brief Copy edge data and transfer the ownership of the transferable memory to new handle.
+ */
+int
+nns_edge_data_copy_transfer (nns_edge_data_h data_h,
+    nns_edge_data_h * new_data_h)
+{
+  return _nns_edge_data_copy (data_h, new_data_h, true);
+}
+
+/**
+ * @brief Internal function to add raw data into nnstreamer edge data.
+ */
+static int
+_nns_edge_data_add (nns_edge_data_h data_h, void *data, nns_size_t data_len,
+    nns_edge_data_destroy_cb destroy_cb, bool transferable)
 {
   nns_edge_data_s *ed;
+  int ret;
 
   ed = (nns_edge_data_s *) data_h;
   if (!ed) {
@@ -232,22 +414,42 @@ nns_edge_data_add (nns_edge_data_h data_h, void *data, nns_size_t data_len,
 
   nns_edge_lock (ed);
 
-  if (ed->num >= NNS_EDGE_DATA_LIMIT) {
-    nns_edge_loge ("Cannot add data, the maximum number of edge data is %d.",
-        NNS_EDGE_DATA_LIMIT);
+  ret = _nns_edge_data_reserve (ed, ed->num + 1);
+  if (ret != NNS_EDGE_ERROR_NONE) {
     nns_edge_unlock (ed);
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    return ret;
   }
 
   ed->data[ed->num].data = data;
   ed->data[ed->num].data_len = data_len;
   ed->data[ed->num].destroy_cb = destroy_cb;
+  ed->data[ed->num].transferable = transferable;
   ed->num++;
 
   nns_edge_unlock (ed);
   return NNS_EDGE_ERROR_NONE;
 }
 
+/**
+ * @brief Add raw data into nnstreamer edge data.
+ */
+int
+nns_edge_data_add (nns_edge_data_h data_h, void *data, nns_size_t data_len,
+    nns_edge_data_destroy_cb destroy_cb)
+{
+  return _nns_edge_data_add (data_h, data, data_len, destroy_cb, false);
+}
+
+/**
+ * @brief Add raw data allocated with the alloc callback of the application into nnstreamer edge data.
+ */
+int
+nns_edge_data_add_transferable (nns_edge_data_h data_h, void *data,
+    nns_size_t data_len, nns_edge_data_destroy_cb destroy_cb)
+{
+  return _nns_edge_data_add (data_h, data, data_len, destroy_cb, true);
+}
+
 /**
  * @brief Remove raw data in edge data.
  */
@@ -255,7 +457,6 @@ int
 nns_edge_data_clear (nns_edge_data_h data_h)
 {
   nns_edge_data_s *ed;
-  unsigned int i;
 
   ed = (nns_edge_data_s *) data_h;
   if (!ed) {
@@ -269,16 +470,7 @@ nns_edge_data_clear (nns_edge_data_h data_h)
   }
 
   nns_edge_lock (ed);
-
-  for (i = 0; i < ed->num; i++) {
-    if (ed->data[i].destroy_cb)
-      ed->data[i].destroy_cb (ed->data[i].data);
-    ed->data[i].data = NULL;
-    ed->data[i].data_len = 0;
-    ed->data[i].destroy_cb = NULL;
-  }
-  ed->num = 0;
-
+  _nns_edge_data_release_memories (ed);
   nns_edge_unlock (ed);
 
   return NNS_EDGE_ERROR_NONE;
@@ -428,235 +620,568 @@ nns_edge_data_get_info (nns_edge_data_h data_h, const char *key, char **value)
 }
 
 /**
- * @brief Clear information of edge data.
+ * @brief Internal function to validate the param to access the information of edge data.
  */
-int
-nns_edge_data_clear_info (nns_edge_data_h data_h)
+static bool
+_nns_edge_data_info_is_valid (nns_edge_data_s * ed, const char *key)
 {
-  nns_edge_data_s *ed;
-  int ret;
-
-  ed = (nns_edge_data_s *) data_h;
   if (!ed) {
     nns_edge_loge ("Invalid param, given edge data handle is null.");
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    return false;
+  }
+
+  if (!STR_IS_VALID (key)) {
+    nns_edge_loge ("Invalid param, given key is invalid.");
+    return false;
   }
 
   if (!nns_edge_handle_is_valid (ed)) {
     nns_edge_loge ("Invalid param, given edge data is invalid.");
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    return false;
   }
 
+  return true;
+}
+
+/**
+ * @brief Set the information of edge data with int64 value.
+ */
+int
+nns_edge_data_set_info_int64 (nns_edge_data_h data_h, const char *key,
+    int64_t value)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!_nns_edge_data_info_is_valid (ed, key))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_destroy (ed->metadata);
-  if (NNS_EDGE_ERROR_NONE != ret)
-    goto done;
-  ret = nns_edge_metadata_create (&ed->metadata);
-done:
+  ret = nns_edge_metadata_set_int64 (ed->metadata, key, value);
   nns_edge_unlock (ed);
 
   return ret;
 }
 
 /**
- * @brief Serialize metadata in edge data.
+ * @brief Get the int64 value of the information in edge data.
  */
 int
-nns_edge_data_serialize_meta (nns_edge_data_h data_h, void **data,
-    nns_size_t * data_len)
+nns_edge_data_get_info_int64 (nns_edge_data_h data_h, const char *key,
+    int64_t * value)
 {
   nns_edge_data_s *ed;
   int ret;
 
   ed = (nns_edge_data_s *) data_h;
-  if (!ed) {
-    nns_edge_loge ("Invalid param, given edge data handle is null.");
+  if (!_nns_edge_data_info_is_valid (ed, key))
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
 
-  if (!nns_edge_handle_is_valid (ed)) {
-    nns_edge_loge ("Invalid param, given edge data is invalid.");
+  if (!value) {
+    nns_edge_loge ("Invalid param, value should not be null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_serialize (ed->metadata, data, data_len);
+  ret = nns_edge_metadata_get_int64 (ed->metadata, key, value);
   nns_edge_unlock (ed);
 
   return ret;
 }
 
 /**
- * @brief Deserialize metadata in edge data.
+ * @brief Set the information of edge data with double value.
  */
 int
-nns_edge_data_deserialize_meta (nns_edge_data_h data_h, const void *data,
-    const nns_size_t data_len)
+nns_edge_data_set_info_double (nns_edge_data_h data_h, const char *key,
+    double value)
 {
   nns_edge_data_s *ed;
   int ret;
 
   ed = (nns_edge_data_s *) data_h;
-  if (!ed) {
-    nns_edge_loge ("Invalid param, given edge data handle is null.");
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
-
-  if (!nns_edge_handle_is_valid (ed)) {
-    nns_edge_loge ("Invalid param, given edge data is invalid.");
+  if (!_nns_edge_data_info_is_valid (ed, key))
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
 
   nns_edge_lock (ed);
-  ret = nns_edge_metadata_deserialize (ed->metadata, data, data_len);
+  ret = nns_edge_metadata_set_double (ed->metadata, key, value);
   nns_edge_unlock (ed);
 
   return ret;
 }
 
 /**
- * @brief Serialize edge data (meta data + raw data).
+ * @brief Get the double value of the information in edge data.
  */
 int
-nns_edge_data_serialize (nns_edge_data_h data_h, void **data, nns_size_t * len)
+nns_edge_data_get_info_double (nns_edge_data_h data_h, const char *key,
+    double *value)
 {
   nns_edge_data_s *ed;
-  nns_edge_data_header_s edata_header;
-  void *meta_serialized = NULL;
-  nns_size_t total, header_len, data_len;
-  char *serialized, *ptr;
-  unsigned int n;
   int ret;
 
   ed = (nns_edge_data_s *) data_h;
-  if (!ed || !data || !len) {
-    nns_edge_loge ("Invalid param, one of the given param is null.");
+  if (!_nns_edge_data_info_is_valid (ed, key))
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
 
-  if (!nns_edge_handle_is_valid (ed)) {
-    nns_edge_loge ("Invalid param, given edge data is invalid.");
+  if (!value) {
+    nns_edge_loge ("Invalid param, value should not be null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
   nns_edge_lock (ed);
-  header_len = sizeof (nns_edge_data_header_s);
-
-  data_len = 0;
-  edata_header.key = NNS_EDGE_DATA_KEY;
-  edata_header.version = nns_edge_generate_version_key ();
-  edata_header.num_mem = ed->num;
-  for (n = 0; n < ed->num; n++) {
-    edata_header.data_len[n] = ed->data[n].data_len;
-    data_len += ed->data[n].data_len;
-  }
-
-  ret = nns_edge_metadata_serialize (ed->metadata, &meta_serialized,
-      &edata_header.meta_len);
-  if (NNS_EDGE_ERROR_NONE != ret) {
-    goto done;
-  }
+  ret = nns_edge_metadata_get_double (ed->metadata, key, value);
+  nns_edge_unlock (ed);
 
-  total = header_len + data_len + edata_header.meta_len;
+  return ret;
+}
 
-  serialized = ptr = (char *) nns_edge_malloc (total);
-  if (!serialized) {
-    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
-    goto done;
-  }
+/**
+ * @brief Set the information of edge data with binary value.
+ */
+int
+nns_edge_data_set_info_binary (nns_edge_data_h data_h, const char *key,
+    const void *value, nns_size_t value_len)
+{
+  nns_edge_data_s *ed;
+  int ret;
 
-  /** Copy serialization header of edge data */
-  memcpy (ptr, &edata_header, header_len);
-  ptr += header_len;
+  ed = (nns_edge_data_s *) data_h;
+  if (!_nns_edge_data_info_is_valid (ed, key))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  /** Copy edge data */
-  for (n = 0; n < ed->num; n++) {
-    memcpy (ptr, ed->data[n].data, ed->data[n].data_len);
-    ptr += ed->data[n].data_len;
+  if (!value || value_len == 0U) {
+    nns_edge_loge ("Invalid param, value should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  /** Copy edge meta data */
-  memcpy (ptr, meta_serialized, edata_header.meta_len);
-
-  *data = serialized;
-  *len = total;
-
-done:
-  SAFE_FREE (meta_serialized);
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_set_binary (ed->metadata, key, value, value_len);
   nns_edge_unlock (ed);
+
   return ret;
 }
 
 /**
- * @brief Deserialize metadata in edge data.
+ * @brief Get the binary value of the information in edge data. Caller should release the returned value using free().
  */
 int
-nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data,
-    const nns_size_t data_len)
+nns_edge_data_get_info_binary (nns_edge_data_h data_h, const char *key,
+    void **value, nns_size_t * value_len)
 {
   nns_edge_data_s *ed;
-  nns_edge_data_header_s *header;
+  void *val = NULL;
+  nns_size_t len = 0U;
   int ret;
-  unsigned int n;
-  char *ptr;
 
   ed = (nns_edge_data_s *) data_h;
-  if (!ed || !data) {
-    nns_edge_loge ("Invalid param, one of the given param is null.");
+  if (!_nns_edge_data_info_is_valid (ed, key))
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
-  }
 
-  if (!nns_edge_handle_is_valid (ed)) {
-    nns_edge_loge ("Invalid param, given edge data is invalid.");
+  if (!value || !value_len) {
+    nns_edge_loge ("Invalid param, value should not be null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  ret = nns_edge_data_is_serialized (data, data_len);
-  if (ret != NNS_EDGE_ERROR_NONE)
-    return ret;
-
   nns_edge_lock (ed);
-  header = (nns_edge_data_header_s *) data;
-  ptr = (char *) data + sizeof (nns_edge_data_header_s);
+  ret = nns_edge_metadata_get_binary (ed->metadata, key, &val, &len);
+  nns_edge_unlock (ed);
 
-  ed->num = header->num_mem;
-  for (n = 0; n < ed->num; n++) {
-    ed->data[n].data = nns_edge_memdup (ptr, header->data_len[n]);
-    ed->data[n].data_len = header->data_len[n];
-    ed->data[n].destroy_cb = nns_edge_free;
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    /* The returned value is released by the caller with free(). */
+    *value = malloc (len);
+    if (*value) {
+      memcpy (*value, val, len);
+      *value_len = len;
+    } else {
+      ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
 
-    ptr += header->data_len[n];
+    nns_edge_free (val);
   }
 
-  ret = nns_edge_metadata_deserialize (ed->metadata, ptr, header->meta_len);
-
-  nns_edge_unlock (ed);
   return ret;
 }
 
 /**
- * @brief Check given data is serialized buffer.
+ * @brief Clear information of edge data.
  */
 int
-nns_edge_data_is_serialized (const void *data, const nns_size_t data_len)
+nns_edge_data_clear_info (nns_edge_data_h data_h)
 {
-  nns_edge_data_header_s *header;
-  nns_size_t total;
-  unsigned int n;
-
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_destroy (ed->metadata);
+  if (NNS_EDGE_ERROR_NONE != ret)
+    goto done;
+  ret = nns_edge_metadata_create_with_allocator (&ed->metadata,
+      &ed->allocator);
+done:
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Release raw data and clear metadata in edge data, to reuse the handle.
+ */
+int
+nns_edge_data_reset (nns_edge_data_h data_h)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+
+  _nns_edge_data_release_memories (ed);
+
+  ret = nns_edge_metadata_clear (ed->metadata);
+
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Serialize metadata in edge data.
+ */
+int
+nns_edge_data_serialize_meta (nns_edge_data_h data_h, void **data,
+    nns_size_t * data_len)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_serialize (ed->metadata, data, data_len);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Deserialize metadata in edge data.
+ */
+int
+nns_edge_data_deserialize_meta (nns_edge_data_h data_h, const void *data,
+    const nns_size_t data_len)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_deserialize (ed->metadata, data, data_len);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Deserialize metadata in edge data, without copying the serialized metadata.
+ */
+int
+nns_edge_data_deserialize_meta_take (nns_edge_data_h data_h, void *data,
+    const nns_size_t data_len)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_deserialize_take (ed->metadata, data, data_len);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Get the metadata in edge data. The metadata is shared with edge data until one of them is updated.
+ */
+int
+nns_edge_data_get_meta (nns_edge_data_h data_h, nns_edge_metadata_h meta_h)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_copy (meta_h, ed->metadata);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Set the metadata in edge data. The metadata is shared with edge data until one of them is updated.
+ */
+int
+nns_edge_data_set_meta (nns_edge_data_h data_h, nns_edge_metadata_h meta_h)
+{
+  nns_edge_data_s *ed;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed) {
+    nns_edge_loge ("Invalid param, given edge data handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = nns_edge_metadata_copy (ed->metadata, meta_h);
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Check the alignment of memories in serialized edge data. 0 means the memories are packed.
+ */
+bool
+nns_edge_data_alignment_is_valid (nns_size_t alignment)
+{
+  if (alignment == 0U)
+    return true;
+
+  if (alignment < NNS_EDGE_DATA_ALIGNMENT_MIN ||
+      alignment > NNS_EDGE_DATA_ALIGNMENT_MAX ||
+      (alignment & (alignment - 1)) != 0U) {
+    nns_edge_loge ("Invalid param, the alignment %" PRIu64
+        " should be power of 2 between %d and %d.", (uint64_t) alignment,
+        NNS_EDGE_DATA_ALIGNMENT_MIN, NNS_EDGE_DATA_ALIGNMENT_MAX);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Internal function to get the layout of serialized edge data.
+ * @note This function should be called with data lock.
+ */
+static int
+_nns_edge_data_get_layout (nns_edge_data_s * ed, nns_size_t alignment,
+    nns_edge_data_layout_s * layout)
+{
+  nns_size_t offset;
+  unsigned int n;
+  int ret;
+
+  if (!nns_edge_data_alignment_is_valid (alignment))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  memset (layout, 0, sizeof (nns_edge_data_layout_s));
+  layout->alignment = alignment;
+  layout->num_mem = ed->num;
+
+  if (alignment > 0U)
+    offset = ALIGN_UP (sizeof (nns_edge_data_header_aligned_s), alignment);
+  else
+    offset = sizeof (nns_edge_data_header_s);
+
+  for (n = 0; n < ed->num; n++) {
+    layout->data_offset[n] = offset;
+    layout->data_len[n] = ed->data[n].data_len;
+    offset += ed->data[n].data_len;
+
+    if (alignment > 0U && n + 1 < ed->num)
+      offset = ALIGN_UP (offset, alignment);
+  }
+
+  ret = nns_edge_metadata_get_serialized_size (ed->metadata,
+      &layout->meta_len);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  layout->meta_offset = offset;
+  layout->total = offset + layout->meta_len;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to write the header of serialized edge data.
+ */
+static void
+_nns_edge_data_write_header (nns_edge_data_layout_s * layout, char *ptr)
+{
+  unsigned int n;
+
+  if (layout->alignment > 0U) {
+    nns_edge_data_header_aligned_s *header;
+
+    header = (nns_edge_data_header_aligned_s *) ptr;
+    memset (header, 0, layout->data_offset[0] > 0U ?
+        layout->data_offset[0] : layout->meta_offset);
+    header->key = NNS_EDGE_DATA_KEY_ALIGNED;
+    header->alignment = (uint32_t) layout->alignment;
+    header->version = nns_edge_generate_version_key ();
+    header->num_mem = layout->num_mem;
+    for (n = 0; n < layout->num_mem; n++) {
+      header->data_offset[n] = layout->data_offset[n];
+      header->data_len[n] = layout->data_len[n];
+    }
+    header->meta_offset = layout->meta_offset;
+    header->meta_len = layout->meta_len;
+  } else {
+    nns_edge_data_header_s *header;
+
+    header = (nns_edge_data_header_s *) ptr;
+    memset (header, 0, sizeof (nns_edge_data_header_s));
+    header->key = NNS_EDGE_DATA_KEY;
+    header->version = nns_edge_generate_version_key ();
+    header->num_mem = layout->num_mem;
+    for (n = 0; n < layout->num_mem; n++)
+      header->data_len[n] = layout->data_len[n];
+    header->meta_len = layout->meta_len;
+  }
+}
+
+/**
+ * @brief Internal function to write serialized edge data. The buffer should be large enough.
+ * @note This function should be called with data lock.
+ */
+static int
+_nns_edge_data_write (nns_edge_data_s * ed, nns_edge_data_layout_s * layout,
+    char *ptr)
+{
+  nns_size_t end;
+  unsigned int n;
+
+  /** Copy serialization header of edge data */
+  _nns_edge_data_write_header (layout, ptr);
+
+  /** Copy edge data, and clear the padding between memories */
+  for (n = 0; n < ed->num; n++) {
+    memcpy (ptr + layout->data_offset[n], ed->data[n].data,
+        ed->data[n].data_len);
+
+    end = layout->data_offset[n] + ed->data[n].data_len;
+    if (n + 1 < ed->num && end < layout->data_offset[n + 1])
+      memset (ptr + end, 0, layout->data_offset[n + 1] - end);
+  }
+
+  /** Copy edge meta data */
+  return nns_edge_metadata_serialize_into (ed->metadata,
+      ptr + layout->meta_offset, layout->meta_len);
+}
+
+/**
+ * @brief Internal function to parse the header of serialized edge data, and check the size of given data.
+ */
+static int
+_nns_edge_data_parse_header (const void *data, const nns_size_t data_len,
+    nns_edge_data_layout_s * layout)
+{
+  const nns_edge_data_header_s *header;
+  const nns_edge_data_header_aligned_s *aheader;
+  nns_size_t offset;
+  unsigned int n;
+
   if (!data) {
     nns_edge_loge ("Invalid param, given data is null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  header = (nns_edge_data_header_s *) data;
-  if (header->key != NNS_EDGE_DATA_KEY) {
-    nns_edge_loge ("Invalid param, given data has invalid format.");
+  if (data_len < sizeof (nns_edge_data_header_s)) {
+    nns_edge_loge ("Invalid param, given data has invalid data size.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  if (!nns_edge_parse_version_key (header->version, NULL, NULL, NULL)) {
-    nns_edge_loge ("Invalid param, given data has invalid version.");
+  header = (const nns_edge_data_header_s *) data;
+  aheader = (const nns_edge_data_header_aligned_s *) data;
+
+  if (header->key == NNS_EDGE_DATA_KEY_ALIGNED &&
+      data_len < sizeof (nns_edge_data_header_aligned_s)) {
+    nns_edge_loge ("Invalid param, given data has invalid data size.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (header->key == NNS_EDGE_DATA_KEY) {
+    if (!nns_edge_parse_version_key (header->version, NULL, NULL, NULL)) {
+      nns_edge_loge ("Invalid param, given data has invalid version.");
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (header->key == NNS_EDGE_DATA_KEY_ALIGNED) {
+    if (!nns_edge_parse_version_key (aheader->version, NULL, NULL, NULL)) {
+      nns_edge_loge ("Invalid param, given data has invalid version.");
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+
+    if (aheader->alignment == 0U ||
+        !nns_edge_data_alignment_is_valid (aheader->alignment))
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else {
+    nns_edge_loge ("Invalid param, given data has invalid format.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
@@ -665,20 +1190,457 @@ nns_edge_data_is_serialized (const void *data, const nns_size_t data_len)
    * Total number of memories in edge-data should be less than NNS_EDGE_DATA_LIMIT.
    * Fetch nns-edge version info and check allowed memories if NNS_EDGE_DATA_LIMIT is updated.
    */
-  if (header->num_mem > NNS_EDGE_DATA_LIMIT) {
+  layout->num_mem = (header->key == NNS_EDGE_DATA_KEY) ?
+      header->num_mem : aheader->num_mem;
+  if (layout->num_mem > NNS_EDGE_DATA_LIMIT) {
     nns_edge_loge ("Invalid param, given data has invalid memories.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
+  if (header->key == NNS_EDGE_DATA_KEY) {
+    layout->alignment = 0U;
+    offset = sizeof (nns_edge_data_header_s);
+
+    for (n = 0; n < layout->num_mem; n++) {
+      if (header->data_len[n] > data_len - offset)
+        goto error;
+
+      layout->data_offset[n] = offset;
+      layout->data_len[n] = header->data_len[n];
+      offset += header->data_len[n];
+    }
+
+    layout->meta_offset = offset;
+    layout->meta_len = header->meta_len;
+  } else {
+    layout->alignment = aheader->alignment;
+    offset = sizeof (nns_edge_data_header_aligned_s);
+
+    /* Each memory starts at aligned offset, after the previous one. */
+    for (n = 0; n < layout->num_mem; n++) {
+      if (aheader->data_offset[n] < offset ||
+          aheader->data_offset[n] > data_len ||
+          aheader->data_len[n] > data_len - aheader->data_offset[n] ||
+          (aheader->data_offset[n] & (layout->alignment - 1)) != 0U)
+        goto error;
+
+      layout->data_offset[n] = aheader->data_offset[n];
+      layout->data_len[n] = aheader->data_len[n];
+      offset = aheader->data_offset[n] + aheader->data_len[n];
+    }
+
+    if (aheader->meta_offset < offset || aheader->meta_offset > data_len)
+      goto error;
+
+    layout->meta_offset = aheader->meta_offset;
+    layout->meta_len = aheader->meta_len;
+  }
+
   /* Check mem size */
-  total = sizeof (nns_edge_data_header_s) + header->meta_len;
-  for (n = 0; n < header->num_mem; n++)
-    total += header->data_len[n];
+  if (layout->meta_len != data_len - layout->meta_offset)
+    goto error;
 
-  if (total != data_len) {
-    nns_edge_loge ("Invalid param, given data has invalid data size.");
+  layout->total = data_len;
+  return NNS_EDGE_ERROR_NONE;
+
+error:
+  nns_edge_loge ("Invalid param, given data has invalid data size.");
+  return NNS_EDGE_ERROR_INVALID_PARAMETER;
+}
+
+/**
+ * @brief Get the byte size of serialized edge data.
+ */
+int
+nns_edge_data_get_serialized_size (nns_edge_data_h data_h,
+    nns_size_t alignment, nns_size_t * size)
+{
+  nns_edge_data_s *ed;
+  nns_edge_data_layout_s layout;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !size) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  return NNS_EDGE_ERROR_NONE;
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = _nns_edge_data_get_layout (ed, alignment, &layout);
+  if (ret == NNS_EDGE_ERROR_NONE)
+    *size = layout.total;
+  nns_edge_unlock (ed);
+
+  return ret;
+}
+
+/**
+ * @brief Serialize edge data (meta data + raw data) into given buffer.
+ */
+int
+nns_edge_data_serialize_into (nns_edge_data_h data_h, nns_size_t alignment,
+    void *data, const nns_size_t data_len)
+{
+  nns_edge_data_s *ed;
+  nns_edge_data_layout_s layout;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !data) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = _nns_edge_data_get_layout (ed, alignment, &layout);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    goto done;
+
+  if (data_len < layout.total) {
+    nns_edge_loge ("Invalid param, the buffer is too small to serialize edge data.");
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  ret = _nns_edge_data_write (ed, &layout, (char *) data);
+
+done:
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Internal function to serialize edge data into newly allocated buffer.
+ */
+static int
+_nns_edge_data_serialize (nns_edge_data_h data_h, nns_size_t alignment,
+    void **data, nns_size_t * len)
+{
+  nns_edge_data_s *ed;
+  nns_edge_data_layout_s layout;
+  void *serialized;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !data || !len) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (ed);
+  ret = _nns_edge_data_get_layout (ed, alignment, &layout);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    goto done;
+
+  if (alignment > 0U)
+    serialized = nns_edge_malloc_aligned (alignment, layout.total);
+  else
+    serialized = nns_edge_malloc (layout.total);
+
+  if (!serialized) {
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  ret = _nns_edge_data_write (ed, &layout, (char *) serialized);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_free (serialized);
+    goto done;
+  }
+
+  *data = serialized;
+  *len = layout.total;
+
+done:
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Serialize edge data (meta data + raw data).
+ */
+int
+nns_edge_data_serialize (nns_edge_data_h data_h, void **data, nns_size_t * len)
+{
+  return _nns_edge_data_serialize (data_h, 0U, data, len);
+}
+
+/**
+ * @brief Serialize edge data with aligned format. Each memory starts at the offset aligned to given bytes.
+ */
+int
+nns_edge_data_serialize_aligned (nns_edge_data_h data_h, nns_size_t alignment,
+    void **data, nns_size_t * len)
+{
+  if (alignment == 0U) {
+    nns_edge_loge ("Invalid param, the alignment should be larger than 0.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  return _nns_edge_data_serialize (data_h, alignment, data, len);
+}
+
+/**
+ * @brief Serialize edge data into reusable buffer. The buffer is reallocated if it is smaller than serialized edge data.
+ */
+int
+nns_edge_data_serialize_reuse (nns_edge_data_h data_h, nns_size_t alignment,
+    void **buffer, nns_size_t * buffer_size, nns_size_t * data_len)
+{
+  nns_size_t total;
+  int ret;
+
+  if (!buffer || !buffer_size || !data_len) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  ret = nns_edge_data_get_serialized_size (data_h, alignment, &total);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  /* The raw data in aligned format should be aligned in the address space, reallocate the buffer if it is not aligned. */
+  if (!*buffer || *buffer_size < total || (alignment > 0U &&
+          ((uintptr_t) (*buffer) & (alignment - 1)) != 0U)) {
+    nns_edge_free (*buffer);
+    *buffer_size = 0U;
+
+    if (alignment > 0U)
+      *buffer = nns_edge_malloc_aligned (alignment, total);
+    else
+      *buffer = nns_edge_malloc (total);
+    if (!*buffer) {
+      nns_edge_loge ("Failed to allocate memory to serialize edge data.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    *buffer_size = total;
+  }
+
+  ret = nns_edge_data_serialize_into (data_h, alignment, *buffer,
+      *buffer_size);
+  if (ret == NNS_EDGE_ERROR_NONE)
+    *data_len = total;
+
+  return ret;
+}
+
+/**
+ * @brief Serialize edge data into the list of memory chunks, without copying raw data.
+ */
+int
+nns_edge_data_serialize_iov (nns_edge_data_h data_h, nns_edge_data_iov_s * iov)
+{
+  nns_edge_data_s *ed;
+  nns_edge_data_layout_s layout;
+  char *buffer = NULL;
+  unsigned int n;
+  int ret;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !iov) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  memset (iov, 0, sizeof (nns_edge_data_iov_s));
+
+  nns_edge_lock (ed);
+
+  ret = _nns_edge_data_get_layout (ed, 0U, &layout);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    goto done;
+
+  /* The header and serialized metadata are written in one buffer. */
+  buffer = (char *) nns_edge_malloc (sizeof (nns_edge_data_header_s) +
+      layout.meta_len);
+  if (!buffer) {
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  _nns_edge_data_write_header (&layout, buffer);
+  ret = nns_edge_metadata_serialize_into (ed->metadata,
+      buffer + sizeof (nns_edge_data_header_s), layout.meta_len);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_free (buffer);
+    goto done;
+  }
+
+  iov->iov[iov->num].iov_base = buffer;
+  iov->iov[iov->num++].iov_len = sizeof (nns_edge_data_header_s);
+
+  for (n = 0; n < ed->num; n++) {
+    if (ed->data[n].data_len == 0U)
+      continue;
+
+    iov->iov[iov->num].iov_base = ed->data[n].data;
+    iov->iov[iov->num++].iov_len = ed->data[n].data_len;
+  }
+
+  if (layout.meta_len > 0U) {
+    iov->iov[iov->num].iov_base = buffer + sizeof (nns_edge_data_header_s);
+    iov->iov[iov->num++].iov_len = layout.meta_len;
+  }
+
+  iov->buffer = buffer;
+  iov->total = layout.total;
+
+done:
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Release the buffer in the list of memory chunks.
+ */
+void
+nns_edge_data_release_iov (nns_edge_data_iov_s * iov)
+{
+  if (!iov)
+    return;
+
+  nns_edge_free (iov->buffer);
+  memset (iov, 0, sizeof (nns_edge_data_iov_s));
+}
+
+/**
+ * @brief Internal function to deserialize entire edge data. If view is true, the memories point into given buffer.
+ */
+static int
+_nns_edge_data_deserialize (nns_edge_data_h data_h, void *data,
+    const nns_size_t data_len, bool view, nns_edge_data_destroy_cb destroy_cb)
+{
+  nns_edge_data_s *ed;
+  nns_edge_data_layout_s layout;
+  int ret;
+  unsigned int n;
+  char *ptr;
+
+  ed = (nns_edge_data_s *) data_h;
+  if (!ed || !data) {
+    nns_edge_loge ("Invalid param, one of the given param is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (ed)) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  ret = _nns_edge_data_parse_header (data, data_len, &layout);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  nns_edge_lock (ed);
+
+  ret = _nns_edge_data_reserve (ed, layout.num_mem);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    goto done;
+
+  _nns_edge_data_release_memories (ed);
+
+  for (n = 0; n < layout.num_mem; n++) {
+    ptr = (char *) data + layout.data_offset[n];
+
+    /**
+     * The memory in aligned format should be aligned in the address space.
+     * Copy it into aligned memory if the buffer itself is not aligned.
+     */
+    if (view && (layout.alignment == 0U ||
+            ((uintptr_t) ptr & (layout.alignment - 1)) == 0U)) {
+      ed->data[n].data = ptr;
+      ed->data[n].destroy_cb = NULL;
+    } else {
+      if (layout.alignment > 0U) {
+        ed->data[n].data = nns_edge_malloc_aligned (layout.alignment,
+            layout.data_len[n]);
+        if (ed->data[n].data)
+          memcpy (ed->data[n].data, ptr, layout.data_len[n]);
+      } else {
+        ed->data[n].data = nns_edge_memdup (ptr, layout.data_len[n]);
+      }
+
+      if (!ed->data[n].data) {
+        nns_edge_loge ("Failed to allocate memory for edge data.");
+        ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+        goto done;
+      }
+      ed->data[n].destroy_cb = nns_edge_free;
+    }
+
+    ed->data[n].data_len = layout.data_len[n];
+    ed->data[n].transferable = false;
+    ed->num++;
+  }
+
+  ret = nns_edge_metadata_deserialize (ed->metadata,
+      (char *) data + layout.meta_offset, layout.meta_len);
+
+done:
+  if (view) {
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      ed->buffer = data;
+      ed->buffer_destroy_cb = destroy_cb;
+    } else {
+      /* Caller keeps the buffer if failed, drop the memories pointing into it. */
+      _nns_edge_data_release_memories (ed);
+    }
+  }
+
+  nns_edge_unlock (ed);
+  return ret;
+}
+
+/**
+ * @brief Deserialize entire edge data (meta data + raw data).
+ */
+int
+nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data,
+    const nns_size_t data_len)
+{
+  return _nns_edge_data_deserialize (data_h, (void *) data, data_len, false,
+      NULL);
+}
+
+/**
+ * @brief Deserialize entire edge data without copying raw data. The memories in edge data point into given buffer.
+ */
+int
+nns_edge_data_deserialize_view (nns_edge_data_h data_h, void *data,
+    const nns_size_t data_len, nns_edge_data_destroy_cb destroy_cb)
+{
+  return _nns_edge_data_deserialize (data_h, data, data_len, true,
+      destroy_cb);
+}
+
+/**
+ * @brief Check given data is serialized buffer.
+ */
+int
+nns_edge_data_is_serialized (const void *data, const nns_size_t data_len)
+{
+  nns_edge_data_layout_s layout;
+
+  return _nns_edge_data_parse_header (data, data_len, &layout);
 }
@@ -14,6 +14,7 @@
 #ifndef __NNSTREAMER_EDGE_DATA_H__
 #define __NNSTREAMER_EDGE_DATA_H__
 
+#include <sys/uio.h>
 #include "nnstreamer-edge.h"
 #include "nnstreamer-edge-metadata.h"
 
@@ -21,6 +22,26 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/**
+ * @brief Data structure for the list of memory chunks of serialized edge data (header, raw data and metadata).
+ * @note The chunks of raw data refer to the memories in edge data. The edge data should not be changed or released until the chunks are sent.
+ */
+typedef struct
+{
+  struct iovec iov[NNS_EDGE_DATA_LIMIT + 2];
+  unsigned int num;
+  nns_size_t total; /**< the byte size of serialized edge data */
+  void *buffer; /**< allocated memory for the header and metadata */
+} nns_edge_data_iov_s;
+
+/**
+ * @brief Create edge data with given allocator. The handle, the storage of memories and metadata are allocated with the allocator.
+ * @note This is internal function, DO NOT export this. The memories added into edge data are not allocated with the allocator.
+ * @param[out] data_h Newly created handle.
+ * @param[in] allocator The memory allocator, null to use the default allocator. It is copied into the handle.
+ */
+int nns_edge_data_create_with_allocator (nns_edge_data_h *data_h, const nns_edge_allocator_s *allocator);
+
 /**
  * @brief Internal wrapper function of the nns_edge_data_destory() to avoid build warning of the incompatibe type casting. (See nns_edge_data_destroy_cb())
  */
@@ -32,9 +53,27 @@ void nns_edge_data_release_handle (void *data);
  */
 int nns_edge_data_is_valid (nns_edge_data_h data_h);
 
+/**
+ * @brief Copy edge data and transfer the ownership of the transferable memory to new handle. Other memories are copied.
+ * @note This is internal function, DO NOT export this. The moved memory is cleared in given handle, copying given handle again returns an error.
+ */
+int nns_edge_data_copy_transfer (nns_edge_data_h data_h, nns_edge_data_h *new_data_h);
+
+/**
+ * @brief Add raw data allocated with the alloc callback of the application. The memory can be moved with nns_edge_data_copy_transfer().
+ * @note This is internal function, DO NOT export this.
+ */
+int nns_edge_data_add_transferable (nns_edge_data_h data_h, void *data, nns_size_t data_len, nns_edge_data_destroy_cb destroy_cb);
+
+/**
+ * @brief Release raw data and clear metadata in edge data, to reuse the handle.
+ * @note This is internal function, DO NOT export this.
+ */
+int nns_edge_data_reset (nns_edge_data_h data_h);
+
 /**
  * @brief Serialize metadata in edge data.
- * @note This is internal function, DO NOT export this. Caller should release the returned value using free().
+ * @note This is internal function, DO NOT export this. Caller should release the returned value using nns_edge_free().
  */
 int nns_edge_data_serialize_meta (nns_edge_data_h data_h, void **data, nns_size_t *data_len);
 
@@ -44,18 +83,82 @@ int nns_edge_data_serialize_meta (nns_edge_data_h data_h, void **data, nns_size_
  */
 int nns_edge_data_deserialize_meta (nns_edge_data_h data_h, const void *data, const nns_size_t data_len);
 
+/**
+ * @brief Deserialize metadata in edge data, without copying the serialized metadata.
+ * @note This is internal function, DO NOT export this. If successful, edge data takes the ownership of given data.
+ */
+int nns_edge_data_deserialize_meta_take (nns_edge_data_h data_h, void *data, const nns_size_t data_len);
+
+/**
+ * @brief Get the metadata in edge data. The metadata is shared with edge data until one of them is updated.
+ */
+int nns_edge_data_get_meta (nns_edge_data_h data_h, nns_edge_metadata_h meta_h);
+
+/**
+ * @brief Set the metadata in edge data. The metadata is shared with edge data until one of them is updated.
+ */
+int nns_edge_data_set_meta (nns_edge_data_h data_h, nns_edge_metadata_h meta_h);
+
 /**
  * @brief Serialize entire edge data (meta data + raw data).
- * @note This is internal function, DO NOT export this. Caller should release the returned value using free().
+ * @note This is internal function, DO NOT export this. Caller should release the returned value using nns_edge_free().
  */
 int nns_edge_data_serialize (nns_edge_data_h data_h, void **data, nns_size_t *data_len);
 
+/**
+ * @brief Check the alignment of memories in serialized edge data. 0 means the memories are packed.
+ * @note This is internal function, DO NOT export this.
+ */
+bool nns_edge_data_alignment_is_valid (nns_size_t alignment);
+
+/**
+ * @brief Serialize entire edge data with aligned format. Each memory starts at the offset aligned to given bytes (power of 2, from 8 to 65536).
+ * @note This is internal function, DO NOT export this. The returned buffer is also aligned. Caller should release the returned value using nns_edge_free().
+ */
+int nns_edge_data_serialize_aligned (nns_edge_data_h data_h, nns_size_t alignment, void **data, nns_size_t *data_len);
+
+/**
+ * @brief Get the byte size of serialized edge data. If alignment is larger than 0, the size of aligned format is returned.
+ * @note This is internal function, DO NOT export this.
+ */
+int nns_edge_data_get_serialized_size (nns_edge_data_h data_h, nns_size_t alignment, nns_size_t *size);
+
+/**
+ * @brief Serialize entire edge data (meta data + raw data) into given buffer.
+ * @note This is internal function, DO NOT export this. The buffer should be larger than the size from nns_edge_data_get_serialized_size().
+ */
+int nns_edge_data_serialize_into (nns_edge_data_h data_h, nns_size_t alignment, void *data, const nns_size_t data_len);
+
+/**
+ * @brief Serialize entire edge data into reusable buffer. The buffer is reallocated if it is smaller than serialized edge data, or it is not aligned to given bytes.
+ * @note This is internal function, DO NOT export this. Caller should release the buffer using nns_edge_free(), which also releases the aligned buffer.
+ */
+int nns_edge_data_serialize_reuse (nns_edge_data_h data_h, nns_size_t alignment, void **buffer, nns_size_t *buffer_size, nns_size_t *data_len);
+
+/**
+ * @brief Serialize entire edge data into the list of memory chunks, without copying raw data.
+ * @note This is internal function, DO NOT export this. Caller should release the list using nns_edge_data_release_iov().
+ */
+int nns_edge_data_serialize_iov (nns_edge_data_h data_h, nns_edge_data_iov_s *iov);
+
+/**
+ * @brief Release the buffer in the list of memory chunks.
+ * @note This is internal function, DO NOT export this.
+ */
+void nns_edge_data_release_iov (nns_edge_data_iov_s *iov);
+
 /**
  * @brief Deserialize entire edge data (meta data + raw data).
  * @note This is internal function, DO NOT export this.
  */
 int nns_edge_data_deserialize (nns_edge_data_h data_h, const void *data, const nns_size_t data_len);
 
+/**
+ * @brief Deserialize entire edge data without copying raw data. The memories in edge data point into given buffer.
+ * @note This is internal function, DO NOT export this. If succeeded, the buffer is released with given destroy callback when the memories are released. If the callback is null, caller should keep the buffer until then.
+ */
+int nns_edge_data_deserialize_view (nns_edge_data_h data_h, void *data, const nns_size_t data_len, nns_edge_data_destroy_cb destroy_cb);
+
 /**
  * @brief Check given data is serialized buffer.
  * @note This is internal function, DO NOT export this.
@@ -83,7 +83,7 @@ nns_edge_event_create (nns_edge_event_e event, nns_edge_event_h * event_h)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  ee = (nns_edge_event_s *) calloc (1, sizeof (nns_edge_event_s));
+  ee = (nns_edge_event_s *) nns_edge_calloc (1, sizeof (nns_edge_event_s));
   if (!ee) {
     nns_edge_loge ("Failed to allocate memory for edge event.");
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -116,7 +116,7 @@ nns_edge_event_destroy (nns_edge_event_h event_h)
   if (ee->data.destroy_cb)
     ee->data.destroy_cb (ee->data.data);
 
-  SAFE_FREE (ee);
+  SAFE_EDGE_FREE (ee);
   return NNS_EDGE_ERROR_NONE;
 }
 
@@ -177,7 +177,7 @@ nns_edge_event_get_type (nns_edge_event_h event_h, nns_edge_event_e * event)
 }
 
 /**
- * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED) and get received data.
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED or NNS_EDGE_EVENT_REQUEST_EXPIRED) and get received data.
  */
 int
 nns_edge_event_parse_new_data (nns_edge_event_h event_h,
@@ -197,7 +197,8 @@ nns_edge_event_parse_new_data (nns_edge_event_h event_h,
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  if (ee->event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+  if (ee->event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED &&
+      ee->event != NNS_EDGE_EVENT_REQUEST_EXPIRED) {
     nns_edge_loge ("The edge event has invalid event type.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
@@ -205,6 +206,101 @@ nns_edge_event_parse_new_data (nns_edge_event_h event_h,
   return nns_edge_data_copy ((nns_edge_data_h) ee->data.data, data_h);
 }
 
+/**
+ * @brief Take received data from edge event (NNS_EDGE_EVENT_NEW_DATA_RECEIVED or NNS_EDGE_EVENT_REQUEST_EXPIRED) without copying the memory allocated with the alloc callback.
+ */
+int
+nns_edge_event_take_new_data (nns_edge_event_h event_h,
+    nns_edge_data_h * data_h)
+{
+  nns_edge_event_s *ee;
+
+  ee = (nns_edge_event_s *) event_h;
+
+  if (!nns_edge_handle_is_valid (ee)) {
+    nns_edge_loge ("Invalid param, given edge event is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!data_h) {
+    nns_edge_loge ("Invalid param, data_h should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (ee->event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED &&
+      ee->event != NNS_EDGE_EVENT_REQUEST_EXPIRED) {
+    nns_edge_loge ("The edge event has invalid event type.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  return nns_edge_data_copy_transfer ((nns_edge_data_h) ee->data.data, data_h);
+}
+
+/**
+ * @brief Parse edge event (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) and get the requests received in query server.
+ */
+int
+nns_edge_event_parse_new_batch (nns_edge_event_h event_h,
+    nns_edge_data_h ** batch, unsigned int *num)
+{
+  nns_edge_event_s *ee;
+  nns_edge_data_h *received, *copied;
+  unsigned int i, n;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  ee = (nns_edge_event_s *) event_h;
+
+  if (!nns_edge_handle_is_valid (ee)) {
+    nns_edge_loge ("Invalid param, given edge event is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!batch || !num) {
+    nns_edge_loge ("Invalid param, batch and num should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (ee->event != NNS_EDGE_EVENT_NEW_BATCH_RECEIVED) {
+    nns_edge_loge ("The edge event has invalid event type.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  /* The event data is the array of edge data handles. */
+  received = (nns_edge_data_h *) ee->data.data;
+  n = (unsigned int) (ee->data.data_len / sizeof (nns_edge_data_h));
+  if (!received || n == 0U) {
+    nns_edge_loge ("The edge event does not have the batch.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  /* The array is returned to the caller, do not use the allocator. */
+  copied = (nns_edge_data_h *) calloc (n, sizeof (nns_edge_data_h));
+  if (!copied) {
+    nns_edge_loge ("Failed to allocate memory for the batch.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  for (i = 0; i < n; i++) {
+    ret = nns_edge_data_copy (received[i], &copied[i]);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to copy the data in the batch.");
+      break;
+    }
+  }
+
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    while (i > 0U)
+      nns_edge_data_destroy (copied[--i]);
+    SAFE_FREE (copied);
+    return ret;
+  }
+
+  *batch = copied;
+  *num = n;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
 /**
  * @brief Parse edge event (NNS_EDGE_EVENT_CAPABILITY) and get capability string.
  */
@@ -11,14 +11,20 @@
  */
 
 #include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <netdb.h>
 #include <poll.h>
+#include <stddef.h>
 
+#include "nnstreamer-edge-codec.h"
 #include "nnstreamer-edge-data.h"
 #include "nnstreamer-edge-event.h"
 #include "nnstreamer-edge-log.h"
 #include "nnstreamer-edge-util.h"
 #include "nnstreamer-edge-queue.h"
+#include "nnstreamer-edge-pool.h"
+#include "nnstreamer-edge-request.h"
 #include "nnstreamer-edge-aitt.h"
 #include "nnstreamer-edge-mqtt.h"
 
@@ -27,10 +33,56 @@
 #endif
 
 /**
- * @brief The maximum length of pending connections to accept socket.
+ * @brief The default maximum length of pending connections to accept socket.
  */
 #define N_BACKLOG 10
 
+/**
+ * @brief The default number of threads to handle the handshake of accepted sockets.
+ */
+#define N_HANDSHAKE_WORKERS 4
+
+/**
+ * @brief The default timeout (milliseconds) of each handshake stage.
+ */
+#define DEFAULT_HANDSHAKE_TIMEOUT 5000
+
+/**
+ * @brief The default timeout (milliseconds) to connect to the destination.
+ */
+#define DEFAULT_CONNECT_TIMEOUT 10000
+
+/**
+ * @brief The max time (milliseconds) to wait for the host info sent in the first flight, if fast reconnect is enabled.
+ */
+#define FIRST_FLIGHT_TIMEOUT 100
+
+/**
+ * @brief The max number of candidates to connect in parallel, in hybrid connection.
+ */
+#define N_CONNECT_CANDIDATES 16
+#define N_FASTOPEN_QUEUE 16
+
+/**
+ * @brief The default byte size of the memory to be encoded with the codec.
+ */
+#define DEFAULT_CODEC_THRESHOLD 1024
+
+/**
+ * @brief The default byte size of the element to shuffle the raw data (e.g., float32 tensor).
+ */
+#define DEFAULT_CODEC_ELEMENT_SIZE 4
+
+/**
+ * @brief The default interval of keyframes, the delta of memories is sent in other frames.
+ */
+#define DEFAULT_DELTA_KEYFRAME 30
+
+/**
+ * @brief The default time (milliseconds) to wait for more requests in a batch.
+ */
+#define DEFAULT_BATCH_TIMEOUT 5
+
 /**
  * @brief Data structure for edge handle.
  */
@@ -56,20 +108,80 @@ typedef struct
 
   int64_t client_id;
   char *caps_str;
+  unsigned int connect_timeout; /**< timeout (milliseconds) to connect to the destination */
+  bool fast_reconnect; /**< TCP fast open and resuming the handshake with cached capability */
+  nns_size_t data_alignment; /**< alignment of the memories in serialized edge data, 0 if packed */
+  nns_edge_metadata_h caps_cache; /**< capability hash accepted before (key: host:port) */
+
+  /* codec to encode the memories of data transferred over TCP connection */
+  char *codec; /**< name of the codec, null if the data is not encoded */
+  nns_size_t codec_threshold; /**< the memory smaller than this is sent without encoding */
+  nns_edge_codec_filter_e codec_filter; /**< filter applied to the raw data before encoding */
+  unsigned int codec_element_size; /**< byte size of the element to shuffle the raw data */
+  nns_edge_codec_precision_e wire_precision; /**< precision of float32 values sent over TCP connection */
+  bool restore_precision; /**< true to restore float32 values of received data */
+  bool delta; /**< true to send the XOR delta from the memories of previous frame */
+  unsigned int delta_keyframe; /**< interval of keyframes, the raw memories are sent */
+  nns_edge_codec_stats_s codec_stats;
 
   /* list of connection data */
   void *connections;
 
-  /* socket listener */
+  /* socket listeners */
   bool listening;
-  int listener_fd;
-  pthread_t listener_thread;
+  int backlog;
+  unsigned int listener_num; /**< the number of listeners set with the key LISTENERS */
+  void *listeners;
+  unsigned int listeners_len; /**< the number of opened listeners */
+
+  /* workers to handle the handshake of accepted sockets */
+  unsigned int handshake_workers;
+  unsigned int handshake_timeout;
+  pthread_t *handshake_threads;
+  nns_edge_queue_h accept_queue;
+  nns_edge_queue_h ready_queue;
 
   /* thread and queue to send data */
   bool sending;
   nns_edge_queue_h send_queue;
   pthread_t send_thread;
 
+  /* pool to recycle data handles and buffers of received data */
+  nns_edge_pool_h pool;
+
+  /* allocator of the data, metadata and codec buffers of the handle, empty to use the default allocator */
+  nns_edge_allocator_s allocator;
+
+  /* requests of query client waiting for the response */
+  nns_edge_request_h requests;
+
+  /* query client connected to many servers, the request is sent to the server selected with the policy */
+  nns_edge_request_policy_e lb_policy;
+  unsigned int lb_eject_failures; /**< the number of consecutive failures to eject the server */
+  unsigned int lb_eject_time; /**< the time (milliseconds) the ejected server is not selected */
+  int64_t *lb_targets;
+  unsigned int lb_targets_len;
+
+  /* the duplicate of the request which is not responded within the percentile of latency is sent to other server */
+  unsigned int hedge_percentile; /**< 0 if the hedged request is disabled */
+  bool hedging;
+
+  /* the time (milliseconds) the request of query client is expired, query server drops the expired request */
+  unsigned int request_timeout; /**< 0 if the request is not expired */
+
+  /* thread and queue to gather the requests of query server into a batch */
+  unsigned int batch_size; /**< max number of requests in a batch, 0 if the batch is disabled */
+  unsigned int batch_timeout; /**< max time (milliseconds) to wait for more requests in a batch */
+  bool batching;
+  nns_edge_data_h *batch; /**< the pending requests, twice the batch size to select the earliest deadlines */
+  int64_t *batch_deadline; /**< the deadline of pending requests, INT64_MAX if not expired */
+  nns_edge_queue_h batch_queue;
+  pthread_t batch_thread;
+
+  /* callback to allocate the memory of received data */
+  nns_edge_alloc_cb alloc_cb;
+  void *alloc_data;
+
   /* MQTT or AITT handle */
   void *broker_h;
 } nns_edge_handle_s;
@@ -83,6 +195,8 @@ typedef enum
   _NNS_EDGE_CMD_TRANSFER_DATA,
   _NNS_EDGE_CMD_HOST_INFO,
   _NNS_EDGE_CMD_CAPABILITY,
+  _NNS_EDGE_CMD_TRANSFER_ENCODED,
+  _NNS_EDGE_CMD_EXPIRED,
   _NNS_EDGE_CMD_END
 } nns_edge_cmd_e;
 
@@ -98,10 +212,24 @@ typedef struct
 
   /* memory info */
   uint32_t num;
-  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT];
+  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT - 1];
+
+  /* The last slot of memory sizes, it is not used because the number of memories is less than the limit. */
+  uint32_t request_id; /**< identifier of the request, the response has same ID. 0 if not set. */
+  uint32_t deadline; /**< remaining time (milliseconds) of the request when it is sent, 0 if not set. */
   nns_size_t meta_size;
 } nns_edge_cmd_info_s;
 
+/* The request info should not change the size and layout of the command, to connect to the node of old version. */
+_Static_assert (offsetof (nns_edge_cmd_info_s, request_id) ==
+    offsetof (nns_edge_cmd_info_s, mem_size) +
+    sizeof (nns_size_t) * (NNS_EDGE_DATA_LIMIT - 1),
+    "The request info should be in the last slot of memory sizes.");
+_Static_assert (offsetof (nns_edge_cmd_info_s, meta_size) ==
+    offsetof (nns_edge_cmd_info_s, mem_size) +
+    sizeof (nns_size_t) * NNS_EDGE_DATA_LIMIT,
+    "The request info should not be larger than the slot of memory size.");
+
 /**
  * @brief Structure for edge command and buffers.
  */
@@ -110,8 +238,27 @@ typedef struct
   nns_edge_cmd_info_s info;
   void *mem[NNS_EDGE_DATA_LIMIT];
   void *meta;
+  nns_edge_pool_h pool; /**< pool to allocate memories when receiving the command, null to use malloc */
+  nns_edge_alloc_cb alloc_cb; /**< callback to allocate memories when receiving the command, null to use the pool */
+  void *alloc_data; /**< user data of the callback to allocate memories */
+  nns_edge_data_destroy_cb mem_destroy[NNS_EDGE_DATA_LIMIT]; /**< callback to release the memory allocated with alloc_cb */
+  bool mem_user[NNS_EDGE_DATA_LIMIT]; /**< true if the memory is allocated with alloc_cb */
 } nns_edge_cmd_s;
 
+/**
+ * @brief Structure for the memory info of encoded data. The first memory of the command is the array of this.
+ */
+typedef struct
+{
+  uint32_t codec_id; /**< identifier of the codec, 0 if the memory is not encoded */
+  uint16_t filter; /**< filter applied before encoding, see nns_edge_codec_filter_e */
+  uint16_t element_size; /**< byte size of the element to shuffle the raw data */
+  uint16_t precision; /**< precision of float32 values on the wire, see nns_edge_codec_precision_e */
+  uint16_t delta; /**< delta from the memory in previous frame, see nns_edge_codec_delta_e */
+  uint16_t reserved[2];
+  nns_size_t raw_size; /**< byte size of the memory before encoding (after converting the precision) */
+} nns_edge_codec_info_s;
+
 /**
  * @brief Data structure for connection data.
  */
@@ -127,6 +274,28 @@ typedef struct
   bool running;
   pthread_t msg_thread;
   int sockfd;
+  int64_t deadline; /**< monotonic time (microseconds) the blocking send and receive fail, 0 if not set */
+
+  /* allocator and pool of the edge handle, to allocate the metadata and the buffers to encode the data */
+  const nns_edge_allocator_s *allocator;
+  nns_edge_pool_h pool;
+
+  /* metadata synchronized with the connected node, only the delta is transferred */
+  bool meta_delta; /**< true if the connected node accepts the delta of metadata */
+  nns_edge_metadata_h meta;
+
+  /* codec negotiated with the connected node */
+  uint32_t codec_id; /**< identifier of the codec, 0 if the data is not encoded */
+  nns_size_t codec_threshold;
+  nns_edge_codec_filter_e codec_filter;
+  unsigned int codec_element_size;
+  nns_edge_codec_precision_e wire_precision; /**< precision of float32 values on the wire */
+  nns_edge_codec_stats_s *codec_stats;
+
+  /* memories of previous frame, referenced by the delta of next frame */
+  unsigned int delta_keyframe; /**< interval of keyframes, 0 if the delta is not sent */
+  nns_edge_codec_delta_s delta_sent;
+  nns_edge_codec_delta_s delta_received;
 } nns_edge_conn_s;
 
 /**
@@ -138,6 +307,13 @@ struct _nns_edge_conn_data_s
   nns_edge_conn_s *sink_conn;
   int64_t id;
   nns_edge_conn_data_s *next;
+
+  /* IDs of the requests received in query server, the response without ID is matched in order */
+  pthread_mutex_t lock;
+  uint32_t *requests;
+  unsigned int requests_head;
+  unsigned int requests_num;
+  unsigned int requests_len;
 };
 
 /**
@@ -150,6 +326,27 @@ typedef struct
   nns_edge_conn_s *conn;
 } nns_edge_thread_data_s;
 
+/**
+ * @brief Data structure for socket listener. Each listener accepts socket on the same port.
+ */
+typedef struct
+{
+  nns_edge_handle_s *eh;
+  unsigned int index;
+  int fd;
+  pthread_t thread;
+} nns_edge_listener_s;
+
+/**
+ * @brief Structure for the accepted socket. Handshake workers fill the connections and socket listener registers it.
+ */
+typedef struct
+{
+  int64_t client_id;
+  nns_edge_conn_s *conn; /**< accepted connection */
+  nns_edge_conn_s *sink_conn; /**< connection to the listener of query client */
+} nns_edge_handshake_s;
+
 /**
  * @brief Parse the message received from the MQTT broker and connect to the server directly.
  */
@@ -168,6 +365,22 @@ _set_socket_option (int fd)
     nns_edge_logw ("Failed to set TCP delay option.");
 }
 
+/**
+ * @brief Set timeout (milliseconds) of blocking send and receive. Timeout zero means the operation never times out.
+ */
+static void
+_set_socket_timeout (int fd, unsigned int timeout)
+{
+  struct timeval tv;
+
+  tv.tv_sec = timeout / 1000U;
+  tv.tv_usec = (timeout % 1000U) * 1000U;
+
+  if (setsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof (tv)) < 0 ||
+      setsockopt (fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof (tv)) < 0)
+    nns_edge_logw ("Failed to set socket timeout.");
+}
+
 /**
  * @brief Fill socket address struct from host name and port number.
  */
@@ -203,17 +416,70 @@ _fill_socket_addr (struct sockaddr_in *saddr, const char *host, const int port)
   return true;
 }
 
+/**
+ * @brief Get the remaining time (milliseconds) until the deadline. Returns 0 or less if the deadline is passed.
+ */
+static int64_t
+_get_remaining_time (int64_t deadline)
+{
+  int64_t remaining = deadline - nns_edge_get_monotonic_time ();
+
+  return (remaining > 0) ? (remaining + 999) / 1000 : 0;
+}
+
+/**
+ * @brief Wait until the socket is ready to send or receive, before the deadline of the connection.
+ */
+static bool
+_wait_socket (nns_edge_conn_s * conn, short events)
+{
+  struct pollfd poll_fd;
+  int64_t remaining;
+
+  if (conn->deadline <= 0)
+    return true;
+
+  remaining = _get_remaining_time (conn->deadline);
+  if (remaining <= 0) {
+    nns_edge_loge ("The deadline of the connection is passed.");
+    return false;
+  }
+
+  poll_fd.fd = conn->sockfd;
+  poll_fd.events = events;
+  poll_fd.revents = 0;
+
+  if (poll (&poll_fd, 1, (int) remaining) <= 0) {
+    nns_edge_loge ("Failed to wait for the socket before the deadline.");
+    return false;
+  }
+
+  return true;
+}
+
 /**
  * @brief Send data to connected socket.
+ * @note If the deadline of the connection is set, the socket is not blocked and the data should be sent before the deadline.
  */
 static bool
 _send_raw_data (nns_edge_conn_s * conn, void *data, nns_size_t size)
 {
   nns_size_t sent = 0;
   nns_ssize_t rret;
+  int flags = MSG_NOSIGNAL;
+
+  if (conn->deadline > 0)
+    flags |= MSG_DONTWAIT;
 
   while (sent < size) {
-    rret = send (conn->sockfd, (char *) data + sent, size - sent, MSG_NOSIGNAL);
+    if (!_wait_socket (conn, POLLOUT))
+      return false;
+
+    rret = send (conn->sockfd, (char *) data + sent, size - sent, flags);
+
+    if (rret < 0 && conn->deadline > 0 &&
+        (errno == EAGAIN || errno == EWOULDBLOCK))
+      continue;
 
     if (rret <= 0) {
       nns_edge_loge ("Failed to send raw data.");
@@ -228,15 +494,28 @@ _send_raw_data (nns_edge_conn_s * conn, void *data, nns_size_t size)
 
 /**
  * @brief Receive data from connected socket.
+ * @note If the deadline of the connection is set, the socket is not blocked and the data should be received before the deadline.
  */
 static bool
 _receive_raw_data (nns_edge_conn_s * conn, void *data, nns_size_t size)
 {
   nns_size_t received = 0;
   nns_ssize_t rret;
+  int flags = 0;
+
+  if (conn->deadline > 0)
+    flags |= MSG_DONTWAIT;
 
   while (received < size) {
-    rret = recv (conn->sockfd, (char *) data + received, size - received, 0);
+    if (!_wait_socket (conn, POLLIN))
+      return false;
+
+    rret = recv (conn->sockfd, (char *) data + received, size - received,
+        flags);
+
+    if (rret < 0 && conn->deadline > 0 &&
+        (errno == EAGAIN || errno == EWOULDBLOCK))
+      continue;
 
     if (rret <= 0) {
       nns_edge_loge ("Failed to receive raw data.");
@@ -297,6 +576,24 @@ _nns_edge_cmd_init (nns_edge_cmd_s * cmd, nns_edge_cmd_e c, int64_t cid)
   cmd->info.meta_size = 0;
 }
 
+/**
+ * @brief Release the memory in edge command. The memory not allocated with alloc_cb is returned to the pool.
+ */
+static void
+_nns_edge_cmd_free_mem (nns_edge_cmd_s * cmd, unsigned int index)
+{
+  if (cmd->mem_user[index]) {
+    if (cmd->mem[index] && cmd->mem_destroy[index])
+      cmd->mem_destroy[index] (cmd->mem[index]);
+  } else {
+    nns_edge_pool_free (cmd->pool, cmd->mem[index]);
+  }
+
+  cmd->mem[index] = NULL;
+  cmd->mem_destroy[index] = NULL;
+  cmd->mem_user[index] = false;
+}
+
 /**
  * @brief Clear allocated memory in edge command.
  */
@@ -311,11 +608,12 @@ _nns_edge_cmd_clear (nns_edge_cmd_s * cmd)
   nns_edge_handle_set_magic (&cmd->info, NNS_EDGE_MAGIC_DEAD);
 
   for (i = 0; i < cmd->info.num; i++) {
-    SAFE_FREE (cmd->mem[i]);
+    _nns_edge_cmd_free_mem (cmd, i);
     cmd->info.mem_size[i] = 0U;
   }
 
-  SAFE_FREE (cmd->meta);
+  nns_edge_free (cmd->meta);
+  cmd->meta = NULL;
 
   cmd->info.cmd = _NNS_EDGE_CMD_ERROR;
   cmd->info.version = 0;
@@ -437,7 +735,18 @@ _nns_edge_cmd_receive (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
   }
 
   for (n = 0; n < cmd->info.num; n++) {
-    cmd->mem[n] = nns_edge_malloc (cmd->info.mem_size[n]);
+    /* The encoded memories are decoded into the buffer allocated with the callback. */
+    if (cmd->alloc_cb && cmd->info.mem_size[n] > 0 &&
+        cmd->info.cmd != _NNS_EDGE_CMD_TRANSFER_ENCODED) {
+      cmd->mem_destroy[n] = NULL;
+      cmd->mem[n] = cmd->alloc_cb (n, cmd->info.mem_size[n],
+          &cmd->mem_destroy[n], cmd->alloc_data);
+      cmd->mem_user[n] = (cmd->mem[n] != NULL);
+    }
+
+    if (!cmd->mem[n])
+      cmd->mem[n] = nns_edge_pool_alloc (cmd->pool, cmd->info.mem_size[n]);
+
     if (!cmd->mem[n]) {
       nns_edge_loge ("Failed to allocate memory to receive data from socket.");
       ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -474,208 +783,1255 @@ error:
 }
 
 /**
- * @brief Internal function to send edge data.
+ * @brief Set the option in edge command. The options are serialized into the metadata of the command.
  */
 static int
-_nns_edge_transfer_data (nns_edge_conn_s * conn, nns_edge_data_h data_h,
-    int64_t client_id)
+_nns_edge_cmd_set_option (nns_edge_cmd_s * cmd, const char *key,
+    const char *value)
 {
-  nns_edge_cmd_s cmd;
-  unsigned int i;
+  nns_edge_metadata_h meta;
   int ret;
 
-  _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_TRANSFER_DATA, client_id);
-
-  nns_edge_data_get_count (data_h, &cmd.info.num);
-  for (i = 0; i < cmd.info.num; i++)
-    nns_edge_data_get (data_h, i, &cmd.mem[i], &cmd.info.mem_size[i]);
-
-  nns_edge_data_serialize_meta (data_h, &cmd.meta, &cmd.info.meta_size);
+  ret = nns_edge_metadata_create (&meta);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
 
-  ret = _nns_edge_cmd_send (conn, &cmd);
-  SAFE_FREE (cmd.meta);
+  if (cmd->info.meta_size > 0)
+    nns_edge_metadata_deserialize (meta, cmd->meta, cmd->info.meta_size);
 
-  if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_edge_loge ("Failed to send edge data to destination (%s:%d).",
-        conn->host, conn->port);
+  ret = nns_edge_metadata_set (meta, key, value);
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    nns_edge_free (cmd->meta);
+    cmd->meta = NULL;
+    cmd->info.meta_size = 0;
+    ret = nns_edge_metadata_serialize (meta, &cmd->meta, &cmd->info.meta_size);
   }
 
+  nns_edge_metadata_destroy (meta);
   return ret;
 }
 
 /**
- * @brief Close connection
+ * @brief Get the option from edge command. Caller should release returned value using free().
  */
-static bool
-_nns_edge_close_connection (nns_edge_conn_s * conn)
+static int
+_nns_edge_cmd_get_option (nns_edge_cmd_s * cmd, const char *key, char **value)
 {
-  if (!conn)
-    return false;
-
-  /* Stop and clear the message thread. */
-  if (conn->msg_thread) {
-    conn->running = false;
-    pthread_join (conn->msg_thread, NULL);
-    conn->msg_thread = 0;
-  }
+  nns_edge_metadata_h meta;
+  int ret;
 
-  if (conn->sockfd >= 0) {
-    nns_edge_cmd_s cmd;
+  if (cmd->info.meta_size == 0)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-    /* Send error before closing the socket. */
-    nns_edge_logd ("Send error cmd to close connection.");
-    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, 0);
-    _nns_edge_cmd_send (conn, &cmd);
+  ret = nns_edge_metadata_create (&meta);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
 
-    if (close (conn->sockfd) < 0)
-      nns_edge_logw ("Failed to close socket.");
-    conn->sockfd = -1;
-  }
+  ret = nns_edge_metadata_deserialize (meta, cmd->meta, cmd->info.meta_size);
+  if (ret == NNS_EDGE_ERROR_NONE)
+    ret = nns_edge_metadata_get (meta, key, value);
 
-  SAFE_FREE (conn->host);
-  SAFE_FREE (conn);
-  return true;
+  nns_edge_metadata_destroy (meta);
+  return ret;
 }
 
 /**
- * @brief Release connection data and its resources.
+ * @brief Get the hash string of capability. Caller should release returned value using free().
  */
-static void
-_nns_edge_release_connection_data (nns_edge_conn_data_s * cdata)
+static char *
+_nns_edge_get_caps_hash (const char *caps)
 {
-  if (cdata) {
-    _nns_edge_close_connection (cdata->src_conn);
-    _nns_edge_close_connection (cdata->sink_conn);
-    SAFE_FREE (cdata);
-  }
+  return nns_edge_strdup_printf ("%016llx",
+      (unsigned long long) nns_edge_hash_string (caps));
 }
 
 /**
- * @brief Get nnstreamer-edge connection data.
- * @note This function should be called with handle lock.
+ * @brief Enable transferring the delta of metadata if the connected node accepts it.
  */
-static nns_edge_conn_data_s *
-_nns_edge_get_connection (nns_edge_handle_s * eh, int64_t client_id)
+static void
+_nns_edge_conn_set_meta_delta (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd)
 {
-  nns_edge_conn_data_s *cdata;
-
-  cdata = (nns_edge_conn_data_s *) eh->connections;
+  char *value = NULL;
 
-  while (cdata) {
-    if (cdata->id == client_id)
-      return cdata;
+  if (_nns_edge_cmd_get_option (cmd, "meta-delta", &value) !=
+      NNS_EDGE_ERROR_NONE)
+    return;
 
-    cdata = cdata->next;
-  }
+  if (conn->meta || nns_edge_metadata_create_with_allocator (&conn->meta,
+          conn->allocator) == NNS_EDGE_ERROR_NONE)
+    conn->meta_delta = true;
 
-  return NULL;
+  SAFE_FREE (value);
 }
 
 /**
- * @brief Get nnstreamer-edge connection data.
- * @note This function should be called with handle lock.
+ * @brief Enable encoding the data if the connected node supports the codec, precision and delta.
  */
-static nns_edge_conn_data_s *
-_nns_edge_add_connection (nns_edge_handle_s * eh, int64_t client_id)
+static void
+_nns_edge_conn_set_codec (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd)
 {
-  nns_edge_conn_data_s *cdata;
+  char *codecs = NULL, *precisions = NULL, *delta = NULL;
+  const char *precision;
+
+  conn->codec_id = 0U;
+  conn->wire_precision = NNS_EDGE_CODEC_PRECISION_NONE;
+  conn->codec_stats = &eh->codec_stats;
+  conn->delta_keyframe = 0U;
+
+  /* Next frame is a keyframe. */
+  nns_edge_codec_delta_clear (&conn->delta_sent);
+
+  if (eh->codec && _nns_edge_cmd_get_option (cmd, "codecs", &codecs) ==
+      NNS_EDGE_ERROR_NONE) {
+    if (nns_edge_codec_is_listed (codecs, eh->codec)) {
+      conn->codec_id = nns_edge_codec_get_id (eh->codec);
+      conn->codec_threshold = eh->codec_threshold;
+      conn->codec_filter = eh->codec_filter;
+      conn->codec_element_size = eh->codec_element_size;
+    } else {
+      nns_edge_logw ("The connected node does not support the codec '%s'.",
+          eh->codec);
+    }
+  }
 
-  cdata = _nns_edge_get_connection (eh, client_id);
+  if (eh->wire_precision != NNS_EDGE_CODEC_PRECISION_NONE &&
+      _nns_edge_cmd_get_option (cmd, "precisions", &precisions) ==
+      NNS_EDGE_ERROR_NONE) {
+    precision = nns_edge_codec_get_precision_name (eh->wire_precision);
 
-  if (NULL == cdata) {
-    cdata = (nns_edge_conn_data_s *) calloc (1, sizeof (nns_edge_conn_data_s));
-    if (NULL == cdata) {
-      nns_edge_loge ("Failed to allocate memory for connection data.");
-      return NULL;
+    if (nns_edge_codec_is_listed (precisions, precision)) {
+      conn->wire_precision = eh->wire_precision;
+    } else {
+      nns_edge_logw ("The connected node does not support the precision '%s'.",
+          precision);
     }
+  }
 
-    /* prepend connection data */
-    cdata->id = client_id;
-    cdata->next = eh->connections;
-    eh->connections = cdata;
+  /* The delta is sent only with the codec, XOR delta itself is not smaller than the raw data. */
+  if (eh->delta && conn->codec_id != 0U) {
+    if (_nns_edge_cmd_get_option (cmd, "delta", &delta) ==
+        NNS_EDGE_ERROR_NONE && 0 == strcasecmp (delta, "true")) {
+      conn->delta_keyframe = eh->delta_keyframe;
+    } else {
+      nns_edge_logw ("The connected node does not support the delta of data.");
+    }
   }
 
-  return cdata;
+  SAFE_FREE (codecs);
+  SAFE_FREE (precisions);
+  SAFE_FREE (delta);
 }
 
 /**
- * @brief Remove nnstreamer-edge connection data.
- * @note This function should be called with handle lock.
+ * @brief Set the names of supported codecs and precisions, and the delta of data in edge command.
  */
 static void
-_nns_edge_remove_connection (nns_edge_handle_s * eh, int64_t client_id)
+_nns_edge_cmd_set_codec_options (nns_edge_cmd_s * cmd)
 {
-  nns_edge_conn_data_s *cdata, *prev;
+  char *codecs = nns_edge_codec_get_names ();
 
-  cdata = (nns_edge_conn_data_s *) eh->connections;
-  prev = NULL;
+  if (codecs)
+    _nns_edge_cmd_set_option (cmd, "codecs", codecs);
 
-  while (cdata) {
-    if (cdata->id == client_id) {
-      if (prev)
-        prev->next = cdata->next;
-      else
-        eh->connections = cdata->next;
+  _nns_edge_cmd_set_option (cmd, "precisions", NNS_EDGE_CODEC_PRECISIONS);
+  _nns_edge_cmd_set_option (cmd, "delta", "true");
 
-      _nns_edge_release_connection_data (cdata);
-      return;
-    }
-    prev = cdata;
-    cdata = cdata->next;
-  }
+  SAFE_FREE (codecs);
 }
 
 /**
- * @brief Remove all connection data.
- * @note This function should be called with handle lock.
+ * @brief Encode the memories with the codec, precision and delta of connection.
+ * @param[in] element_size The byte size of the element to shuffle the raw data.
+ * @param[in] float_mask The bit mask of the memories having float32 values, to be converted to the precision on the wire. UINT64_MAX for all memories.
+ * @note The first memory of the command is replaced with the array of codec info, if any memory is encoded.
  */
-static void
-_nns_edge_remove_all_connection (nns_edge_handle_s * eh)
+static int
+_nns_edge_cmd_encode (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd,
+    unsigned int element_size, uint64_t float_mask)
 {
-  nns_edge_conn_data_s *cdata, *next;
+  nns_edge_codec_s codec;
+  nns_edge_codec_info_s *info;
+  nns_edge_codec_delta_s *delta = &conn->delta_sent;
+  nns_size_t bound, len, size, raw_size = 0U, encoded_size = 0U;
+  unsigned int i, num, t;
+  bool encoded = false, has_codec, shuffle;
+  void *buffer, *converted, *shuffled, *xored;
+  int ret;
 
-  cdata = (nns_edge_conn_data_s *) eh->connections;
-  eh->connections = NULL;
+  num = cmd->info.num;
+  if (num == 0U || num + 1U >= NNS_EDGE_DATA_LIMIT)
+    return NNS_EDGE_ERROR_NONE;
 
-  while (cdata) {
-    next = cdata->next;
+  has_codec = (conn->codec_id != 0U &&
+      nns_edge_codec_find_by_id (conn->codec_id, &codec) ==
+      NNS_EDGE_ERROR_NONE);
+  if (conn->codec_id != 0U && !has_codec)
+    nns_edge_logw ("The codec is unregistered, send the data without encoding.");
 
-    _nns_edge_release_connection_data (cdata);
+  if (conn->wire_precision == NNS_EDGE_CODEC_PRECISION_NONE)
+    float_mask = 0U;
 
-    cdata = next;
+  if (!has_codec && float_mask == 0U)
+    return NNS_EDGE_ERROR_NONE;
+
+  info = (nns_edge_codec_info_s *) nns_edge_pool_alloc (cmd->pool,
+      sizeof (nns_edge_codec_info_s) * num);
+  if (!info) {
+    nns_edge_loge ("Failed to allocate memory for codec info.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
   }
-}
 
-/**
- * @brief Connect to requested socket.
- */
-static bool
-_nns_edge_connect_socket (nns_edge_conn_s * conn)
-{
-  struct sockaddr_in saddr = { 0 };
-  socklen_t saddr_len = sizeof (struct sockaddr_in);
+  memset (info, 0, sizeof (nns_edge_codec_info_s) * num);
+
+  for (i = 0; i < num; i++) {
+    size = cmd->info.mem_size[i];
+    raw_size += size;
+    t = element_size;
+
+    /* Convert float32 values to the precision on the wire. */
+    if ((float_mask == UINT64_MAX || (i < 64U && (float_mask & (1ULL << i))))
+        && size > 0U && (size % 4U) == 0U) {
+      converted = nns_edge_pool_alloc (cmd->pool, size / 2U);
+
+      if (converted) {
+        nns_edge_codec_convert_precision (cmd->mem[i], converted, size / 4U,
+            conn->wire_precision);
+
+        size /= 2U;
+        _nns_edge_cmd_free_mem (cmd, i);
+        cmd->mem[i] = converted;
+        cmd->info.mem_size[i] = size;
+        info[i].precision = (uint16_t) conn->wire_precision;
+        t = 2U;
+        encoded = true;
+      }
+    }
 
-  if (!_fill_socket_addr (&saddr, conn->host, conn->port)) {
-    nns_edge_loge ("Failed to connect socket, invalid host %s.", conn->host);
-    return false;
-  }
+    info[i].raw_size = size;
 
-  conn->sockfd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
-  if (conn->sockfd < 0) {
-    nns_edge_loge ("Failed to create new socket.");
-    return false;
-  }
+    if (!has_codec || size == 0U || size < conn->codec_threshold)
+      continue;
 
-  _set_socket_option (conn->sockfd);
+    /* Send the XOR delta from the memory of previous frame, the unchanged bytes are compressed well. */
+    if (conn->delta_keyframe > 0U) {
+      xored = NULL;
 
-  if (connect (conn->sockfd, (struct sockaddr *) &saddr, saddr_len) < 0) {
-    nns_edge_loge ("Failed to connect host %s:%d.", conn->host, conn->port);
-    return false;
-  }
+      if (delta->frames > 0U && delta->ref[i] && delta->size[i] == size) {
+        xored = nns_edge_pool_alloc (cmd->pool, size);
+        if (xored)
+          nns_edge_codec_xor (cmd->mem[i], delta->ref[i], xored, size);
+      }
+
+      if (nns_edge_codec_delta_set (delta, i, cmd->mem[i], size) ==
+          NNS_EDGE_ERROR_NONE) {
+        if (xored) {
+          _nns_edge_cmd_free_mem (cmd, i);
+          cmd->mem[i] = xored;
+          info[i].delta = NNS_EDGE_CODEC_DELTA_XOR;
+        } else {
+          info[i].delta = NNS_EDGE_CODEC_DELTA_KEY;
+        }
+
+        encoded = true;
+      } else {
+        nns_edge_pool_free (cmd->pool, xored);
+      }
+    }
+
+    bound = codec.bound (size, codec.user_data);
+    if (bound == 0U)
+      continue;
+
+    buffer = nns_edge_pool_alloc (cmd->pool, bound);
+    if (!buffer)
+      continue;
+
+    /* Group the bytes of same significance in the elements, it is better to compress the tensors. */
+    shuffle = (conn->codec_filter == NNS_EDGE_CODEC_FILTER_SHUFFLE && t > 1U);
+    shuffled = NULL;
+
+    if (shuffle) {
+      shuffled = nns_edge_pool_alloc (cmd->pool, size);
+      if (!shuffled) {
+        nns_edge_pool_free (cmd->pool, buffer);
+        continue;
+      }
+
+      nns_edge_codec_shuffle (cmd->mem[i], shuffled, size, t);
+    }
+
+    len = bound;
+    ret = codec.encode (shuffled ? shuffled : cmd->mem[i], size, buffer, &len,
+        codec.user_data);
+    nns_edge_pool_free (cmd->pool, shuffled);
+
+    if (ret != NNS_EDGE_ERROR_NONE || len == 0U || len >= size) {
+      /* Send the raw memory if the codec cannot reduce the size. */
+      nns_edge_pool_free (cmd->pool, buffer);
+      continue;
+    }
+
+    if (shuffle) {
+      info[i].filter = NNS_EDGE_CODEC_FILTER_SHUFFLE;
+      info[i].element_size = (uint16_t) t;
+    }
+
+    /* Release the converted memory. */
+    _nns_edge_cmd_free_mem (cmd, i);
+
+    info[i].codec_id = conn->codec_id;
+    cmd->mem[i] = buffer;
+    cmd->info.mem_size[i] = len;
+    encoded = true;
+  }
+
+  if (conn->delta_keyframe > 0U)
+    delta->frames = (delta->frames + 1U) % conn->delta_keyframe;
+
+  if (!encoded) {
+    nns_edge_pool_free (cmd->pool, info);
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  for (i = num; i > 0; i--) {
+    cmd->mem[i] = cmd->mem[i - 1];
+    cmd->info.mem_size[i] = cmd->info.mem_size[i - 1];
+    cmd->mem_destroy[i] = cmd->mem_destroy[i - 1];
+    cmd->mem_user[i] = cmd->mem_user[i - 1];
+    encoded_size += cmd->info.mem_size[i];
+  }
+
+  cmd->mem[0] = info;
+  cmd->info.mem_size[0] = sizeof (nns_edge_codec_info_s) * num;
+  cmd->mem_destroy[0] = NULL;
+  cmd->mem_user[0] = false;
+  cmd->info.num = num + 1U;
+  cmd->info.cmd = _NNS_EDGE_CMD_TRANSFER_ENCODED;
+
+  nns_edge_codec_stats_add (conn->codec_stats, true, raw_size, encoded_size);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Check the codec info of received memory.
+ */
+static bool
+_nns_edge_codec_info_is_valid (nns_edge_codec_info_s * info,
+    nns_size_t size, nns_edge_codec_s * codec)
+{
+  if (info->precision >= NNS_EDGE_CODEC_PRECISION_MAX ||
+      info->filter >= NNS_EDGE_CODEC_FILTER_MAX ||
+      info->delta >= NNS_EDGE_CODEC_DELTA_MAX)
+    return false;
+
+  if (info->precision != NNS_EDGE_CODEC_PRECISION_NONE &&
+      ((info->raw_size % 2U) != 0U || info->raw_size > ((nns_size_t) -1) / 2U))
+    return false;
+
+  if (info->codec_id == 0U)
+    return (info->raw_size == size &&
+        info->filter == NNS_EDGE_CODEC_FILTER_NONE);
+
+  if (info->filter == NNS_EDGE_CODEC_FILTER_SHUFFLE &&
+      (info->element_size <= 1U ||
+          info->element_size > NNS_EDGE_CODEC_ELEMENT_SIZE_MAX))
+    return false;
+
+  return (info->raw_size > 0U &&
+      nns_edge_codec_find_by_id (info->codec_id, codec) ==
+      NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Decode the memories of received command, and change the command to transfer the raw data.
+ * @param[out] precision The precision of the memories which are not restored to float32.
+ * @note Caller should clear the command when failed to decode.
+ */
+static int
+_nns_edge_cmd_decode (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    nns_edge_cmd_s * cmd, nns_edge_codec_precision_e * precision)
+{
+  nns_edge_codec_s codec;
+  nns_edge_codec_info_s *info;
+  nns_edge_codec_delta_s *delta = &conn->delta_received;
+  void *mem[NNS_EDGE_DATA_LIMIT] = { NULL };
+  nns_size_t mem_size[NNS_EDGE_DATA_LIMIT] = { 0U };
+  nns_edge_data_destroy_cb destroy[NNS_EDGE_DATA_LIMIT] = { NULL };
+  bool user[NNS_EDGE_DATA_LIMIT] = { false };
+  nns_size_t raw_size = 0U, encoded_size = 0U;
+  unsigned int i, num;
+  bool restore, post;
+  void *cur, *tmp[2];
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  *precision = NNS_EDGE_CODEC_PRECISION_NONE;
+
+  if (cmd->info.num < 2U || cmd->info.mem_size[0] !=
+      sizeof (nns_edge_codec_info_s) * (cmd->info.num - 1U)) {
+    nns_edge_loge ("Invalid command, failed to get the info of encoded data.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  info = (nns_edge_codec_info_s *) cmd->mem[0];
+  num = cmd->info.num - 1U;
+
+  for (i = 0; i < num; i++) {
+    if (!_nns_edge_codec_info_is_valid (&info[i], cmd->info.mem_size[i + 1],
+            &codec)) {
+      nns_edge_loge ("Failed to decode the data, unknown codec or invalid info.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      goto error;
+    }
+
+    encoded_size += cmd->info.mem_size[i + 1];
+    raw_size += (info[i].precision != NNS_EDGE_CODEC_PRECISION_NONE) ?
+        info[i].raw_size * 2U : info[i].raw_size;
+
+    restore = false;
+    if (info[i].precision != NNS_EDGE_CODEC_PRECISION_NONE) {
+      restore = eh->restore_precision;
+      if (!restore)
+        *precision = (nns_edge_codec_precision_e) info[i].precision;
+    }
+
+    if (info[i].delta == NNS_EDGE_CODEC_DELTA_XOR &&
+        (!delta->ref[i] || delta->size[i] != info[i].raw_size)) {
+      nns_edge_loge ("Failed to decode the data, no memory of previous frame.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+      goto error;
+    }
+
+    if (info[i].codec_id == 0U && !restore &&
+        info[i].delta == NNS_EDGE_CODEC_DELTA_NONE)
+      continue;
+
+    if (info[i].codec_id == 0U && !restore &&
+        info[i].delta == NNS_EDGE_CODEC_DELTA_KEY) {
+      ret = nns_edge_codec_delta_set (delta, i, cmd->mem[i + 1],
+          info[i].raw_size);
+      if (ret != NNS_EDGE_ERROR_NONE)
+        goto error;
+      continue;
+    }
+
+    mem_size[i] = restore ? info[i].raw_size * 2U : info[i].raw_size;
+
+    if (cmd->alloc_cb) {
+      mem[i] = cmd->alloc_cb (i, mem_size[i], &destroy[i], cmd->alloc_data);
+      user[i] = (mem[i] != NULL);
+    }
+
+    if (!mem[i])
+      mem[i] = nns_edge_pool_alloc (cmd->pool, mem_size[i]);
+
+    if (!mem[i]) {
+      nns_edge_loge ("Failed to allocate memory to decode the data.");
+      ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+      goto error;
+    }
+
+    /**
+     * Decode, unshuffle, apply the delta and restore float32 values. The last stage writes into the memory.
+     * The delta is applied to the memory of previous frame, then it has the memory on the wire.
+     */
+    post = (restore || info[i].delta == NNS_EDGE_CODEC_DELTA_XOR);
+    cur = cmd->mem[i + 1];
+    tmp[0] = tmp[1] = NULL;
+
+    if (info[i].codec_id != 0U) {
+      if (info[i].filter == NNS_EDGE_CODEC_FILTER_SHUFFLE || post)
+        cur = tmp[0] = nns_edge_pool_alloc (cmd->pool, info[i].raw_size);
+      else
+        cur = mem[i];
+
+      ret = cur ? codec.decode (cmd->mem[i + 1], cmd->info.mem_size[i + 1],
+          cur, info[i].raw_size, codec.user_data) :
+          NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+      if (ret == NNS_EDGE_ERROR_NONE &&
+          info[i].filter == NNS_EDGE_CODEC_FILTER_SHUFFLE) {
+        if (post)
+          tmp[1] = nns_edge_pool_alloc (cmd->pool, info[i].raw_size);
+
+        if (!post || tmp[1]) {
+          nns_edge_codec_unshuffle (cur, post ? tmp[1] : mem[i],
+              info[i].raw_size, info[i].element_size);
+          cur = post ? tmp[1] : mem[i];
+        } else {
+          ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+        }
+      }
+    }
+
+    if (ret == NNS_EDGE_ERROR_NONE &&
+        info[i].delta == NNS_EDGE_CODEC_DELTA_XOR) {
+      nns_edge_codec_xor (cur, delta->ref[i], delta->ref[i], info[i].raw_size);
+      cur = delta->ref[i];
+
+      if (!restore)
+        memcpy (mem[i], cur, info[i].raw_size);
+    }
+
+    if (ret == NNS_EDGE_ERROR_NONE &&
+        info[i].delta == NNS_EDGE_CODEC_DELTA_KEY)
+      ret = nns_edge_codec_delta_set (delta, i, cur, info[i].raw_size);
+
+    if (ret == NNS_EDGE_ERROR_NONE && restore) {
+      nns_edge_codec_restore_precision (cur, mem[i], info[i].raw_size / 2U,
+          (nns_edge_codec_precision_e) info[i].precision);
+    }
+
+    nns_edge_pool_free (cmd->pool, tmp[0]);
+    nns_edge_pool_free (cmd->pool, tmp[1]);
+
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to decode the data with codec '%s'.",
+          info[i].codec_id ? codec.name : "none");
+      i++;
+      goto error;
+    }
+  }
+
+  /* Replace the encoded memories with decoded ones. */
+  for (i = 0; i < num; i++) {
+    if (mem[i]) {
+      nns_edge_pool_free (cmd->pool, cmd->mem[i + 1]);
+      cmd->mem[i + 1] = mem[i];
+      cmd->mem_destroy[i + 1] = destroy[i];
+      cmd->mem_user[i + 1] = user[i];
+      cmd->info.mem_size[i + 1] = mem_size[i];
+    }
+  }
+
+  nns_edge_pool_free (cmd->pool, cmd->mem[0]);
+
+  for (i = 0; i < num; i++) {
+    cmd->mem[i] = cmd->mem[i + 1];
+    cmd->mem_destroy[i] = cmd->mem_destroy[i + 1];
+    cmd->mem_user[i] = cmd->mem_user[i + 1];
+    cmd->info.mem_size[i] = cmd->info.mem_size[i + 1];
+  }
+
+  cmd->mem[num] = NULL;
+  cmd->mem_destroy[num] = NULL;
+  cmd->mem_user[num] = false;
+  cmd->info.mem_size[num] = 0U;
+  cmd->info.num = num;
+  cmd->info.cmd = _NNS_EDGE_CMD_TRANSFER_DATA;
+
+  nns_edge_codec_stats_add (&eh->codec_stats, false, raw_size, encoded_size);
+  return NNS_EDGE_ERROR_NONE;
+
+error:
+  while (i > 0) {
+    i--;
+    if (!mem[i])
+      continue;
+
+    if (user[i]) {
+      if (destroy[i])
+        destroy[i] (mem[i]);
+    } else {
+      nns_edge_pool_free (cmd->pool, mem[i]);
+    }
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Get the deadline (monotonic time in microseconds) of the request, 0 if not set.
+ */
+static int64_t
+_nns_edge_get_deadline (nns_edge_data_h data_h)
+{
+  int64_t deadline = 0;
+
+  if (nns_edge_data_get_info_int64 (data_h, "deadline", &deadline) !=
+      NNS_EDGE_ERROR_NONE || deadline < 0)
+    deadline = 0;
+
+  return deadline;
+}
+
+/**
+ * @brief Check the deadline of the request is passed.
+ */
+static bool
+_nns_edge_is_expired (nns_edge_data_h data_h)
+{
+  int64_t deadline = _nns_edge_get_deadline (data_h);
+
+  return (deadline > 0 && deadline <= nns_edge_get_monotonic_time ());
+}
+
+/**
+ * @brief Get the ID of the request, 0 if not set.
+ */
+static uint32_t
+_nns_edge_get_request_id (nns_edge_data_h data_h)
+{
+  int64_t request_id = 0;
+
+  if (nns_edge_data_get_info_int64 (data_h, "request_id", &request_id) !=
+      NNS_EDGE_ERROR_NONE || request_id <= 0 || request_id > UINT32_MAX)
+    request_id = 0;
+
+  return (uint32_t) request_id;
+}
+
+/**
+ * @brief Internal function to send edge data.
+ * @param[in] request_id The ID of the request of query client, or the response of query server. 0 if not set.
+ * @param[in] from_server True if the data is sent from query server or publisher. The deadline of the request is not forwarded with the response.
+ */
+static int
+_nns_edge_transfer_data (nns_edge_conn_s * conn, nns_edge_data_h data_h,
+    int64_t client_id, uint32_t request_id, bool from_server)
+{
+  nns_edge_cmd_s cmd;
+  nns_edge_metadata_h meta = NULL;
+  int64_t deadline, expired;
+  unsigned int i;
+  int ret;
+
+  _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_TRANSFER_DATA, client_id);
+  cmd.info.request_id = request_id;
+
+  /* The request is expired in query server, notify it without the data. */
+  if (nns_edge_data_get_info_int64 (data_h, "expired", &expired) ==
+      NNS_EDGE_ERROR_NONE && expired) {
+    cmd.info.cmd = _NNS_EDGE_CMD_EXPIRED;
+    ret = _nns_edge_cmd_send (conn, &cmd);
+    goto done;
+  }
+
+  /* The clocks of the nodes are not synchronized, send the remaining time. */
+  deadline = from_server ? 0 : _nns_edge_get_deadline (data_h);
+  if (deadline > 0) {
+    deadline = (deadline - nns_edge_get_monotonic_time () + 999) / 1000;
+    if (deadline < 1)
+      deadline = 1;
+    else if (deadline > UINT32_MAX)
+      deadline = UINT32_MAX;
+
+    cmd.info.deadline = (uint32_t) deadline;
+  }
+
+  nns_edge_data_get_count (data_h, &cmd.info.num);
+  if (cmd.info.num >= NNS_EDGE_DATA_LIMIT) {
+    nns_edge_loge ("Invalid data, the max memories for data transfer is %d.",
+        NNS_EDGE_DATA_LIMIT - 1);
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    cmd.info.num = 0U;
+    goto done;
+  }
+
+  /* The memories of the data are not owned by the command, the encoded memories are allocated from the pool. */
+  cmd.pool = conn->pool;
+  for (i = 0; i < cmd.info.num; i++) {
+    nns_edge_data_get (data_h, i, &cmd.mem[i], &cmd.info.mem_size[i]);
+    cmd.mem_user[i] = true;
+  }
+
+  if (conn->meta_delta || from_server) {
+    ret = nns_edge_metadata_create_with_allocator (&meta, conn->allocator);
+    if (ret == NNS_EDGE_ERROR_NONE)
+      ret = nns_edge_data_get_meta (data_h, meta);
+
+    /* The deadline of the request is in the clock of this node, the application may respond with the request. */
+    if (ret == NNS_EDGE_ERROR_NONE && from_server)
+      ret = nns_edge_metadata_remove (meta, "deadline");
+
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      if (conn->meta_delta) {
+        /* Send the keys added, changed or removed since the previous data. */
+        ret = nns_edge_metadata_serialize_delta (conn->meta, meta, &cmd.meta,
+            &cmd.info.meta_size);
+      } else {
+        ret = nns_edge_metadata_serialize (meta, &cmd.meta,
+            &cmd.info.meta_size);
+      }
+    }
+
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to serialize the metadata.");
+      goto done;
+    }
+  } else {
+    nns_edge_data_serialize_meta (data_h, &cmd.meta, &cmd.info.meta_size);
+  }
+
+  if (conn->codec_id != 0U ||
+      conn->wire_precision != NNS_EDGE_CODEC_PRECISION_NONE) {
+    int64_t element_size = conn->codec_element_size;
+    int64_t float_mask = 0;
+
+    /* The data may have the element size of its tensors. */
+    if (nns_edge_data_get_info_int64 (data_h, "element_size",
+            &element_size) == NNS_EDGE_ERROR_NONE &&
+        (element_size < 1 || element_size > NNS_EDGE_CODEC_ELEMENT_SIZE_MAX))
+      element_size = conn->codec_element_size;
+
+    /* The memories having float32 values should be marked, other memories are sent as they are. */
+    nns_edge_data_get_info_int64 (data_h, "float32_mask", &float_mask);
+
+    ret = _nns_edge_cmd_encode (conn, &cmd, (unsigned int) element_size,
+        (uint64_t) float_mask);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      goto done;
+  }
+
+  ret = _nns_edge_cmd_send (conn, &cmd);
+
+  /* The connected node has same metadata now. */
+  if (ret == NNS_EDGE_ERROR_NONE && conn->meta_delta)
+    nns_edge_metadata_copy (conn->meta, meta);
+
+  /* The connected node may not have the memories of this frame, next frame should be a keyframe. */
+  if (ret != NNS_EDGE_ERROR_NONE)
+    conn->delta_sent.frames = 0U;
+
+done:
+  /* Release the encoded memories. */
+  _nns_edge_cmd_clear (&cmd);
+  if (meta)
+    nns_edge_metadata_destroy (meta);
+
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to send edge data to destination (%s:%d).",
+        conn->host, conn->port);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Close connection
+ */
+static bool
+_nns_edge_close_connection (nns_edge_conn_s * conn)
+{
+  if (!conn)
+    return false;
+
+  /* Stop and clear the message thread. */
+  if (conn->msg_thread) {
+    conn->running = false;
+    pthread_join (conn->msg_thread, NULL);
+    conn->msg_thread = 0;
+  }
+
+  if (conn->sockfd >= 0) {
+    nns_edge_cmd_s cmd;
+
+    /* Send error before closing the socket. */
+    nns_edge_logd ("Send error cmd to close connection.");
+    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, 0);
+    _nns_edge_cmd_send (conn, &cmd);
+
+    if (close (conn->sockfd) < 0)
+      nns_edge_logw ("Failed to close socket.");
+    conn->sockfd = -1;
+  }
+
+  if (conn->meta)
+    nns_edge_metadata_destroy (conn->meta);
+
+  nns_edge_codec_delta_clear (&conn->delta_sent);
+  nns_edge_codec_delta_clear (&conn->delta_received);
+
+  SAFE_FREE (conn->host);
+  SAFE_EDGE_FREE (conn);
+  return true;
+}
+
+/**
+ * @brief Release connection data and its resources.
+ */
+static void
+_nns_edge_release_connection_data (nns_edge_conn_data_s * cdata)
+{
+  if (cdata) {
+    _nns_edge_close_connection (cdata->src_conn);
+    _nns_edge_close_connection (cdata->sink_conn);
+    nns_edge_lock_destroy (cdata);
+    SAFE_EDGE_FREE (cdata->requests);
+    SAFE_EDGE_FREE (cdata);
+  }
+}
+
+/**
+ * @brief Get nnstreamer-edge connection data.
+ * @note This function should be called with handle lock.
+ */
+static nns_edge_conn_data_s *
+_nns_edge_get_connection (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_conn_data_s *cdata;
+
+  cdata = (nns_edge_conn_data_s *) eh->connections;
+
+  while (cdata) {
+    if (cdata->id == client_id)
+      return cdata;
+
+    cdata = cdata->next;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Get nnstreamer-edge connection data.
+ * @note This function should be called with handle lock.
+ */
+static nns_edge_conn_data_s *
+_nns_edge_add_connection (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_conn_data_s *cdata;
+
+  cdata = _nns_edge_get_connection (eh, client_id);
+
+  if (NULL == cdata) {
+    cdata = (nns_edge_conn_data_s *) nns_edge_calloc (1,
+        sizeof (nns_edge_conn_data_s));
+    if (NULL == cdata) {
+      nns_edge_loge ("Failed to allocate memory for connection data.");
+      return NULL;
+    }
+
+    nns_edge_lock_init (cdata);
+
+    /* prepend connection data */
+    cdata->id = client_id;
+    cdata->next = eh->connections;
+    eh->connections = cdata;
+  }
+
+  return cdata;
+}
+
+/**
+ * @brief Keep the ID of the request received in query server, to echo it in the response.
+ * @note The oldest ID is dropped if too many requests are not responded.
+ */
+static void
+_nns_edge_push_pending_request (nns_edge_conn_data_s * cdata,
+    uint32_t request_id)
+{
+  uint32_t *requests;
+  unsigned int i, len;
+
+  if (request_id == 0U)
+    return;
+
+  nns_edge_lock (cdata);
+
+  if (cdata->requests_num >= NNS_EDGE_REQUEST_MAX) {
+    nns_edge_logw ("Too many requests are not responded, drop the oldest one.");
+    cdata->requests_head = (cdata->requests_head + 1U) % cdata->requests_len;
+    cdata->requests_num--;
+  } else if (cdata->requests_num >= cdata->requests_len) {
+    len = (cdata->requests_len > 0U) ? cdata->requests_len * 2U : 16U;
+    if (len > NNS_EDGE_REQUEST_MAX)
+      len = NNS_EDGE_REQUEST_MAX;
+
+    requests = (uint32_t *) nns_edge_calloc (len, sizeof (uint32_t));
+    if (!requests) {
+      nns_edge_loge ("Failed to allocate memory for the pending requests.");
+      nns_edge_unlock (cdata);
+      return;
+    }
+
+    /* Unwrap the ring buffer. */
+    for (i = 0; i < cdata->requests_num; i++) {
+      requests[i] = cdata->requests[(cdata->requests_head + i) %
+          cdata->requests_len];
+    }
+
+    SAFE_EDGE_FREE (cdata->requests);
+    cdata->requests = requests;
+    cdata->requests_head = 0U;
+    cdata->requests_len = len;
+  }
+
+  cdata->requests[(cdata->requests_head + cdata->requests_num) %
+      cdata->requests_len] = request_id;
+  cdata->requests_num++;
+
+  nns_edge_unlock (cdata);
+}
+
+/**
+ * @brief Remove the ID of the request responded in query server.
+ * @param[in] request_id The ID in the response. If 0, the oldest request is responded.
+ * @return The ID of the request responded, 0 if there is no pending request.
+ */
+static uint32_t
+_nns_edge_pop_pending_request (nns_edge_conn_data_s * cdata,
+    uint32_t request_id)
+{
+  unsigned int i, cur, next;
+
+  nns_edge_lock (cdata);
+
+  if (cdata->requests_num == 0U)
+    goto done;
+
+  if (request_id == 0U) {
+    request_id = cdata->requests[cdata->requests_head];
+    cdata->requests_head = (cdata->requests_head + 1U) % cdata->requests_len;
+    cdata->requests_num--;
+    goto done;
+  }
+
+  for (i = 0; i < cdata->requests_num; i++) {
+    cur = (cdata->requests_head + i) % cdata->requests_len;
+    if (cdata->requests[cur] != request_id)
+      continue;
+
+    /* Keep the order of remaining requests. */
+    for (; i + 1U < cdata->requests_num; i++) {
+      next = (cdata->requests_head + i + 1U) % cdata->requests_len;
+      cdata->requests[cur] = cdata->requests[next];
+      cur = next;
+    }
+
+    cdata->requests_num--;
+    break;
+  }
+
+done:
+  nns_edge_unlock (cdata);
+  return request_id;
+}
+
+/**
+ * @brief Remove nnstreamer-edge connection data.
+ * @note This function should be called with handle lock.
+ */
+static void
+_nns_edge_remove_connection (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_conn_data_s *cdata, *prev;
+
+  cdata = (nns_edge_conn_data_s *) eh->connections;
+  prev = NULL;
+
+  while (cdata) {
+    if (cdata->id == client_id) {
+      if (prev)
+        prev->next = cdata->next;
+      else
+        eh->connections = cdata->next;
+
+      _nns_edge_release_connection_data (cdata);
+      break;
+    }
+    prev = cdata;
+    cdata = cdata->next;
+  }
+
+  /* The responses of outstanding requests will not be received. */
+  if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+    nns_edge_request_clear_target (eh->requests, client_id);
+
+    if (!eh->connections)
+      nns_edge_request_clear (eh->requests);
+  }
+}
+
+/**
+ * @brief Check the destination is already connected.
+ * @note This function should be called with handle lock.
+ */
+static bool
+_nns_edge_is_connected_to (nns_edge_handle_s * eh, const char *host, int port)
+{
+  nns_edge_conn_data_s *cdata;
+  nns_edge_conn_s *conn;
+
+  cdata = (nns_edge_conn_data_s *) eh->connections;
+
+  while (cdata) {
+    conn = cdata->sink_conn;
+    if (conn && conn->port == port && STR_IS_VALID (conn->host) &&
+        STR_IS_VALID (host) && 0 == strcmp (conn->host, host))
+      return true;
+
+    cdata = cdata->next;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Remove all connection data.
+ * @note This function should be called with handle lock.
+ */
+static void
+_nns_edge_remove_all_connection (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_data_s *cdata, *next;
+
+  cdata = (nns_edge_conn_data_s *) eh->connections;
+  eh->connections = NULL;
+
+  while (cdata) {
+    next = cdata->next;
+
+    _nns_edge_release_connection_data (cdata);
+
+    cdata = next;
+  }
+
+  nns_edge_request_clear (eh->requests);
+}
+
+/**
+ * @brief Start non-blocking connection to requested socket.
+ */
+static bool
+_nns_edge_start_connect_socket (nns_edge_conn_s * conn, bool fast_open)
+{
+  struct sockaddr_in saddr = { 0 };
+  socklen_t saddr_len = sizeof (struct sockaddr_in);
+  int flags;
+
+  if (!_fill_socket_addr (&saddr, conn->host, conn->port)) {
+    nns_edge_loge ("Failed to connect socket, invalid host %s.", conn->host);
+    return false;
+  }
+
+  conn->sockfd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (conn->sockfd < 0) {
+    nns_edge_loge ("Failed to create new socket.");
+    return false;
+  }
+
+  _set_socket_option (conn->sockfd);
+
+#ifdef TCP_FASTOPEN_CONNECT
+  if (fast_open) {
+    int enable = 1;
+
+    /* SYN is deferred and carries the first data. The kernel falls back to normal handshake if not supported. */
+    if (setsockopt (conn->sockfd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &enable,
+            sizeof (int)) < 0)
+      nns_edge_logd ("Failed to set TCP fast open, use normal connection.");
+  }
+#else
+  UNUSED (fast_open);
+#endif
+
+  flags = fcntl (conn->sockfd, F_GETFL, 0);
+  if (flags < 0 || fcntl (conn->sockfd, F_SETFL, flags | O_NONBLOCK) < 0) {
+    nns_edge_loge ("Failed to set non-blocking mode of socket.");
+    return false;
+  }
+
+  if (connect (conn->sockfd, (struct sockaddr *) &saddr, saddr_len) < 0 &&
+      errno != EINPROGRESS) {
+    nns_edge_loge ("Failed to connect host %s:%d.", conn->host, conn->port);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Check the result of non-blocking connection and change the socket to blocking mode.
+ */
+static bool
+_nns_edge_finish_connect_socket (nns_edge_conn_s * conn)
+{
+  socklen_t len = sizeof (int);
+  int error = 0;
+  int flags;
+
+  if (getsockopt (conn->sockfd, SOL_SOCKET, SO_ERROR, &error, &len) < 0 ||
+      error != 0) {
+    nns_edge_loge ("Failed to connect host %s:%d.", conn->host, conn->port);
+    return false;
+  }
+
+  flags = fcntl (conn->sockfd, F_GETFL, 0);
+  if (flags < 0 || fcntl (conn->sockfd, F_SETFL, flags & ~O_NONBLOCK) < 0) {
+    nns_edge_loge ("Failed to set blocking mode of socket.");
+    return false;
+  }
 
   return true;
 }
 
+/**
+ * @brief Connect to requested socket. Timeout zero means no timeout.
+ */
+static bool
+_nns_edge_connect_socket (nns_edge_conn_s * conn, unsigned int timeout,
+    bool fast_open)
+{
+  struct pollfd poll_fd;
+
+  if (!_nns_edge_start_connect_socket (conn, fast_open))
+    return false;
+
+  poll_fd.fd = conn->sockfd;
+  poll_fd.events = POLLOUT;
+  poll_fd.revents = 0;
+
+  if (poll (&poll_fd, 1, (timeout > 0U) ? (int) timeout : -1) <= 0) {
+    nns_edge_loge ("Failed to connect host %s:%d within %u milliseconds.",
+        conn->host, conn->port, timeout);
+    return false;
+  }
+
+  return _nns_edge_finish_connect_socket (conn);
+}
+
+/**
+ * @brief Update the metadata of the connection with received delta. The client ID, request ID and deadline from the header are kept in the metadata.
+ * @note The request ID and deadline of previous message are removed if the header does not have them.
+ */
+static int
+_nns_edge_conn_apply_meta_delta (nns_edge_conn_s * conn, nns_edge_cmd_s * cmd,
+    int64_t client_id, int64_t deadline)
+{
+  int64_t cid, rid, dl;
+  int ret;
+
+  if (!conn->meta) {
+    ret = nns_edge_metadata_create_with_allocator (&conn->meta,
+        conn->allocator);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      return ret;
+  }
+
+  ret = nns_edge_metadata_apply_delta (conn->meta, cmd->meta,
+      cmd->info.meta_size);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  /* Avoid copying the metadata shared with the data handles of previous message. */
+  if (nns_edge_metadata_get_int64 (conn->meta, "client_id", &cid) !=
+      NNS_EDGE_ERROR_NONE || cid != client_id)
+    ret = nns_edge_metadata_set_int64 (conn->meta, "client_id", client_id);
+
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    if (cmd->info.request_id == 0U)
+      ret = nns_edge_metadata_remove (conn->meta, "request_id");
+    else if (nns_edge_metadata_get_int64 (conn->meta, "request_id", &rid) !=
+        NNS_EDGE_ERROR_NONE || rid != (int64_t) cmd->info.request_id)
+      ret = nns_edge_metadata_set_int64 (conn->meta, "request_id",
+          cmd->info.request_id);
+  }
+
+  if (ret == NNS_EDGE_ERROR_NONE) {
+    if (deadline < 0)
+      ret = nns_edge_metadata_remove (conn->meta, "deadline");
+    else if (nns_edge_metadata_get_int64 (conn->meta, "deadline", &dl) !=
+        NNS_EDGE_ERROR_NONE || dl != deadline)
+      ret = nns_edge_metadata_set_int64 (conn->meta, "deadline", deadline);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Complete the request of query client which is expired. The event is invoked if the caller is not waiting for the response.
+ */
+static void
+_nns_edge_expire_request (nns_edge_handle_s * eh, uint32_t request_id,
+    int64_t client_id)
+{
+  nns_edge_data_h data_h;
+  bool waiting = false;
+  int ret;
+
+  if (nns_edge_request_expire (eh->requests, request_id, &waiting) !=
+      NNS_EDGE_ERROR_NONE || waiting)
+    return;
+
+  ret = nns_edge_data_create_with_allocator (&data_h, &eh->allocator);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to create data handle of the expired request.");
+    return;
+  }
+
+  nns_edge_data_set_info_int64 (data_h, "client_id", client_id);
+  nns_edge_data_set_info_int64 (data_h, "request_id", request_id);
+
+  ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+      NNS_EDGE_EVENT_REQUEST_EXPIRED, data_h, sizeof (nns_edge_data_h), NULL);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    nns_edge_logw ("The client does not accept the expired request.");
+
+  nns_edge_data_destroy (data_h);
+}
+
+/**
+ * @brief Drop the expired request in query server, and notify it to query client.
+ */
+static void
+_nns_edge_reply_expired (nns_edge_handle_s * eh, nns_edge_data_h data_h)
+{
+  nns_edge_data_h reply_h;
+  int64_t client_id, request_id;
+  int ret;
+
+  /* Query client cannot match the reply without request ID. */
+  if (nns_edge_data_get_info_int64 (data_h, "client_id", &client_id) !=
+      NNS_EDGE_ERROR_NONE ||
+      nns_edge_data_get_info_int64 (data_h, "request_id", &request_id) !=
+      NNS_EDGE_ERROR_NONE)
+    return;
+
+  nns_edge_logw ("The request %lld of client %lld is expired, drop it.",
+      (long long) request_id, (long long) client_id);
+
+  ret = nns_edge_data_create_with_allocator (&reply_h, &eh->allocator);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to create data handle to reply the expired request.");
+    return;
+  }
+
+  nns_edge_data_set_info_int64 (reply_h, "client_id", client_id);
+  nns_edge_data_set_info_int64 (reply_h, "request_id", request_id);
+  nns_edge_data_set_info_int64 (reply_h, "expired", 1);
+
+  ret = nns_edge_queue_push (eh->send_queue, reply_h,
+      sizeof (nns_edge_data_h), nns_edge_data_release_handle);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to push the reply of expired request into the queue.");
+    nns_edge_data_destroy (reply_h);
+  }
+}
+
+/**
+ * @brief Push the copy of received request into the queue, to be delivered in a batch.
+ */
+static void
+_nns_edge_push_batch (nns_edge_handle_s * eh, nns_edge_data_h data_h)
+{
+  nns_edge_data_h new_data_h;
+  int ret;
+
+  ret = nns_edge_data_copy_transfer (data_h, &new_data_h);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to copy the request, drop it.");
+    return;
+  }
+
+  ret = nns_edge_queue_push (eh->batch_queue, new_data_h,
+      sizeof (nns_edge_data_h), nns_edge_data_release_handle);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to push the request into the batch queue.");
+    nns_edge_data_destroy (new_data_h);
+  }
+}
+
 /**
  * @brief Message thread, receive buffer from the client.
  */
@@ -697,7 +2053,7 @@ _nns_edge_message_handler (void *thread_data)
   eh = (nns_edge_handle_s *) _tdata->eh;
   conn = _tdata->conn;
   client_id = _tdata->client_id;
-  SAFE_FREE (_tdata);
+  SAFE_EDGE_FREE (_tdata);
 
   conn->running = true;
   while (conn->running) {
@@ -717,11 +2073,16 @@ _nns_edge_message_handler (void *thread_data)
     if (poll (&poll_fd, 1, 10) > 0) {
       nns_edge_cmd_s cmd;
       nns_edge_data_h data_h;
-      char *val;
+      nns_edge_codec_precision_e precision = NNS_EDGE_CODEC_PRECISION_NONE;
+      bool taken = false;
+      int64_t deadline;
       unsigned int i;
 
       /* Receive data from the client */
       _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
+      cmd.pool = eh->pool;
+      cmd.alloc_cb = eh->alloc_cb;
+      cmd.alloc_data = eh->alloc_data;
       ret = _nns_edge_cmd_receive (conn, &cmd);
       if (ret != NNS_EDGE_ERROR_NONE) {
         nns_edge_loge ("Failed to receive data from the connected node.");
@@ -736,39 +2097,139 @@ _nns_edge_message_handler (void *thread_data)
         break;
       }
 
+      if (cmd.info.cmd == _NNS_EDGE_CMD_EXPIRED) {
+        /* Query server dropped the request, it is not responded. */
+        if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT)
+          _nns_edge_expire_request (eh, cmd.info.request_id, client_id);
+        _nns_edge_cmd_clear (&cmd);
+        continue;
+      }
+
+      if (cmd.info.cmd == _NNS_EDGE_CMD_TRANSFER_ENCODED) {
+        ret = _nns_edge_cmd_decode (eh, conn, &cmd, &precision);
+        if (ret != NNS_EDGE_ERROR_NONE) {
+          nns_edge_loge ("Failed to decode the data from the connected node.");
+          _nns_edge_cmd_clear (&cmd);
+          remove_connection = true;
+          break;
+        }
+      }
+
       if (cmd.info.cmd != _NNS_EDGE_CMD_TRANSFER_DATA) {
         /** @todo handle other cmd later */
         _nns_edge_cmd_clear (&cmd);
         continue;
       }
 
-      ret = nns_edge_data_create (&data_h);
+      ret = nns_edge_pool_get_data (eh->pool, &data_h);
       if (ret != NNS_EDGE_ERROR_NONE) {
         nns_edge_loge ("Failed to create data handle in msg thread.");
         _nns_edge_cmd_clear (&cmd);
         continue;
       }
 
-      for (i = 0; i < cmd.info.num; i++)
-        nns_edge_data_add (data_h, cmd.mem[i], cmd.info.mem_size[i], NULL);
+      for (i = 0; i < cmd.info.num; i++) {
+        if (!cmd.mem_user[i]) {
+          nns_edge_data_add (data_h, cmd.mem[i], cmd.info.mem_size[i], NULL);
+          continue;
+        }
+
+        /* Transfer the ownership of the memory allocated by the application. */
+        if (nns_edge_data_add_transferable (data_h, cmd.mem[i],
+                cmd.info.mem_size[i], cmd.mem_destroy[i]) == NNS_EDGE_ERROR_NONE)
+          cmd.mem_destroy[i] = NULL;
+      }
 
-      if (cmd.info.meta_size > 0)
-        nns_edge_data_deserialize_meta (data_h, cmd.meta, cmd.info.meta_size);
+      /**
+       * The deadline of the request in the clock of query server, -1 if not used.
+       * The deadline in the metadata is the clock of query client, it is replaced.
+       */
+      deadline = -1;
+      if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER) {
+        deadline = (cmd.info.deadline > 0U) ? nns_edge_get_monotonic_time () +
+            (int64_t) cmd.info.deadline * 1000 : 0;
+      }
 
-      /* Set client ID in edge data */
-      val = nns_edge_strdup_printf ("%lld", (long long) client_id);
-      nns_edge_data_set_info (data_h, "client_id", val);
-      SAFE_FREE (val);
+      if (nns_edge_metadata_is_delta (cmd.meta, cmd.info.meta_size)) {
+        /* Update the metadata of connection and share it with the data handle. */
+        ret = _nns_edge_conn_apply_meta_delta (conn, &cmd, client_id, deadline);
+        if (ret == NNS_EDGE_ERROR_NONE)
+          ret = nns_edge_data_set_meta (data_h, conn->meta);
 
-      ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
-          NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h),
-          NULL);
-      if (ret != NNS_EDGE_ERROR_NONE) {
-        /* Try to get next request if server does not accept data from client. */
-        nns_edge_logw ("The server does not accept data from client.");
+        if (ret != NNS_EDGE_ERROR_NONE) {
+          nns_edge_loge ("Failed to apply the delta of metadata.");
+          nns_edge_pool_put_data (eh->pool, data_h);
+          _nns_edge_cmd_clear (&cmd);
+          remove_connection = true;
+          break;
+        }
+      } else {
+        /* The data handle takes the received metadata, it is read without copying. */
+        if (cmd.info.meta_size > 0 &&
+            nns_edge_data_deserialize_meta_take (data_h, cmd.meta,
+                cmd.info.meta_size) == NNS_EDGE_ERROR_NONE)
+          cmd.meta = NULL;
+
+        /* Set client ID in edge data */
+        nns_edge_data_set_info_int64 (data_h, "client_id", client_id);
+
+        if (cmd.info.request_id != 0U)
+          nns_edge_data_set_info_int64 (data_h, "request_id",
+              cmd.info.request_id);
+
+        if (deadline >= 0)
+          nns_edge_data_set_info_int64 (data_h, "deadline", deadline);
       }
 
-      nns_edge_data_destroy (data_h);
+      /* Keep the ID of the request before the application responds it. */
+      if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER &&
+          cmd.info.request_id != 0U) {
+        nns_edge_conn_data_s *conn_data;
+
+        conn_data = _nns_edge_get_connection (eh, client_id);
+        if (conn_data)
+          _nns_edge_push_pending_request (conn_data, cmd.info.request_id);
+      }
+
+      /* The float32 values are not restored, application should handle the values in 16-bit. */
+      if (precision != NNS_EDGE_CODEC_PRECISION_NONE) {
+        nns_edge_data_set_info (data_h, "wire_precision",
+            nns_edge_codec_get_precision_name (precision));
+      }
+
+      /**
+       * The response of query client, it is not outstanding anymore.
+       * The caller of nns_edge_query() takes the response, the event is not invoked.
+       * The response of the duplicated request received later is dropped.
+       * The response without request ID completes the oldest request sent to the server.
+       */
+      if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+        if (cmd.info.request_id == 0U)
+          nns_edge_request_done_oldest (eh->requests, client_id);
+        else if (nns_edge_request_done (eh->requests, cmd.info.request_id,
+                client_id, data_h, &taken) != NNS_EDGE_ERROR_NONE)
+          nns_edge_logw ("Received the response of unknown request %u.",
+              cmd.info.request_id);
+      }
+
+      if (eh->batching) {
+        /* Gather the requests from all connections, the batch thread invokes the event. */
+        _nns_edge_push_batch (eh, data_h);
+      } else if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER &&
+          _nns_edge_is_expired (data_h)) {
+        /* Nobody is waiting for the response of expired request. */
+        _nns_edge_reply_expired (eh, data_h);
+      } else if (!taken) {
+        ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+            NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h,
+            sizeof (nns_edge_data_h), NULL);
+        if (ret != NNS_EDGE_ERROR_NONE) {
+          /* Try to get next request if server does not accept data from client. */
+          nns_edge_logw ("The server does not accept data from client.");
+        }
+      }
+
+      nns_edge_pool_put_data (eh->pool, data_h);
       _nns_edge_cmd_clear (&cmd);
     }
   }
@@ -807,7 +2268,8 @@ _nns_edge_create_message_thread (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
   nns_edge_thread_data_s *thread_data = NULL;
 
   thread_data =
-      (nns_edge_thread_data_s *) calloc (1, sizeof (nns_edge_thread_data_s));
+      (nns_edge_thread_data_s *) nns_edge_calloc (1,
+      sizeof (nns_edge_thread_data_s));
   if (!thread_data) {
     nns_edge_loge ("Failed to allocate edge thread data.");
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -825,13 +2287,145 @@ _nns_edge_create_message_thread (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
     nns_edge_loge ("Failed to create message handler thread.");
     conn->running = false;
     conn->msg_thread = 0;
-    SAFE_FREE (thread_data);
+    SAFE_EDGE_FREE (thread_data);
     return NNS_EDGE_ERROR_IO;
   }
 
   return NNS_EDGE_ERROR_NONE;
 }
 
+/**
+ * @brief Get the servers which completed both connections, to send the request and receive the response.
+ * @return The number of servers in the array. The array grows if it is smaller than the number of servers.
+ */
+static unsigned int
+_nns_edge_get_servers (nns_edge_handle_s * eh, int64_t ** servers,
+    unsigned int *len, int64_t exclude)
+{
+  nns_edge_conn_data_s *conn_data;
+  int64_t *targets;
+  unsigned int num = 0U;
+
+  conn_data = (nns_edge_conn_data_s *) eh->connections;
+  while (conn_data) {
+    if (conn_data->sink_conn && conn_data->src_conn &&
+        conn_data->id != exclude) {
+      if (num >= *len) {
+        targets = (int64_t *) nns_edge_allocator_realloc (NULL, *servers,
+            sizeof (int64_t) * (*len), sizeof (int64_t) * (num + 8U));
+        if (!targets) {
+          nns_edge_loge ("Failed to allocate memory for the servers.");
+          break;
+        }
+
+        *servers = targets;
+        *len = num + 8U;
+      }
+
+      (*servers)[num++] = conn_data->id;
+    }
+
+    conn_data = conn_data->next;
+  }
+
+  return num;
+}
+
+/**
+ * @brief Send the request to the server selected with the policy. If failed to send it, close the connection and select other server.
+ * @note This is called in the send thread.
+ */
+static int
+_nns_edge_transfer_balanced (nns_edge_handle_s * eh, nns_edge_data_h data_h,
+    uint32_t request_id)
+{
+  nns_edge_conn_data_s *conn_data;
+  int64_t target;
+  unsigned int num;
+  int ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  while (true) {
+    num = _nns_edge_get_servers (eh, &eh->lb_targets, &eh->lb_targets_len, 0);
+    if (num == 0U) {
+      nns_edge_loge ("There is no available server to send the request.");
+      ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+      break;
+    }
+
+    target = nns_edge_request_select (eh->requests, eh->lb_targets, num,
+        eh->lb_policy);
+    conn_data = _nns_edge_get_connection (eh, target);
+
+    /* The connection may be closed in the message thread, select other server. */
+    if (!conn_data) {
+      nns_edge_logw ("The selected server is disconnected, select other server.");
+      nns_edge_request_clear_target (eh->requests, target);
+      continue;
+    }
+
+    if (request_id > 0U)
+      nns_edge_request_set_target (eh->requests, request_id, target);
+
+    ret = _nns_edge_transfer_data (conn_data->sink_conn, data_h, target,
+        request_id, false);
+    if (ret == NNS_EDGE_ERROR_NONE)
+      break;
+
+    nns_edge_loge ("Failed to transfer the request. Close the connection and select other server.");
+    if (request_id > 0U)
+      nns_edge_request_set_target (eh->requests, request_id, 0);
+    _nns_edge_remove_connection (eh, target);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief Send the duplicates of the requests which are not responded within the percentile of latency, to other servers.
+ * @return The time in milliseconds until next request is delayed, 10 milliseconds at most. 0 if there is no request to be duplicated.
+ * @note This is called in the send thread.
+ */
+static unsigned int
+_nns_edge_send_hedge (nns_edge_handle_s * eh)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_data_h data_h;
+  int64_t target, server;
+  unsigned int num, wait_ms = 0U;
+  uint32_t request_id;
+
+  while (NNS_EDGE_ERROR_NONE == nns_edge_request_pop_hedge (eh->requests,
+          &request_id, &target, &data_h, &wait_ms) && data_h) {
+    num = _nns_edge_get_servers (eh, &eh->lb_targets, &eh->lb_targets_len,
+        target);
+
+    /* The duplicate of expired request is dropped in query server. */
+    if (num > 0U && !_nns_edge_is_expired (data_h)) {
+      server = nns_edge_request_select (eh->requests, eh->lb_targets, num,
+          eh->lb_policy);
+      conn_data = _nns_edge_get_connection (eh, server);
+
+      /* The response may be received before the duplicate is sent. */
+      if (conn_data && NNS_EDGE_ERROR_NONE ==
+          nns_edge_request_set_hedge_target (eh->requests, request_id,
+              server) &&
+          NNS_EDGE_ERROR_NONE != _nns_edge_transfer_data (conn_data->sink_conn,
+              data_h, server, request_id, false)) {
+        nns_edge_loge ("Failed to transfer the duplicated request. Close the connection.");
+        _nns_edge_remove_connection (eh, server);
+      }
+    }
+
+    nns_edge_data_destroy (data_h);
+  }
+
+  /* Check the percentile of updated latencies, the duplicate may be sent earlier. */
+  if (wait_ms > 10U)
+    wait_ms = 10U;
+
+  return wait_ms;
+}
+
 /**
  * @brief Thread to send data.
  */
@@ -843,18 +2437,33 @@ _nns_edge_send_thread (void *thread_data)
   nns_edge_conn_s *conn;
   nns_edge_data_h data_h;
   nns_size_t data_size;
-  int64_t client_id;
-  char *val;
+  int64_t client_id, request_id;
+  uint32_t response_id;
+  unsigned int wait_ms;
+  bool from_server;
   int ret;
 
+  /* The data sent from the server is the response or published data, the deadline of the request is not forwarded. */
+  from_server = (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER ||
+      eh->node_type == NNS_EDGE_NODE_TYPE_PUB);
+
   nns_edge_lock (eh);
   eh->sending = true;
   nns_edge_cond_signal (eh);
   nns_edge_unlock (eh);
 
-  while (eh->sending &&
-      NNS_EDGE_ERROR_NONE == nns_edge_queue_wait_pop (eh->send_queue, 0U,
-          &data_h, &data_size)) {
+  while (eh->sending) {
+    /* Send the duplicated requests, and wait for new data until next request is delayed. */
+    wait_ms = eh->hedging ? _nns_edge_send_hedge (eh) : 0U;
+
+    /* Timed out to send the duplicate, or the queue is cleared to stop the thread. */
+    if (NNS_EDGE_ERROR_NONE != nns_edge_queue_wait_pop (eh->send_queue,
+            wait_ms, &data_h, &data_size)) {
+      if (wait_ms > 0U)
+        continue;
+      break;
+    }
+
     if (!eh->sending) {
       nns_edge_data_destroy (data_h);
       break;
@@ -864,8 +2473,33 @@ _nns_edge_send_thread (void *thread_data)
     switch (eh->connect_type) {
       case NNS_EDGE_CONNECT_TYPE_TCP:
       case NNS_EDGE_CONNECT_TYPE_HYBRID:
-        ret = nns_edge_data_get_info (data_h, "client_id", &val);
-        if (ret != NNS_EDGE_ERROR_NONE) {
+        /* Add the request before sending it, the response may be received before the transfer is done. */
+        request_id = 0;
+        if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT &&
+            nns_edge_data_get_info_int64 (data_h, "request_id",
+                &request_id) == NNS_EDGE_ERROR_NONE)
+          nns_edge_request_add (eh->requests, (uint32_t) request_id);
+
+        /* The request is expired in the send queue, do not send it. */
+        if (request_id > 0 && _nns_edge_is_expired (data_h)) {
+          nns_edge_logw ("The request %lld is expired before it is sent.",
+              (long long) request_id);
+          _nns_edge_expire_request (eh, (uint32_t) request_id, 0);
+          break;
+        }
+
+        ret = nns_edge_data_get_info_int64 (data_h, "client_id", &client_id);
+        if (ret != NNS_EDGE_ERROR_NONE &&
+            eh->lb_policy != NNS_EDGE_REQUEST_POLICY_NONE) {
+          /* Query client sends the request to one of the connected servers. */
+          ret = _nns_edge_transfer_balanced (eh, data_h, (uint32_t) request_id);
+
+          /* Keep the request to send the duplicate, if the response is delayed. */
+          if (ret == NNS_EDGE_ERROR_NONE && eh->hedging && request_id > 0 &&
+              nns_edge_request_set_data (eh->requests, (uint32_t) request_id,
+                  data_h) == NNS_EDGE_ERROR_NONE)
+            data_h = NULL;
+        } else if (ret != NNS_EDGE_ERROR_NONE) {
           nns_edge_logd
               ("Cannot find client ID in edge data. Send to all connected nodes.");
 
@@ -873,7 +2507,8 @@ _nns_edge_send_thread (void *thread_data)
           while (conn_data) {
             client_id = conn_data->id;
             conn = conn_data->sink_conn;
-            ret = _nns_edge_transfer_data (conn, data_h, client_id);
+            ret = _nns_edge_transfer_data (conn, data_h, client_id,
+                _nns_edge_get_request_id (data_h), from_server);
             conn_data = conn_data->next;
 
             if (NNS_EDGE_ERROR_NONE != ret) {
@@ -882,39 +2517,221 @@ _nns_edge_send_thread (void *thread_data)
             }
           }
         } else {
-          client_id = (int64_t) strtoll (val, NULL, 10);
-          SAFE_FREE (val);
-
           conn_data = _nns_edge_get_connection (eh, client_id);
           if (conn_data) {
             conn = conn_data->sink_conn;
-            _nns_edge_transfer_data (conn, data_h, client_id);
+            response_id = _nns_edge_get_request_id (data_h);
+
+            /* Query server echoes the ID of the request, if the response does not have it. */
+            if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER)
+              response_id = _nns_edge_pop_pending_request (conn_data,
+                  response_id);
+
+            ret = _nns_edge_transfer_data (conn, data_h, client_id,
+                response_id, from_server);
           } else {
             nns_edge_loge
                 ("Cannot find connection, invalid client ID or connection closed.");
+            ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
           }
         }
+
+        /* The request is not sent, the response will not be received. */
+        if (request_id > 0 && ret != NNS_EDGE_ERROR_NONE)
+          nns_edge_request_remove (eh->requests, (uint32_t) request_id);
         break;
       case NNS_EDGE_CONNECT_TYPE_AITT:
-        ret = nns_edge_aitt_send_data (eh->broker_h, data_h);
+        ret = nns_edge_aitt_send_data (eh->broker_h, data_h,
+            eh->data_alignment);
         if (NNS_EDGE_ERROR_NONE != ret)
           nns_edge_loge ("Failed to send data via AITT connection.");
         break;
       case NNS_EDGE_CONNECT_TYPE_MQTT:
-        ret = nns_edge_mqtt_publish_data (eh->broker_h, data_h);
+        ret = nns_edge_mqtt_publish_data (eh->broker_h, data_h,
+            eh->data_alignment);
         if (NNS_EDGE_ERROR_NONE != ret)
           nns_edge_loge ("Failed to send data via MQTT connection.");
         break;
       default:
         break;
     }
-    nns_edge_data_destroy (data_h);
+
+    if (data_h)
+      nns_edge_data_destroy (data_h);
+  }
+  eh->sending = false;
+
+  return NULL;
+}
+
+/**
+ * @brief Add the request into the pending requests of batch. The expired request is dropped.
+ */
+static void
+_nns_edge_add_batch (nns_edge_handle_s * eh, nns_edge_data_h data_h,
+    unsigned int *num)
+{
+  int64_t deadline;
+  unsigned int i;
+
+  if (_nns_edge_is_expired (data_h)) {
+    _nns_edge_reply_expired (eh, data_h);
+    nns_edge_data_destroy (data_h);
+    return;
+  }
+
+  deadline = _nns_edge_get_deadline (data_h);
+  if (deadline == 0)
+    deadline = INT64_MAX;
+
+  /* Insert in order of deadline, the request received earlier is first if the deadline is same. */
+  i = *num;
+  while (i > 0 && eh->batch_deadline[i - 1] > deadline) {
+    eh->batch[i] = eh->batch[i - 1];
+    eh->batch_deadline[i] = eh->batch_deadline[i - 1];
+    i--;
+  }
+
+  eh->batch[i] = data_h;
+  eh->batch_deadline[i] = deadline;
+  (*num)++;
+}
+
+/**
+ * @brief Thread to gather the requests into a batch and invoke the event.
+ * @note The requests with earliest deadline are delivered first, and the remaining requests are kept for next batch.
+ */
+static void *
+_nns_edge_batch_thread (void *thread_data)
+{
+  nns_edge_handle_s *eh = (nns_edge_handle_s *) thread_data;
+  nns_edge_data_h data_h;
+  nns_size_t data_size;
+  int64_t end_time, remaining;
+  unsigned int i, j, num, count;
+  int ret;
+
+  num = 0U;
+  while (eh->batching) {
+    /* Wait for the first request (100 milliseconds), and check the state. */
+    if (num == 0U) {
+      if (NNS_EDGE_ERROR_NONE != nns_edge_queue_wait_pop (eh->batch_queue,
+              100U, &data_h, &data_size))
+        continue;
+
+      _nns_edge_add_batch (eh, data_h, &num);
+    }
+
+    end_time = nns_edge_get_monotonic_time () +
+        (int64_t) eh->batch_timeout * 1000;
+
+    /* Gather more requests until the batch is full or timed out. */
+    while (eh->batching && num < eh->batch_size) {
+      remaining = end_time - nns_edge_get_monotonic_time ();
+      if (remaining <= 0)
+        break;
+
+      if (NNS_EDGE_ERROR_NONE == nns_edge_queue_wait_pop (eh->batch_queue,
+              (unsigned int) ((remaining + 999) / 1000), &data_h, &data_size))
+        _nns_edge_add_batch (eh, data_h, &num);
+    }
+
+    /* Take the requests received in the meantime, to select the earliest deadlines. */
+    while (num < eh->batch_size * 2 && NNS_EDGE_ERROR_NONE ==
+        nns_edge_queue_pop (eh->batch_queue, &data_h, &data_size))
+      _nns_edge_add_batch (eh, data_h, &num);
+
+    /* The requests may be expired while waiting for the batch. */
+    for (i = 0, j = 0; i < num; i++) {
+      if (eh->batch_deadline[i] <= nns_edge_get_monotonic_time ()) {
+        _nns_edge_reply_expired (eh, eh->batch[i]);
+        nns_edge_data_destroy (eh->batch[i]);
+      } else {
+        eh->batch[j] = eh->batch[i];
+        eh->batch_deadline[j] = eh->batch_deadline[i];
+        j++;
+      }
+    }
+    num = j;
+
+    if (num == 0U)
+      continue;
+
+    count = (num < eh->batch_size) ? num : eh->batch_size;
+    ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+        NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, eh->batch,
+        count * sizeof (nns_edge_data_h), NULL);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      nns_edge_logw ("The server does not accept the batch of requests.");
+
+    for (i = 0; i < count; i++)
+      nns_edge_data_destroy (eh->batch[i]);
+
+    num -= count;
+    memmove (eh->batch, eh->batch + count, num * sizeof (nns_edge_data_h));
+    memmove (eh->batch_deadline, eh->batch_deadline + count,
+        num * sizeof (int64_t));
   }
-  eh->sending = false;
+
+  for (i = 0; i < num; i++)
+    nns_edge_data_destroy (eh->batch[i]);
 
   return NULL;
 }
 
+/**
+ * @brief Create thread to gather the requests into a batch.
+ * @note This should be called with lock.
+ */
+static int
+_nns_edge_create_batch_thread (nns_edge_handle_s * eh)
+{
+  int status;
+
+  eh->batch = (nns_edge_data_h *) nns_edge_calloc (eh->batch_size * 2,
+      sizeof (nns_edge_data_h));
+  eh->batch_deadline = (int64_t *) nns_edge_calloc (eh->batch_size * 2,
+      sizeof (int64_t));
+  if (!eh->batch || !eh->batch_deadline) {
+    SAFE_EDGE_FREE (eh->batch);
+    SAFE_EDGE_FREE (eh->batch_deadline);
+    nns_edge_loge ("Failed to allocate memory for the batch.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  eh->batching = true;
+  status = pthread_create (&eh->batch_thread, NULL, _nns_edge_batch_thread, eh);
+
+  if (status != 0) {
+    nns_edge_loge ("Failed to create batch thread.");
+    eh->batch_thread = 0;
+    eh->batching = false;
+    SAFE_EDGE_FREE (eh->batch);
+    SAFE_EDGE_FREE (eh->batch_deadline);
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Stop the thread to gather the requests, and clear the requests in the queue.
+ */
+static void
+_nns_edge_stop_batch_thread (nns_edge_handle_s * eh)
+{
+  eh->batching = false;
+  nns_edge_queue_clear (eh->batch_queue);
+
+  if (eh->batch_thread) {
+    pthread_join (eh->batch_thread, NULL);
+    eh->batch_thread = 0;
+  }
+
+  SAFE_EDGE_FREE (eh->batch);
+  SAFE_EDGE_FREE (eh->batch_deadline);
+}
+
 /**
  * @brief Create thread to send data.
  * @note This should be called with lock.
@@ -940,207 +2757,758 @@ _nns_edge_create_send_thread (nns_edge_handle_s * eh)
 }
 
 /**
- * @brief Connect to the destination node. (host:sender(sink) - dest:receiver(listener, src))
+ * @brief Set the host string (host:port) in the command.
  */
-static int
-_nns_edge_connect_to (nns_edge_handle_s * eh, int64_t client_id,
-    const char *host, int port)
+static void
+_nns_edge_cmd_set_host_info (nns_edge_cmd_s * cmd, const char *host, int port)
 {
-  nns_edge_conn_s *conn = NULL;
-  nns_edge_conn_data_s *conn_data;
-  nns_edge_cmd_s cmd;
   char *host_str;
-  bool done = false;
-  int ret;
 
-  conn = (nns_edge_conn_s *) calloc (1, sizeof (nns_edge_conn_s));
-  if (!conn) {
-    nns_edge_loge ("Failed to allocate client data.");
-    goto error;
+  host_str = nns_edge_get_host_string (host, port);
+  if (!host_str)
+    return;
+
+  /* Memories in the command are released with the allocator. */
+  cmd->mem[0] = nns_edge_memdup (host_str, strlen (host_str) + 1);
+  if (cmd->mem[0]) {
+    cmd->info.num = 1;
+    cmd->info.mem_size[0] = strlen (host_str) + 1;
   }
 
-  conn->host = nns_edge_strdup (host);
-  conn->port = port;
-  conn->sockfd = -1;
+  SAFE_FREE (host_str);
+}
 
-  if (!_nns_edge_connect_socket (conn)) {
-    goto error;
+/**
+ * @brief Get the capability hash of the destination, which is accepted before.
+ * @note Caller should release returned value using free().
+ */
+static int
+_nns_edge_get_cached_caps (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    char **caps_hash)
+{
+  char *key;
+  int ret;
+
+  key = nns_edge_get_host_string (conn->host, conn->port);
+  ret = nns_edge_metadata_get (eh->caps_cache, key, caps_hash);
+  SAFE_FREE (key);
+
+  return ret;
+}
+
+/**
+ * @brief Keep the capability hash of the destination to resume the handshake when reconnecting.
+ */
+static void
+_nns_edge_set_cached_caps (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    const char *caps_hash)
+{
+  char *key;
+
+  if (!caps_hash)
+    return;
+
+  key = nns_edge_get_host_string (conn->host, conn->port);
+  nns_edge_metadata_set (eh->caps_cache, key, caps_hash);
+  SAFE_FREE (key);
+}
+
+/**
+ * @brief Start the handshake with the connected destination. The host info is sent in the first flight if fast reconnect is enabled.
+ * @note The capability from the destination is received with _nns_edge_connect_handshake_finish().
+ */
+static int
+_nns_edge_connect_handshake_start (nns_edge_handle_s * eh,
+    nns_edge_conn_s * conn, int64_t client_id, bool *host_sent)
+{
+  nns_edge_cmd_s cmd;
+  char *cached_hash = NULL;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  *host_sent = false;
+
+  if ((NNS_EDGE_NODE_TYPE_QUERY_CLIENT != eh->node_type)
+      && (NNS_EDGE_NODE_TYPE_SUB != eh->node_type))
+    return NNS_EDGE_ERROR_NONE;
+
+  /* The destination may accept the socket but do not respond. */
+  _set_socket_timeout (conn->sockfd, eh->connect_timeout);
+
+  /**
+   * Send host info in the first flight with the hash of capability which has been accepted before.
+   * The destination skips sending the capability string when the capability is not changed.
+   */
+  if (eh->fast_reconnect) {
+    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_HOST_INFO, client_id);
+    _nns_edge_cmd_set_host_info (&cmd, eh->host, eh->port);
+    if (_nns_edge_get_cached_caps (eh, conn, &cached_hash) ==
+        NNS_EDGE_ERROR_NONE)
+      _nns_edge_cmd_set_option (&cmd, "caps-hash", cached_hash);
+    _nns_edge_cmd_set_option (&cmd, "meta-delta", "true");
+    _nns_edge_cmd_set_codec_options (&cmd);
+
+    ret = _nns_edge_cmd_send (conn, &cmd);
+    _nns_edge_cmd_clear (&cmd);
+
+    if (ret != NNS_EDGE_ERROR_NONE)
+      nns_edge_loge ("Failed to send host info.");
+    else
+      *host_sent = true;
   }
 
+  SAFE_FREE (cached_hash);
+  return ret;
+}
+
+/**
+ * @brief Receive the capability from the destination, send host info and add new connection.
+ * @note The connection is not released when failed to handshake, caller should close it.
+ */
+static int
+_nns_edge_connect_handshake_finish (nns_edge_handle_s * eh,
+    nns_edge_conn_s * conn, int64_t client_id, bool host_sent)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_cmd_s cmd;
+  char *cached_hash = NULL, *caps_hash = NULL, *resumed = NULL;
+  bool accepted = false;
+  int ret = NNS_EDGE_ERROR_NONE;
+
   if ((NNS_EDGE_NODE_TYPE_QUERY_CLIENT == eh->node_type)
       || (NNS_EDGE_NODE_TYPE_SUB == eh->node_type)) {
+    /* The capability hash sent in the first flight. */
+    if (host_sent)
+      _nns_edge_get_cached_caps (eh, conn, &cached_hash);
+
     /* Receive capability and client ID from server. */
     _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
     ret = _nns_edge_cmd_receive (conn, &cmd);
     if (ret != NNS_EDGE_ERROR_NONE) {
       nns_edge_loge ("Failed to receive capability.");
-      goto error;
+      goto done;
     }
 
     if (cmd.info.cmd != _NNS_EDGE_CMD_CAPABILITY) {
       nns_edge_loge ("Failed to get capability.");
       _nns_edge_cmd_clear (&cmd);
-      goto error;
+      ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+      goto done;
     }
 
     client_id = eh->client_id = cmd.info.client_id;
+    _nns_edge_conn_set_meta_delta (conn, &cmd);
+    _nns_edge_conn_set_codec (eh, conn, &cmd);
+
+    /* The destination sends the capability string if it does not resume the handshake. */
+    if (cached_hash)
+      accepted = (_nns_edge_cmd_get_option (&cmd, "caps-resumed", &resumed) ==
+          NNS_EDGE_ERROR_NONE);
+
+    if (accepted) {
+      nns_edge_logd ("The capability is not changed, skip checking compatibility.");
+      ret = NNS_EDGE_ERROR_NONE;
+    } else if (cmd.info.num == 0) {
+      nns_edge_loge ("Failed to get capability, invalid command.");
+      ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+    } else {
+      /* Check compatibility. */
+      ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
+          NNS_EDGE_EVENT_CAPABILITY, cmd.mem[0], cmd.info.mem_size[0], NULL);
 
-    /* Check compatibility. */
-    ret = nns_edge_event_invoke_callback (eh->event_cb, eh->user_data,
-        NNS_EDGE_EVENT_CAPABILITY, cmd.mem[0], cmd.info.mem_size[0], NULL);
+      if (ret == NNS_EDGE_ERROR_NONE && eh->fast_reconnect) {
+        caps_hash = _nns_edge_get_caps_hash ((char *) cmd.mem[0]);
+        _nns_edge_set_cached_caps (eh, conn, caps_hash);
+      }
+    }
     _nns_edge_cmd_clear (&cmd);
 
     if (ret != NNS_EDGE_ERROR_NONE) {
       nns_edge_loge ("The event returns error, capability is not acceptable.");
       _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
-    } else {
+    } else if (!host_sent) {
       /* Send host and port to destination. */
       _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_HOST_INFO, client_id);
-
-      host_str = nns_edge_get_host_string (eh->host, eh->port);
-      cmd.info.num = 1;
-      cmd.info.mem_size[0] = strlen (host_str) + 1;
-      cmd.mem[0] = host_str;
+      _nns_edge_cmd_set_host_info (&cmd, eh->host, eh->port);
+      _nns_edge_cmd_set_option (&cmd, "meta-delta", "true");
+      _nns_edge_cmd_set_codec_options (&cmd);
     }
 
-    ret = _nns_edge_cmd_send (conn, &cmd);
-    _nns_edge_cmd_clear (&cmd);
+    if (ret != NNS_EDGE_ERROR_NONE || !host_sent) {
+      int send_ret = _nns_edge_cmd_send (conn, &cmd);
 
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to send host info.");
-      goto error;
+      _nns_edge_cmd_clear (&cmd);
+
+      if (send_ret != NNS_EDGE_ERROR_NONE) {
+        nns_edge_loge ("Failed to send host info.");
+        ret = send_ret;
+      }
     }
+
+    if (ret != NNS_EDGE_ERROR_NONE)
+      goto done;
+
+    _set_socket_timeout (conn->sockfd, 0U);
+    conn->deadline = 0;
   }
 
   if (NNS_EDGE_NODE_TYPE_SUB == eh->node_type) {
     ret = _nns_edge_create_message_thread (eh, conn, client_id);
     if (ret != NNS_EDGE_ERROR_NONE) {
       nns_edge_loge ("Failed to create message handle thread.");
-      goto error;
+      goto done;
+    }
+  }
+
+  conn_data = _nns_edge_add_connection (eh, client_id);
+  if (!conn_data) {
+    ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+    goto done;
+  }
+
+  /* Close old connection and set new one. */
+  _nns_edge_close_connection (conn_data->sink_conn);
+  conn_data->sink_conn = conn;
+
+done:
+  SAFE_FREE (cached_hash);
+  SAFE_FREE (caps_hash);
+  SAFE_FREE (resumed);
+  return ret;
+}
+
+/**
+ * @brief Exchange the node info with the connected destination and add new connection.
+ * @note The connection is not released when failed to handshake, caller should close it.
+ */
+static int
+_nns_edge_connect_handshake (nns_edge_handle_s * eh, nns_edge_conn_s * conn,
+    int64_t client_id)
+{
+  bool host_sent;
+  int ret;
+
+  ret = _nns_edge_connect_handshake_start (eh, conn, client_id, &host_sent);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  return _nns_edge_connect_handshake_finish (eh, conn, client_id, host_sent);
+}
+
+/**
+ * @brief Create new edge connection to given host. The host is null if the connection is accepted.
+ */
+static nns_edge_conn_s *
+_nns_edge_create_connection (nns_edge_handle_s * eh, const char *host,
+    int port)
+{
+  nns_edge_conn_s *conn;
+
+  conn = (nns_edge_conn_s *) nns_edge_calloc (1, sizeof (nns_edge_conn_s));
+  if (!conn) {
+    nns_edge_loge ("Failed to allocate client data.");
+    return NULL;
+  }
+
+  conn->host = nns_edge_strdup (host);
+  conn->port = port;
+  conn->sockfd = -1;
+  conn->allocator = &eh->allocator;
+  conn->pool = eh->pool;
+  conn->delta_sent.allocator = eh->allocator;
+  conn->delta_received.allocator = eh->allocator;
+
+  return conn;
+}
+
+/**
+ * @brief Connect to the destination node. (host:sender(sink) - dest:receiver(listener, src))
+ */
+static int
+_nns_edge_connect_to (nns_edge_handle_s * eh, int64_t client_id,
+    const char *host, int port)
+{
+  nns_edge_conn_s *conn;
+  char *caps_hash = NULL;
+  bool fast_open = false;
+
+  conn = _nns_edge_create_connection (eh, host, port);
+  if (!conn)
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  /* Use TCP fast open if the destination has been connected before. */
+  if (eh->fast_reconnect) {
+    fast_open = (_nns_edge_get_cached_caps (eh, conn, &caps_hash)
+        == NNS_EDGE_ERROR_NONE);
+    SAFE_FREE (caps_hash);
+  }
+
+  if (!_nns_edge_connect_socket (conn, eh->connect_timeout, fast_open) ||
+      NNS_EDGE_ERROR_NONE != _nns_edge_connect_handshake (eh, conn, client_id)) {
+    _nns_edge_close_connection (conn);
+    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Wait for the connection from the server to receive the responses.
+ * @note Query client identifies the connection from the server with current client ID, which is updated in the handshake with next server.
+ * @return true if the connection is registered. Otherwise the connection to the server is closed.
+ */
+static bool
+_nns_edge_wait_server_connection (nns_edge_handle_s * eh, int64_t client_id)
+{
+  nns_edge_conn_data_s *conn_data;
+  int64_t end_time = 0;
+
+  if (eh->connect_timeout > 0U)
+    end_time = nns_edge_get_monotonic_time () + eh->connect_timeout * 1000LL;
+
+  do {
+    conn_data = _nns_edge_get_connection (eh, client_id);
+    if (conn_data && conn_data->src_conn)
+      return true;
+
+    /* 1 millisecond */
+    usleep (1000);
+  } while (end_time == 0 || nns_edge_get_monotonic_time () < end_time);
+
+  nns_edge_loge ("The server does not connect to receive the responses.");
+  _nns_edge_remove_connection (eh, client_id);
+  return false;
+}
+
+/**
+ * @brief Internal data of the candidate to be connected.
+ */
+typedef struct
+{
+  bool handshaking; /**< true if the socket is connected and the capability is not received yet */
+  bool host_sent; /**< true if the host info is sent in the first flight */
+} nns_edge_candidate_s;
+
+/**
+ * @brief Connect to the candidates in parallel. The first node which completes the handshake is connected.
+ * @note Given connections are released in this function. Each candidate is polled to connect the socket and then to receive the capability.
+ * The capability is received only from the candidate which is readable, and the receive is limited with the deadline of the race.
+ * Query client balancing the requests identifies the connection from the server with current client ID, the server which completes the handshake should connect to the client before next server.
+ */
+static int
+_nns_edge_connect_candidates (nns_edge_handle_s * eh, int64_t client_id,
+    nns_edge_conn_s ** conns, unsigned int num)
+{
+  nns_edge_conn_data_s *conn_data;
+  nns_edge_candidate_s *cands;
+  struct pollfd *poll_fds;
+  unsigned int *index;
+  unsigned int i, n, pending;
+  int64_t end_time = 0, remaining, waiting_id = 0;
+  bool connect_all, waiting = false;
+  int ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+
+  /* Query client balancing the requests connects to all available servers. */
+  connect_all = (eh->lb_policy != NNS_EDGE_REQUEST_POLICY_NONE);
+
+  cands = (nns_edge_candidate_s *) nns_edge_calloc (num,
+      sizeof (nns_edge_candidate_s));
+  poll_fds = (struct pollfd *) nns_edge_calloc (num, sizeof (struct pollfd));
+  index = (unsigned int *) nns_edge_calloc (num, sizeof (unsigned int));
+  if (!cands || !poll_fds || !index) {
+    nns_edge_loge ("Failed to allocate poll data for candidates.");
+    goto done;
+  }
+
+  if (eh->connect_timeout > 0U)
+    end_time = nns_edge_get_monotonic_time () + eh->connect_timeout * 1000LL;
+
+  for (i = 0; i < num; i++) {
+    if (connect_all &&
+        _nns_edge_is_connected_to (eh, conns[i]->host, conns[i]->port)) {
+      _nns_edge_close_connection (conns[i]);
+      conns[i] = NULL;
+      ret = NNS_EDGE_ERROR_NONE;
+      continue;
+    }
+
+    if (!_nns_edge_start_connect_socket (conns[i], false)) {
+      _nns_edge_close_connection (conns[i]);
+      conns[i] = NULL;
+      continue;
+    }
+
+    /* The candidate sending the capability slowly cannot hold the race after the deadline. */
+    conns[i]->deadline = end_time;
+  }
+
+  do {
+    /* Check the connection from the server to receive the responses. */
+    if (waiting) {
+      conn_data = _nns_edge_get_connection (eh, waiting_id);
+      if (conn_data && conn_data->src_conn) {
+        ret = NNS_EDGE_ERROR_NONE;
+        waiting = false;
+      }
+    }
+
+    for (i = 0, pending = 0; i < num; i++) {
+      if (!conns[i] || (waiting && cands[i].handshaking))
+        continue;
+
+      poll_fds[pending].fd = conns[i]->sockfd;
+      poll_fds[pending].events = cands[i].handshaking ? POLLIN : POLLOUT;
+      poll_fds[pending].revents = 0;
+      index[pending++] = i;
+    }
+
+    if (pending == 0U && !waiting)
+      break;
+
+    remaining = -1;
+    if (end_time > 0) {
+      remaining = (end_time - nns_edge_get_monotonic_time ()) / 1000;
+      if (remaining <= 0) {
+        nns_edge_loge ("Failed to connect candidates within timeout.");
+        break;
+      }
+    }
+
+    /* 1 millisecond, to check the connection from the server. */
+    if (waiting && (remaining < 0 || remaining > 1))
+      remaining = 1;
+
+    if (poll (poll_fds, pending, (int) remaining) < 0)
+      break;
+
+    for (n = 0; n < pending; n++) {
+      i = index[n];
+      if (poll_fds[n].revents == 0 || (waiting && cands[i].handshaking))
+        continue;
+
+      if (!cands[i].handshaking) {
+        /* The socket is connected, send the first flight and wait for the capability. */
+        if (_nns_edge_finish_connect_socket (conns[i]) &&
+            NNS_EDGE_ERROR_NONE == _nns_edge_connect_handshake_start (eh,
+                conns[i], client_id, &cands[i].host_sent)) {
+          cands[i].handshaking = true;
+          continue;
+        }
+      } else if ((poll_fds[n].revents & POLLIN) &&
+          NNS_EDGE_ERROR_NONE == _nns_edge_connect_handshake_finish (eh,
+              conns[i], client_id, cands[i].host_sent)) {
+        nns_edge_logd ("Connected to the candidate %s:%d.", conns[i]->host,
+            conns[i]->port);
+        conns[i] = NULL;
+
+        if (!connect_all) {
+          ret = NNS_EDGE_ERROR_NONE;
+          break;
+        }
+
+        waiting = true;
+        waiting_id = eh->client_id;
+        continue;
+      }
+
+      _nns_edge_close_connection (conns[i]);
+      conns[i] = NULL;
     }
-  }
+  } while (connect_all || ret != NNS_EDGE_ERROR_NONE);
 
-  conn_data = _nns_edge_add_connection (eh, client_id);
-  if (conn_data) {
-    /* Close old connection and set new one. */
-    _nns_edge_close_connection (conn_data->sink_conn);
-    conn_data->sink_conn = conn;
-    done = true;
+  if (waiting) {
+    nns_edge_loge ("The server does not connect to receive the responses.");
+    _nns_edge_remove_connection (eh, waiting_id);
   }
 
-error:
-  if (!done) {
-    _nns_edge_close_connection (conn);
-    return NNS_EDGE_ERROR_CONNECTION_FAILURE;
-  }
+done:
+  for (i = 0; i < num; i++)
+    _nns_edge_close_connection (conns[i]);
 
-  return NNS_EDGE_ERROR_NONE;
+  SAFE_EDGE_FREE (cands);
+  SAFE_EDGE_FREE (poll_fds);
+  SAFE_EDGE_FREE (index);
+  return ret;
 }
 
 /**
- * @brief Accept socket and create message thread in socket listener thread.
+ * @brief Release the accepted socket and its connections.
  */
 static void
-_nns_edge_accept_socket (nns_edge_handle_s * eh)
+_nns_edge_release_handshake (void *data)
 {
-  bool done = false;
-  nns_edge_conn_s *conn;
-  nns_edge_conn_data_s *conn_data;
-  nns_edge_cmd_s cmd;
-  int64_t client_id;
+  nns_edge_handshake_s *hs = (nns_edge_handshake_s *) data;
+
+  if (!hs)
+    return;
+
+  _nns_edge_close_connection (hs->conn);
+  _nns_edge_close_connection (hs->sink_conn);
+  SAFE_EDGE_FREE (hs);
+}
+
+/**
+ * @brief Exchange the capability and host info with the accepted socket.
+ * @note This is called in the handshake worker, the whole handshake should be done within handshake timeout.
+ */
+static int
+_nns_edge_handshake (nns_edge_handle_s * eh, nns_edge_handshake_s * hs)
+{
+  nns_edge_conn_s *conn = hs->conn;
+  nns_edge_cmd_s cmd, host_cmd;
+  struct pollfd poll_fd;
   char *dest_host = NULL;
-  int dest_port, ret;
+  char *caps_hash, *client_hash = NULL;
+  bool resumed = false;
+  int dest_port, wait_ms = 0, ret;
+  int64_t remaining = 0;
 
-  conn = (nns_edge_conn_s *) calloc (1, sizeof (nns_edge_conn_s));
-  if (!conn) {
-    nns_edge_loge ("Failed to allocate edge connection.");
-    goto error;
-  }
+  /* The peer sending the data slowly cannot hold the worker after the deadline. */
+  if (eh->handshake_timeout > 0U)
+    conn->deadline = nns_edge_get_monotonic_time () +
+        (int64_t) eh->handshake_timeout * 1000;
 
-  conn->sockfd = accept (eh->listener_fd, NULL, NULL);
-  if (conn->sockfd < 0) {
-    nns_edge_loge ("Failed to accept socket.");
-    goto error;
+  _nns_edge_cmd_init (&host_cmd, _NNS_EDGE_CMD_ERROR, hs->client_id);
+
+  /**
+   * The client enabling fast reconnect sends host info in the first flight.
+   * Skip sending the capability string if the client has same capability hash.
+   */
+  if (eh->fast_reconnect) {
+    wait_ms = FIRST_FLIGHT_TIMEOUT;
+    if (eh->handshake_timeout > 0U &&
+        eh->handshake_timeout < (unsigned int) FIRST_FLIGHT_TIMEOUT)
+      wait_ms = (int) eh->handshake_timeout;
   }
 
-  _set_socket_option (conn->sockfd);
+  poll_fd.fd = conn->sockfd;
+  poll_fd.events = POLLIN;
+  poll_fd.revents = 0;
 
-  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
-      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
-    client_id = nns_edge_generate_id ();
-  } else {
-    client_id = eh->client_id;
+  if (poll (&poll_fd, 1, wait_ms) > 0 && (poll_fd.revents & POLLIN)) {
+    ret = _nns_edge_cmd_receive (conn, &host_cmd);
+    if (ret != NNS_EDGE_ERROR_NONE || host_cmd.info.cmd != _NNS_EDGE_CMD_HOST_INFO) {
+      nns_edge_loge ("Failed to get host info.");
+      ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+      goto done;
+    }
+
+    if (eh->fast_reconnect && NNS_EDGE_ERROR_NONE ==
+        _nns_edge_cmd_get_option (&host_cmd, "caps-hash", &client_hash)) {
+      caps_hash = _nns_edge_get_caps_hash (eh->caps_str);
+      resumed = (caps_hash && strcmp (caps_hash, client_hash) == 0);
+      SAFE_FREE (caps_hash);
+    }
   }
 
   /* Send capability and info to check compatibility. */
-  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
-      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
-    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_CAPABILITY, client_id);
+  _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_CAPABILITY, hs->client_id);
+  _nns_edge_cmd_set_option (&cmd, "meta-delta", "true");
+  _nns_edge_cmd_set_codec_options (&cmd);
+  if (resumed) {
+    _nns_edge_cmd_set_option (&cmd, "caps-resumed", "true");
+  } else {
     cmd.info.num = 1;
     cmd.info.mem_size[0] = strlen (eh->caps_str) + 1;
     cmd.mem[0] = eh->caps_str;
+  }
 
-    ret = _nns_edge_cmd_send (conn, &cmd);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to send capability.");
-      goto error;
-    }
+  ret = _nns_edge_cmd_send (conn, &cmd);
+  nns_edge_free (cmd.meta);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to send capability.");
+    goto done;
   }
 
-  if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type) {
-    /* Receive host info from destination. */
-    _nns_edge_cmd_init (&cmd, _NNS_EDGE_CMD_ERROR, client_id);
-    ret = _nns_edge_cmd_receive (conn, &cmd);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_loge ("Failed to receive node info.");
-      goto error;
-    }
+  /* The publisher also receives host info, to get the options of subscriber. */
+  if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type ||
+      NNS_EDGE_NODE_TYPE_PUB == eh->node_type) {
+    if (host_cmd.info.cmd != _NNS_EDGE_CMD_HOST_INFO) {
+      /* Receive host info from destination. */
+      ret = _nns_edge_cmd_receive (conn, &host_cmd);
+      if (ret != NNS_EDGE_ERROR_NONE) {
+        nns_edge_loge ("Failed to receive node info.");
+        goto done;
+      }
 
-    if (cmd.info.cmd != _NNS_EDGE_CMD_HOST_INFO) {
-      nns_edge_loge ("Failed to get host info.");
-      _nns_edge_cmd_clear (&cmd);
-      goto error;
+      if (host_cmd.info.cmd != _NNS_EDGE_CMD_HOST_INFO) {
+        nns_edge_loge ("Failed to get host info.");
+        ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+        goto done;
+      }
     }
+  }
 
-    nns_edge_parse_host_string (cmd.mem[0], &dest_host, &dest_port);
-    _nns_edge_cmd_clear (&cmd);
+  if (NNS_EDGE_NODE_TYPE_PUB == eh->node_type) {
+    _nns_edge_conn_set_meta_delta (conn, &host_cmd);
+    _nns_edge_conn_set_codec (eh, conn, &host_cmd);
+  } else if (NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type) {
+    nns_edge_parse_host_string (host_cmd.mem[0], &dest_host, &dest_port);
 
     /* Connect to client listener. */
-    ret = _nns_edge_connect_to (eh, client_id, dest_host, dest_port);
-    if (ret != NNS_EDGE_ERROR_NONE) {
+    hs->sink_conn = _nns_edge_create_connection (eh, dest_host, dest_port);
+    if (!hs->sink_conn) {
+      ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+      goto done;
+    }
+
+    /* Connect within the remaining time of the handshake. */
+    if (conn->deadline > 0) {
+      remaining = _get_remaining_time (conn->deadline);
+      if (remaining <= 0) {
+        nns_edge_loge ("The deadline of the handshake is passed.");
+        ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+        goto done;
+      }
+    }
+
+    if (!_nns_edge_connect_socket (hs->sink_conn, (unsigned int) remaining,
+            false)) {
       nns_edge_loge ("Failed to connect host %s:%d.", dest_host, dest_port);
-      goto error;
+      ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
+      goto done;
     }
+
+    _nns_edge_conn_set_meta_delta (hs->sink_conn, &host_cmd);
+    _nns_edge_conn_set_codec (eh, hs->sink_conn, &host_cmd);
   }
 
-  conn_data = _nns_edge_add_connection (eh, client_id);
+done:
+  conn->deadline = 0;
+  _nns_edge_cmd_clear (&host_cmd);
+  SAFE_FREE (client_hash);
+  SAFE_FREE (dest_host);
+  return ret;
+}
+
+/**
+ * @brief Handshake worker thread, pop the accepted socket and exchange the node info.
+ */
+static void *
+_nns_edge_handshake_thread (void *thread_data)
+{
+  nns_edge_handle_s *eh = (nns_edge_handle_s *) thread_data;
+  nns_edge_handshake_s *hs;
+  nns_size_t size;
+
+  while (eh->listening) {
+    /* Wake up periodically to check the listener state. */
+    if (NNS_EDGE_ERROR_NONE != nns_edge_queue_wait_pop (eh->accept_queue, 100U,
+            (void **) &hs, &size))
+      continue;
+
+    if (!eh->listening) {
+      _nns_edge_release_handshake (hs);
+      break;
+    }
+
+    if (NNS_EDGE_ERROR_NONE != _nns_edge_handshake (eh, hs)) {
+      nns_edge_loge ("Failed to handshake with the accepted socket.");
+      _nns_edge_release_handshake (hs);
+      continue;
+    }
+
+    if (NNS_EDGE_ERROR_NONE != nns_edge_queue_push (eh->ready_queue, hs,
+            sizeof (nns_edge_handshake_s), _nns_edge_release_handshake)) {
+      nns_edge_loge ("Failed to push the accepted socket into ready queue.");
+      _nns_edge_release_handshake (hs);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Register the connections of accepted socket and create message thread.
+ * @note This is called in socket listener thread only, so that the connection table has single writer.
+ */
+static void
+_nns_edge_register_connection (nns_edge_handle_s * eh,
+    nns_edge_handshake_s * hs)
+{
+  nns_edge_conn_data_s *conn_data;
+  int ret;
+
+  conn_data = _nns_edge_add_connection (eh, hs->client_id);
   if (!conn_data) {
     nns_edge_loge ("Failed to add client connection.");
     goto error;
   }
 
+  if (hs->sink_conn) {
+    _nns_edge_close_connection (conn_data->sink_conn);
+    conn_data->sink_conn = hs->sink_conn;
+    hs->sink_conn = NULL;
+  }
+
   /* Close old connection and set new one for each node type. */
   if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT ||
       eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_SERVER) {
-    ret = _nns_edge_create_message_thread (eh, conn, client_id);
+    ret = _nns_edge_create_message_thread (eh, hs->conn, hs->client_id);
     if (ret != NNS_EDGE_ERROR_NONE) {
       nns_edge_loge ("Failed to create message handle thread.");
       goto error;
     }
     _nns_edge_close_connection (conn_data->src_conn);
-    conn_data->src_conn = conn;
+    conn_data->src_conn = hs->conn;
   } else {
     _nns_edge_close_connection (conn_data->sink_conn);
-    conn_data->sink_conn = conn;
+    conn_data->sink_conn = hs->conn;
   }
 
-  done = true;
+  hs->conn = NULL;
 
 error:
-  if (!done)
+  _nns_edge_release_handshake (hs);
+}
+
+/**
+ * @brief Accept socket in socket listener thread. The handshake is done in the worker thread.
+ */
+static void
+_nns_edge_accept_socket (nns_edge_handle_s * eh, int listener_fd)
+{
+  nns_edge_handshake_s *hs;
+  nns_edge_conn_s *conn;
+
+  hs = (nns_edge_handshake_s *) nns_edge_calloc (1,
+      sizeof (nns_edge_handshake_s));
+  conn = _nns_edge_create_connection (eh, NULL, 0);
+  if (!hs || !conn) {
+    nns_edge_loge ("Failed to allocate edge connection.");
+    SAFE_EDGE_FREE (hs);
     _nns_edge_close_connection (conn);
+    return;
+  }
 
-  SAFE_FREE (dest_host);
+  hs->conn = conn;
+  conn->sockfd = accept (listener_fd, NULL, NULL);
+  if (conn->sockfd < 0) {
+    nns_edge_loge ("Failed to accept socket.");
+    goto error;
+  }
+
+  _set_socket_option (conn->sockfd);
+
+  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
+      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
+    hs->client_id = nns_edge_generate_id ();
+
+    /* Pass the socket to handshake worker, slow peer should not block the listener. */
+    if (NNS_EDGE_ERROR_NONE != nns_edge_queue_push (eh->accept_queue, hs,
+            sizeof (nns_edge_handshake_s), _nns_edge_release_handshake)) {
+      nns_edge_loge ("Failed to push the accepted socket into queue.");
+      goto error;
+    }
+  } else {
+    /* Query client does not exchange node info with accepted socket. */
+    hs->client_id = eh->client_id;
+    _nns_edge_register_connection (eh, hs);
+  }
+
+  return;
+
+error:
+  _nns_edge_release_handshake (hs);
 }
 
 /**
@@ -1149,13 +3517,15 @@ error:
 static void *
 _nns_edge_socket_listener_thread (void *thread_data)
 {
-  nns_edge_handle_s *eh = (nns_edge_handle_s *) thread_data;
+  nns_edge_listener_s *listener = (nns_edge_listener_s *) thread_data;
+  nns_edge_handle_s *eh = listener->eh;
+  nns_edge_handshake_s *hs;
+  nns_size_t size;
 
-  eh->listening = true;
   while (eh->listening) {
     struct pollfd poll_fd;
 
-    poll_fd.fd = eh->listener_fd;
+    poll_fd.fd = listener->fd;
     poll_fd.events = POLLIN | POLLHUP | POLLERR;
     poll_fd.revents = 0;
 
@@ -1170,16 +3540,127 @@ _nns_edge_socket_listener_thread (void *thread_data)
       }
 
       if (poll_fd.revents & POLLIN)
-        _nns_edge_accept_socket (eh);
+        _nns_edge_accept_socket (eh, listener->fd);
     }
+
+    /**
+     * Register the connections which completed the handshake.
+     * Only the first listener updates the connection table.
+     */
+    while (listener->index == 0U && eh->listening && NNS_EDGE_ERROR_NONE ==
+        nns_edge_queue_pop (eh->ready_queue, (void **) &hs, &size))
+      _nns_edge_register_connection (eh, hs);
   }
-  eh->listening = false;
 
   return NULL;
 }
 
 /**
- * @brief Create socket listener.
+ * @brief Stop socket listeners and handshake workers.
+ * @note This function should be called with handle lock.
+ */
+static void
+_nns_edge_stop_socket_listener (nns_edge_handle_s * eh)
+{
+  nns_edge_listener_s *listeners;
+  unsigned int i;
+
+  eh->listening = false;
+  listeners = (nns_edge_listener_s *) eh->listeners;
+
+  if (listeners) {
+    for (i = 0; i < eh->listeners_len; i++) {
+      if (listeners[i].thread) {
+        pthread_join (listeners[i].thread, NULL);
+        listeners[i].thread = 0;
+      }
+    }
+  }
+
+  if (eh->handshake_threads) {
+    nns_edge_queue_clear (eh->accept_queue);
+
+    for (i = 0; i < eh->handshake_workers; i++) {
+      if (eh->handshake_threads[i])
+        pthread_join (eh->handshake_threads[i], NULL);
+    }
+
+    SAFE_EDGE_FREE (eh->handshake_threads);
+  }
+
+  nns_edge_queue_clear (eh->accept_queue);
+  nns_edge_queue_clear (eh->ready_queue);
+
+  if (listeners) {
+    for (i = 0; i < eh->listeners_len; i++) {
+      if (listeners[i].fd >= 0)
+        close (listeners[i].fd);
+    }
+
+    SAFE_EDGE_FREE (eh->listeners);
+    eh->listeners_len = 0U;
+  }
+}
+
+/**
+ * @brief Open listener socket and bind it to the address.
+ */
+static int
+_nns_edge_open_listener_socket (struct sockaddr_in *saddr, bool reuse_port,
+    int backlog, bool fast_open)
+{
+  socklen_t saddr_len = sizeof (struct sockaddr_in);
+  int fd;
+
+  fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) {
+    nns_edge_loge ("Failed to create listener socket.");
+    return -1;
+  }
+
+#ifdef SO_REUSEPORT
+  if (reuse_port) {
+    int reuse = 1;
+
+    /* The kernel distributes incoming connections among the sockets bound to same port. */
+    if (setsockopt (fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof (int)) < 0) {
+      nns_edge_loge ("Failed to create listener, cannot set reuse-port option.");
+      goto error;
+    }
+  }
+#endif
+
+  if (bind (fd, (struct sockaddr *) saddr, saddr_len) < 0) {
+    nns_edge_loge ("Failed to create listener, cannot bind socket.");
+    goto error;
+  }
+
+#ifdef TCP_FASTOPEN
+  if (fast_open) {
+    int qlen = N_FASTOPEN_QUEUE;
+
+    /* Accept the data in SYN packet. Normal handshake is used if the kernel does not allow it. */
+    if (setsockopt (fd, IPPROTO_TCP, TCP_FASTOPEN, &qlen, sizeof (int)) < 0)
+      nns_edge_logd ("Failed to set TCP fast open of listener socket.");
+  }
+#else
+  UNUSED (fast_open);
+#endif
+
+  if (listen (fd, backlog) < 0) {
+    nns_edge_loge ("Failed to create listener, cannot listen socket.");
+    goto error;
+  }
+
+  return fd;
+
+error:
+  close (fd);
+  return -1;
+}
+
+/**
+ * @brief Create socket listeners.
  * @note This function should be called with handle lock.
  */
 static bool
@@ -1187,7 +3668,8 @@ _nns_edge_create_socket_listener (nns_edge_handle_s * eh)
 {
   bool done = false;
   struct sockaddr_in saddr = { 0 };
-  socklen_t saddr_len = sizeof (struct sockaddr_in);
+  nns_edge_listener_s *listeners;
+  unsigned int i, num;
   int status;
 
   if (!_fill_socket_addr (&saddr, eh->host, eh->port)) {
@@ -1195,39 +3677,81 @@ _nns_edge_create_socket_listener (nns_edge_handle_s * eh)
     return false;
   }
 
-  eh->listener_fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
-  if (eh->listener_fd < 0) {
-    nns_edge_loge ("Failed to create listener socket.");
+  /* Query client accepts the connection from the server only, single listener is enough. */
+  num = 1U;
+  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
+      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
+#ifdef SO_REUSEPORT
+    num = eh->listener_num;
+#else
+    if (eh->listener_num > 1U)
+      nns_edge_logw ("SO_REUSEPORT is not supported, use single listener.");
+#endif
+  }
+
+  listeners = (nns_edge_listener_s *) nns_edge_calloc (num,
+      sizeof (nns_edge_listener_s));
+  if (!listeners) {
+    nns_edge_loge ("Failed to allocate socket listeners.");
     return false;
   }
 
-  if (bind (eh->listener_fd, (struct sockaddr *) &saddr, saddr_len) < 0) {
-    nns_edge_loge ("Failed to create listener, cannot bind socket.");
-    goto error;
+  for (i = 0; i < num; i++) {
+    listeners[i].eh = eh;
+    listeners[i].index = i;
+    listeners[i].fd = -1;
   }
 
-  if (listen (eh->listener_fd, N_BACKLOG) < 0) {
-    nns_edge_loge ("Failed to create listener, cannot listen socket.");
-    goto error;
+  eh->listeners = listeners;
+  eh->listeners_len = num;
+
+  for (i = 0; i < num; i++) {
+    listeners[i].fd = _nns_edge_open_listener_socket (&saddr, (num > 1U),
+        eh->backlog, eh->fast_reconnect);
+    if (listeners[i].fd < 0)
+      goto error;
   }
 
-  status = pthread_create (&eh->listener_thread, NULL,
-      _nns_edge_socket_listener_thread, eh);
+  eh->listening = true;
 
-  if (status != 0) {
-    nns_edge_loge ("Failed to create listener thread.");
-    eh->listening = false;
-    eh->listener_thread = 0;
-    goto error;
+  if ((NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type)
+      || (NNS_EDGE_NODE_TYPE_PUB == eh->node_type)) {
+    eh->handshake_threads =
+        (pthread_t *) nns_edge_calloc (eh->handshake_workers,
+        sizeof (pthread_t));
+    if (!eh->handshake_threads) {
+      nns_edge_loge ("Failed to allocate handshake workers.");
+      goto error;
+    }
+
+    for (i = 0; i < eh->handshake_workers; i++) {
+      status = pthread_create (&eh->handshake_threads[i], NULL,
+          _nns_edge_handshake_thread, eh);
+
+      if (status != 0) {
+        nns_edge_loge ("Failed to create handshake worker.");
+        eh->handshake_threads[i] = 0;
+        goto error;
+      }
+    }
+  }
+
+  for (i = 0; i < num; i++) {
+    status = pthread_create (&listeners[i].thread, NULL,
+        _nns_edge_socket_listener_thread, &listeners[i]);
+
+    if (status != 0) {
+      nns_edge_loge ("Failed to create listener thread.");
+      listeners[i].thread = 0;
+      goto error;
+    }
   }
 
   done = true;
 
 error:
-  if (!done) {
-    close (eh->listener_fd);
-    eh->listener_fd = -1;
-  }
+  if (!done)
+    _nns_edge_stop_socket_listener (eh);
 
   return done;
 }
@@ -1261,7 +3785,7 @@ nns_edge_create_handle (const char *id, nns_edge_connect_type_e connect_type,
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  eh = (nns_edge_handle_s *) calloc (1, sizeof (nns_edge_handle_s));
+  eh = (nns_edge_handle_s *) nns_edge_calloc (1, sizeof (nns_edge_handle_s));
   if (!eh) {
     nns_edge_loge ("Failed to allocate memory for edge handle.");
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -1283,12 +3807,56 @@ nns_edge_create_handle (const char *id, nns_edge_connect_type_e connect_type,
   eh->connections = NULL;
   eh->listening = false;
   eh->sending = false;
-  eh->listener_fd = -1;
+  eh->backlog = N_BACKLOG;
+  eh->listener_num = 1U;
+  eh->handshake_workers = N_HANDSHAKE_WORKERS;
+  eh->handshake_timeout = DEFAULT_HANDSHAKE_TIMEOUT;
+  eh->connect_timeout = DEFAULT_CONNECT_TIMEOUT;
+  eh->fast_reconnect = false;
+  eh->data_alignment = 0U;
+  eh->codec = NULL;
+  eh->codec_threshold = DEFAULT_CODEC_THRESHOLD;
+  eh->codec_filter = NNS_EDGE_CODEC_FILTER_NONE;
+  eh->codec_element_size = DEFAULT_CODEC_ELEMENT_SIZE;
+  eh->wire_precision = NNS_EDGE_CODEC_PRECISION_NONE;
+  eh->restore_precision = true;
+  eh->delta = false;
+  eh->delta_keyframe = DEFAULT_DELTA_KEYFRAME;
+  eh->batch_size = 0U;
+  eh->batch_timeout = DEFAULT_BATCH_TIMEOUT;
+  eh->batching = false;
+  eh->lb_policy = NNS_EDGE_REQUEST_POLICY_NONE;
+  eh->lb_eject_failures = NNS_EDGE_REQUEST_EJECT_FAILURES;
+  eh->lb_eject_time = NNS_EDGE_REQUEST_EJECT_TIME;
+  eh->lb_targets = NULL;
+  eh->lb_targets_len = 0U;
+  eh->hedge_percentile = 0U;
+  eh->hedging = false;
+  eh->request_timeout = 0U;
+  memset (&eh->codec_stats, 0, sizeof (nns_edge_codec_stats_s));
   eh->caps_str = nns_edge_strdup ("");
 
-  ret = nns_edge_metadata_create (&eh->metadata);
+  ret = nns_edge_metadata_create (&eh->metadata);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to create edge metadata.");
+    goto error;
+  }
+
+  ret = nns_edge_metadata_create (&eh->caps_cache);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to create capability cache.");
+    goto error;
+  }
+
+  ret = nns_edge_pool_create (&eh->pool);
+  if (ret != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Failed to create edge pool.");
+    goto error;
+  }
+
+  ret = nns_edge_request_create (&eh->requests);
   if (ret != NNS_EDGE_ERROR_NONE) {
-    nns_edge_loge ("Failed to create edge metadata.");
+    nns_edge_loge ("Failed to create the table of requests.");
     goto error;
   }
 
@@ -1298,6 +3866,24 @@ nns_edge_create_handle (const char *id, nns_edge_connect_type_e connect_type,
     goto error;
   }
 
+  ret = nns_edge_queue_create (&eh->batch_queue);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to create queue for the batch of requests.");
+    goto error;
+  }
+
+  ret = nns_edge_queue_create (&eh->accept_queue);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to create queue for accepted socket.");
+    goto error;
+  }
+
+  ret = nns_edge_queue_create (&eh->ready_queue);
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to create queue for connected socket.");
+    goto error;
+  }
+
   if (NNS_EDGE_CONNECT_TYPE_AITT == connect_type) {
     ret = nns_edge_aitt_create (&eh->broker_h);
     if (NNS_EDGE_ERROR_NONE != ret) {
@@ -1414,9 +4000,21 @@ nns_edge_start (nns_edge_h edge_h)
       goto done;
     }
 
+    /* The send thread also sends the duplicated requests to other servers. */
+    if (eh->hedge_percentile > 0U) {
+      if (eh->lb_policy == NNS_EDGE_REQUEST_POLICY_NONE)
+        nns_edge_logw ("The request is sent to all servers, HEDGE_PERCENTILE is ignored.");
+      else
+        eh->hedging = true;
+    }
+
     ret = _nns_edge_create_send_thread (eh);
   }
 
+  if (NNS_EDGE_ERROR_NONE == ret &&
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER == eh->node_type && eh->batch_size > 0U)
+    ret = _nns_edge_create_batch_thread (eh);
+
 done:
   eh->is_started = (ret == NNS_EDGE_ERROR_NONE);
   nns_edge_unlock (eh);
@@ -1476,31 +4074,39 @@ nns_edge_release_handle (nns_edge_h edge_h)
   nns_edge_queue_destroy (eh->send_queue);
   eh->send_queue = NULL;
 
-  if (eh->listener_thread) {
-    eh->listening = false;
-    pthread_join (eh->listener_thread, NULL);
-    eh->listener_thread = 0;
-  }
-
-  if (eh->listener_fd >= 0) {
-    close (eh->listener_fd);
-    eh->listener_fd = -1;
-  }
+  _nns_edge_stop_socket_listener (eh);
+  nns_edge_queue_destroy (eh->accept_queue);
+  eh->accept_queue = NULL;
+  nns_edge_queue_destroy (eh->ready_queue);
+  eh->ready_queue = NULL;
 
   _nns_edge_remove_all_connection (eh);
 
+  /* Message threads are stopped, no more requests are pushed into the batch. */
+  _nns_edge_stop_batch_thread (eh);
+  nns_edge_queue_destroy (eh->batch_queue);
+  eh->batch_queue = NULL;
+
   nns_edge_metadata_destroy (eh->metadata);
   eh->metadata = NULL;
+  nns_edge_metadata_destroy (eh->caps_cache);
+  eh->caps_cache = NULL;
+  nns_edge_pool_destroy (eh->pool);
+  eh->pool = NULL;
+  nns_edge_request_destroy (eh->requests);
+  eh->requests = NULL;
   SAFE_FREE (eh->id);
   SAFE_FREE (eh->topic);
   SAFE_FREE (eh->host);
   SAFE_FREE (eh->dest_host);
   SAFE_FREE (eh->caps_str);
+  SAFE_FREE (eh->codec);
+  SAFE_EDGE_FREE (eh->lb_targets);
 
   nns_edge_unlock (eh);
   nns_edge_cond_destroy (eh);
   nns_edge_lock_destroy (eh);
-  SAFE_FREE (eh);
+  SAFE_EDGE_FREE (eh);
 
   return NNS_EDGE_ERROR_NONE;
 }
@@ -1549,6 +4155,8 @@ nns_edge_set_event_callback (nns_edge_h edge_h, nns_edge_event_cb cb,
 static int
 _mqtt_hybrid_direct_connection (nns_edge_handle_s * eh)
 {
+  nns_edge_conn_s *conns[N_CONNECT_CANDIDATES];
+  unsigned int num;
   int ret;
 
   do {
@@ -1557,23 +4165,37 @@ _mqtt_hybrid_direct_connection (nns_edge_handle_s * eh)
     int server_port = 0;
     nns_size_t msg_len = 0;
 
-    ret =
-        nns_edge_mqtt_get_message (eh->broker_h, (void **) &msg, &msg_len, 0U);
-    if (ret != NNS_EDGE_ERROR_NONE || !msg || msg_len == 0)
-      break;
+    /**
+     * Wait for the first server info, and then gather the candidates already received.
+     * All candidates are raced to find available server.
+     */
+    num = 0U;
+    ret = nns_edge_mqtt_get_message (eh->broker_h, (void **) &msg, &msg_len, 0U);
+
+    while (ret == NNS_EDGE_ERROR_NONE && msg && msg_len > 0) {
+      nns_edge_parse_host_string (msg, &server_ip, &server_port);
+      nns_edge_free (msg);
 
-    nns_edge_parse_host_string (msg, &server_ip, &server_port);
-    SAFE_FREE (msg);
+      nns_edge_logd ("Parsed server info: Server [%s:%d] ", server_ip,
+          server_port);
 
-    nns_edge_logd ("Parsed server info: Server [%s:%d] ", server_ip,
-        server_port);
+      conns[num] = _nns_edge_create_connection (eh, server_ip, server_port);
+      SAFE_FREE (server_ip);
 
-    ret = _nns_edge_connect_to (eh, eh->client_id, server_ip, server_port);
-    SAFE_FREE (server_ip);
+      if (conns[num] && ++num >= N_CONNECT_CANDIDATES)
+        break;
+
+      ret = nns_edge_mqtt_get_message (eh->broker_h, (void **) &msg, &msg_len,
+          10U);
+    }
 
-    if (NNS_EDGE_ERROR_NONE == ret)
+    if (num == 0U) {
+      ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
       break;
-  } while (TRUE);
+    }
+
+    ret = _nns_edge_connect_candidates (eh, eh->client_id, conns, num);
+  } while (NNS_EDGE_ERROR_NONE != ret);
 
   return ret;
 }
@@ -1651,7 +4273,9 @@ nns_edge_connect (nns_edge_h edge_h, const char *dest_host, int dest_port)
     return NNS_EDGE_ERROR_CONNECTION_FAILURE;
   }
 
-  if (NNS_EDGE_ERROR_NONE == nns_edge_is_connected (eh)) {
+  /* Query client balancing the requests can connect to many servers. */
+  if (eh->lb_policy == NNS_EDGE_REQUEST_POLICY_NONE &&
+      NNS_EDGE_ERROR_NONE == nns_edge_is_connected (eh)) {
     nns_edge_logi ("NNStreamer-edge is already connected.");
     nns_edge_unlock (eh);
     return NNS_EDGE_ERROR_NONE;
@@ -1698,10 +4322,18 @@ nns_edge_connect (nns_edge_h edge_h, const char *dest_host, int dest_port)
       nns_edge_loge ("Failed to subscribe the topic using AITT: %s", eh->topic);
       goto done;
     }
+  } else if (eh->lb_policy != NNS_EDGE_REQUEST_POLICY_NONE &&
+      _nns_edge_is_connected_to (eh, dest_host, dest_port)) {
+    nns_edge_logi ("NNStreamer-edge is already connected to %s:%d.",
+        dest_host, dest_port);
+    ret = NNS_EDGE_ERROR_NONE;
   } else {
     ret = _nns_edge_connect_to (eh, eh->client_id, dest_host, dest_port);
     if (ret != NNS_EDGE_ERROR_NONE) {
       nns_edge_loge ("Failed to connect to %s:%d", dest_host, dest_port);
+    } else if (eh->lb_policy != NNS_EDGE_REQUEST_POLICY_NONE &&
+        !_nns_edge_wait_server_connection (eh, eh->client_id)) {
+      ret = NNS_EDGE_ERROR_CONNECTION_FAILURE;
     }
   }
 
@@ -1776,6 +4408,67 @@ nns_edge_is_connected (nns_edge_h edge_h)
   return NNS_EDGE_ERROR_CONNECTION_FAILURE;
 }
 
+/**
+ * @brief Internal function to push the copy of data into send-queue.
+ * @param[out] request_id If given, the request is added before pushing the data, to wait for the response.
+ * @param[in] timeout_ms The time the request of query client is expired. 0 if the request is not expired.
+ * @note This function should be called with handle lock.
+ */
+static int
+_nns_edge_push_data (nns_edge_handle_s * eh, nns_edge_data_h data_h,
+    uint32_t * request_id, unsigned int timeout_ms)
+{
+  int ret = NNS_EDGE_ERROR_NONE;
+  nns_edge_data_h new_data_h;
+  uint32_t id = 0U;
+
+  if (NNS_EDGE_ERROR_NONE != nns_edge_is_connected (eh)) {
+    nns_edge_loge ("There is no available connection.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  if (!eh->send_thread) {
+    nns_edge_loge ("Invalid state, start edge before sending a data.");
+    return NNS_EDGE_ERROR_IO;
+  }
+
+  /* Query client identifies the request, to match the response received out of order. */
+  if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+    id = nns_edge_request_new_id (eh->requests);
+    nns_edge_data_set_info_int64 (data_h, "request_id", id);
+  }
+
+  if (request_id) {
+    ret = nns_edge_request_add_waiting (eh->requests, id);
+    if (NNS_EDGE_ERROR_NONE != ret)
+      return ret;
+
+    *request_id = id;
+  }
+
+  /* Create new data handle and push it into send-queue. */
+  ret = nns_edge_data_copy (data_h, &new_data_h);
+  if (NNS_EDGE_ERROR_NONE == ret) {
+    /* The deadline is always updated, the data may have the deadline of other request. */
+    if (eh->node_type == NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+      nns_edge_data_set_info_int64 (new_data_h, "deadline", (timeout_ms > 0U) ?
+          nns_edge_get_monotonic_time () + (int64_t) timeout_ms * 1000 : 0);
+    }
+
+    ret = nns_edge_queue_push (eh->send_queue, new_data_h,
+        sizeof (nns_edge_data_h), nns_edge_data_release_handle);
+  }
+
+  if (NNS_EDGE_ERROR_NONE != ret) {
+    nns_edge_loge ("Failed to send data, cannot push data into queue.");
+
+    if (request_id)
+      nns_edge_request_remove (eh->requests, id);
+  }
+
+  return ret;
+}
+
 /**
  * @brief Send data to desination (broker or connected node), asynchronously.
  */
@@ -1784,7 +4477,6 @@ nns_edge_send (nns_edge_h edge_h, nns_edge_data_h data_h)
 {
   int ret = NNS_EDGE_ERROR_NONE;
   nns_edge_handle_s *eh;
-  nns_edge_data_h new_data_h;
 
   eh = (nns_edge_handle_s *) edge_h;
   if (!eh) {
@@ -1803,28 +4495,70 @@ nns_edge_send (nns_edge_h edge_h, nns_edge_data_h data_h)
   }
 
   nns_edge_lock (eh);
+  ret = _nns_edge_push_data (eh, data_h, NULL, eh->request_timeout);
+  nns_edge_unlock (eh);
 
-  if (NNS_EDGE_ERROR_NONE != nns_edge_is_connected (eh)) {
-    nns_edge_loge ("There is no available connection.");
+  return ret;
+}
+
+/**
+ * @brief Send the request to query server and wait for its response.
+ */
+int
+nns_edge_query (nns_edge_h edge_h, nns_edge_data_h request_h,
+    nns_edge_data_h * response_h, unsigned int timeout_ms)
+{
+  int ret = NNS_EDGE_ERROR_NONE;
+  nns_edge_handle_s *eh;
+  uint32_t request_id = 0U;
+
+  eh = (nns_edge_handle_s *) edge_h;
+  if (!eh) {
+    nns_edge_loge ("Invalid param, given edge handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (nns_edge_data_is_valid (request_h) != NNS_EDGE_ERROR_NONE) {
+    nns_edge_loge ("Invalid param, given edge data is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!response_h) {
+    nns_edge_loge ("Invalid param, response_h should not be null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (eh)) {
+    nns_edge_loge ("Invalid param, given edge handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  *response_h = NULL;
+
+  nns_edge_lock (eh);
+
+  if (eh->node_type != NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+    nns_edge_loge ("Invalid param, only query client can send the query.");
     nns_edge_unlock (eh);
-    return NNS_EDGE_ERROR_IO;
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  if (!eh->send_thread) {
-    nns_edge_loge ("Invalid state, start edge before sending a data.");
+  if (eh->connect_type != NNS_EDGE_CONNECT_TYPE_TCP &&
+      eh->connect_type != NNS_EDGE_CONNECT_TYPE_HYBRID) {
+    nns_edge_loge ("The connection type does not support the query.");
     nns_edge_unlock (eh);
-    return NNS_EDGE_ERROR_IO;
+    return NNS_EDGE_ERROR_NOT_SUPPORTED;
   }
 
-  /* Create new data handle and push it into send-queue. */
-  nns_edge_data_copy (data_h, &new_data_h);
+  ret = _nns_edge_push_data (eh, request_h, &request_id,
+      (timeout_ms > 0U) ? timeout_ms : eh->request_timeout);
+  nns_edge_unlock (eh);
 
-  ret = nns_edge_queue_push (eh->send_queue, new_data_h,
-      sizeof (nns_edge_data_h), nns_edge_data_release_handle);
-  if (NNS_EDGE_ERROR_NONE != ret)
-    nns_edge_loge ("Failed to send data, cannot push data into queue.");
+  /* Wait without handle lock, other threads can send the requests. */
+  if (NNS_EDGE_ERROR_NONE == ret)
+    ret = nns_edge_request_wait (eh->requests, request_id, timeout_ms,
+        response_h);
 
-  nns_edge_unlock (eh);
   return ret;
 }
 
@@ -1889,7 +4623,10 @@ nns_edge_set_info (nns_edge_h edge_h, const char *key, const char *value)
   } else if (0 == strcasecmp (key, "TOPIC")) {
     SAFE_FREE (eh->topic);
     eh->topic = nns_edge_strdup (value);
-  } else if (0 == strcasecmp (key, "ID") || 0 == strcasecmp (key, "CLIENT_ID")) {
+  } else if (0 == strcasecmp (key, "ID") || 0 == strcasecmp (key, "CLIENT_ID") ||
+      0 == strcasecmp (key, "POOL_STATS") ||
+      0 == strcasecmp (key, "CODEC_STATS") ||
+      0 == strcasecmp (key, "OUTSTANDING_REQUESTS")) {
     /* Not allowed key */
     nns_edge_loge ("Cannot update %s.", key);
     ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
@@ -1918,6 +4655,227 @@ nns_edge_set_info (nns_edge_h edge_h, const char *key, const char *value)
     }
 
     nns_edge_queue_set_limit (eh->send_queue, limit, leaky);
+  } else if (0 == strcasecmp (key, "BACKLOG")) {
+    int backlog = (int) strtol (value, NULL, 10);
+
+    if (backlog <= 0) {
+      nns_edge_loge ("Invalid param, the backlog should be larger than 0.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->backlog = backlog;
+    }
+  } else if (0 == strcasecmp (key, "LISTENERS")) {
+    unsigned int num = (unsigned int) strtoul (value, NULL, 10);
+
+    if (num == 0U) {
+      nns_edge_loge ("Invalid param, the number of listeners should be larger than 0.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->listener_num = num;
+    }
+  } else if (0 == strcasecmp (key, "CONNECT_TIMEOUT")) {
+    eh->connect_timeout = (unsigned int) strtoul (value, NULL, 10);
+  } else if (0 == strcasecmp (key, "HANDSHAKE_TIMEOUT")) {
+    eh->handshake_timeout = (unsigned int) strtoul (value, NULL, 10);
+  } else if (0 == strcasecmp (key, "HANDSHAKE_WORKERS")) {
+    unsigned int workers = (unsigned int) strtoul (value, NULL, 10);
+
+    if (workers == 0U) {
+      nns_edge_loge ("Invalid param, the number of handshake workers should be larger than 0.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->handshake_workers = workers;
+    }
+  } else if (0 == strcasecmp (key, "DATA_POOL_SIZE")) {
+    ret = nns_edge_pool_set_data_limit (eh->pool,
+        (unsigned int) strtoul (value, NULL, 10));
+  } else if (0 == strcasecmp (key, "BUFFER_POOL_SIZE")) {
+    ret = nns_edge_pool_set_buffer_limit (eh->pool,
+        (nns_size_t) strtoull (value, NULL, 10));
+  } else if (0 == strcasecmp (key, "FAST_RECONNECT")) {
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->fast_reconnect = (0 == strcasecmp (value, "true"));
+    }
+  } else if (0 == strcasecmp (key, "DATA_ALIGNMENT")) {
+    nns_size_t alignment = (nns_size_t) strtoull (value, NULL, 10);
+
+    if (!nns_edge_data_alignment_is_valid (alignment)) {
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->data_alignment = alignment;
+    }
+  } else if (0 == strcasecmp (key, "CODEC")) {
+    nns_edge_codec_s codec;
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (0 == strcasecmp (value, "none")) {
+      SAFE_FREE (eh->codec);
+    } else if (nns_edge_codec_find (value, &codec) != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Invalid param, the codec '%s' is not registered.", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      SAFE_FREE (eh->codec);
+      eh->codec = nns_edge_strdup (value);
+    }
+  } else if (0 == strcasecmp (key, "CODEC_THRESHOLD")) {
+    eh->codec_threshold = (nns_size_t) strtoull (value, NULL, 10);
+  } else if (0 == strcasecmp (key, "CODEC_FILTER")) {
+    if (0 == strcasecmp (value, "none")) {
+      eh->codec_filter = NNS_EDGE_CODEC_FILTER_NONE;
+    } else if (0 == strcasecmp (value, "shuffle")) {
+      eh->codec_filter = NNS_EDGE_CODEC_FILTER_SHUFFLE;
+    } else {
+      nns_edge_loge ("Invalid param, unknown filter '%s'.", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+  } else if (0 == strcasecmp (key, "WIRE_PRECISION")) {
+    nns_edge_codec_precision_e precision = nns_edge_codec_get_precision (value);
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (precision == NNS_EDGE_CODEC_PRECISION_MAX) {
+      nns_edge_loge ("Invalid param, unknown precision '%s'.", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->wire_precision = precision;
+    }
+  } else if (0 == strcasecmp (key, "RESTORE_PRECISION")) {
+    eh->restore_precision = (0 == strcasecmp (value, "true"));
+  } else if (0 == strcasecmp (key, "DELTA")) {
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->delta = (0 == strcasecmp (value, "true"));
+    }
+  } else if (0 == strcasecmp (key, "DELTA_KEYFRAME")) {
+    unsigned long interval = strtoul (value, NULL, 10);
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (interval == 0UL || interval > UINT_MAX) {
+      nns_edge_loge ("Invalid param, the interval of keyframes should be larger than 0.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->delta_keyframe = (unsigned int) interval;
+    }
+  } else if (0 == strcasecmp (key, "LB_POLICY")) {
+    nns_edge_request_policy_e policy = nns_edge_request_get_policy (value);
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (eh->node_type != NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+      nns_edge_loge ("Invalid param, only query client balances the requests.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (policy == NNS_EDGE_REQUEST_POLICY_MAX) {
+      nns_edge_loge ("Invalid param, unknown policy '%s'.", value);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->lb_policy = policy;
+    }
+  } else if (0 == strcasecmp (key, "LB_EJECT_FAILURES")) {
+    unsigned long failures = strtoul (value, NULL, 10);
+
+    if (failures == 0UL || failures > UINT_MAX) {
+      nns_edge_loge ("Invalid param, the number of failures should be larger than 0.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->lb_eject_failures = (unsigned int) failures;
+      ret = nns_edge_request_set_ejection (eh->requests,
+          eh->lb_eject_failures, eh->lb_eject_time);
+    }
+  } else if (0 == strcasecmp (key, "LB_EJECT_TIME")) {
+    unsigned long eject_time = strtoul (value, NULL, 10);
+
+    if (eject_time > UINT_MAX) {
+      nns_edge_loge ("Invalid param, the time to eject the server is too large.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->lb_eject_time = (unsigned int) eject_time;
+      ret = nns_edge_request_set_ejection (eh->requests,
+          eh->lb_eject_failures, eh->lb_eject_time);
+    }
+  } else if (0 == strcasecmp (key, "HEDGE_PERCENTILE")) {
+    unsigned long percentile = strtoul (value, NULL, 10);
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (eh->node_type != NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+      nns_edge_loge ("Invalid param, only query client sends the duplicated request.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (percentile >= 100UL) {
+      nns_edge_loge ("Invalid param, the percentile should be 0 to 99.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->hedge_percentile = (unsigned int) percentile;
+      ret = nns_edge_request_set_hedge (eh->requests, eh->hedge_percentile);
+    }
+  } else if (0 == strcasecmp (key, "REQUEST_TIMEOUT")) {
+    unsigned long timeout = strtoul (value, NULL, 10);
+
+    if (eh->node_type != NNS_EDGE_NODE_TYPE_QUERY_CLIENT) {
+      nns_edge_loge ("Invalid param, only query client sends the deadline of the request.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (timeout > UINT_MAX) {
+      nns_edge_loge ("Invalid param, the timeout of request should be 0 to %u.",
+          UINT_MAX);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->request_timeout = (unsigned int) timeout;
+    }
+  } else if (0 == strcasecmp (key, "BATCH_SIZE")) {
+    unsigned long size = strtoul (value, NULL, 10);
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (eh->node_type != NNS_EDGE_NODE_TYPE_QUERY_SERVER) {
+      nns_edge_loge ("Invalid param, only query server gathers the requests into a batch.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (size > UINT16_MAX) {
+      nns_edge_loge ("Invalid param, the batch size should be 0 to %u.",
+          UINT16_MAX);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->batch_size = (unsigned int) size;
+    }
+  } else if (0 == strcasecmp (key, "BATCH_TIMEOUT")) {
+    unsigned long timeout = strtoul (value, NULL, 10);
+
+    if (eh->is_started) {
+      nns_edge_loge ("Cannot update %s, the edge handle is already started.", key);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else if (timeout == 0UL || timeout > UINT_MAX) {
+      nns_edge_loge ("Invalid param, the timeout of batch should be larger than 0.");
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->batch_timeout = (unsigned int) timeout;
+    }
+  } else if (0 == strcasecmp (key, "CODEC_ELEMENT_SIZE")) {
+    unsigned long size = strtoul (value, NULL, 10);
+
+    if (size == 0UL || size > NNS_EDGE_CODEC_ELEMENT_SIZE_MAX) {
+      nns_edge_loge ("Invalid param, the element size should be 1 to %u.",
+          NNS_EDGE_CODEC_ELEMENT_SIZE_MAX);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      eh->codec_element_size = (unsigned int) size;
+    }
   } else if (0 == strcasecmp (key, "my-ip") ||
       0 == strcasecmp (key, "clean-session") ||
       0 == strcasecmp (key, "custom-broker") ||
@@ -1993,6 +4951,61 @@ nns_edge_get_info (nns_edge_h edge_h, const char *key, char **value)
     } else {
       *value = nns_edge_strdup_printf ("%lld", (long long) eh->client_id);
     }
+  } else if (0 == strcasecmp (key, "BACKLOG")) {
+    *value = nns_edge_strdup_printf ("%d", eh->backlog);
+  } else if (0 == strcasecmp (key, "LISTENERS")) {
+    *value = nns_edge_strdup_printf ("%u", eh->listener_num);
+  } else if (0 == strcasecmp (key, "CONNECT_TIMEOUT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->connect_timeout);
+  } else if (0 == strcasecmp (key, "HANDSHAKE_TIMEOUT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->handshake_timeout);
+  } else if (0 == strcasecmp (key, "HANDSHAKE_WORKERS")) {
+    *value = nns_edge_strdup_printf ("%u", eh->handshake_workers);
+  } else if (0 == strcasecmp (key, "FAST_RECONNECT")) {
+    *value = nns_edge_strdup (eh->fast_reconnect ? "true" : "false");
+  } else if (0 == strcasecmp (key, "DATA_ALIGNMENT")) {
+    *value = nns_edge_strdup_printf ("%llu",
+        (unsigned long long) eh->data_alignment);
+  } else if (0 == strcasecmp (key, "POOL_STATS")) {
+    *value = nns_edge_pool_get_stats (eh->pool);
+  } else if (0 == strcasecmp (key, "CODEC")) {
+    *value = nns_edge_strdup (eh->codec ? eh->codec : "none");
+  } else if (0 == strcasecmp (key, "CODEC_THRESHOLD")) {
+    *value = nns_edge_strdup_printf ("%llu",
+        (unsigned long long) eh->codec_threshold);
+  } else if (0 == strcasecmp (key, "CODEC_FILTER")) {
+    *value = nns_edge_strdup (eh->codec_filter == NNS_EDGE_CODEC_FILTER_SHUFFLE ?
+        "shuffle" : "none");
+  } else if (0 == strcasecmp (key, "CODEC_ELEMENT_SIZE")) {
+    *value = nns_edge_strdup_printf ("%u", eh->codec_element_size);
+  } else if (0 == strcasecmp (key, "WIRE_PRECISION")) {
+    *value = nns_edge_strdup (nns_edge_codec_get_precision_name
+        (eh->wire_precision));
+  } else if (0 == strcasecmp (key, "RESTORE_PRECISION")) {
+    *value = nns_edge_strdup (eh->restore_precision ? "true" : "false");
+  } else if (0 == strcasecmp (key, "DELTA")) {
+    *value = nns_edge_strdup (eh->delta ? "true" : "false");
+  } else if (0 == strcasecmp (key, "DELTA_KEYFRAME")) {
+    *value = nns_edge_strdup_printf ("%u", eh->delta_keyframe);
+  } else if (0 == strcasecmp (key, "LB_POLICY")) {
+    *value = nns_edge_strdup (nns_edge_request_get_policy_name (eh->lb_policy));
+  } else if (0 == strcasecmp (key, "LB_EJECT_FAILURES")) {
+    *value = nns_edge_strdup_printf ("%u", eh->lb_eject_failures);
+  } else if (0 == strcasecmp (key, "LB_EJECT_TIME")) {
+    *value = nns_edge_strdup_printf ("%u", eh->lb_eject_time);
+  } else if (0 == strcasecmp (key, "HEDGE_PERCENTILE")) {
+    *value = nns_edge_strdup_printf ("%u", eh->hedge_percentile);
+  } else if (0 == strcasecmp (key, "REQUEST_TIMEOUT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->request_timeout);
+  } else if (0 == strcasecmp (key, "BATCH_SIZE")) {
+    *value = nns_edge_strdup_printf ("%u", eh->batch_size);
+  } else if (0 == strcasecmp (key, "BATCH_TIMEOUT")) {
+    *value = nns_edge_strdup_printf ("%u", eh->batch_timeout);
+  } else if (0 == strcasecmp (key, "CODEC_STATS")) {
+    *value = nns_edge_codec_stats_to_string (&eh->codec_stats);
+  } else if (0 == strcasecmp (key, "OUTSTANDING_REQUESTS")) {
+    *value = nns_edge_strdup_printf ("%u",
+        nns_edge_request_get_count (eh->requests));
   } else {
     ret = nns_edge_metadata_get (eh->metadata, key, value);
   }
@@ -2000,3 +5013,85 @@ nns_edge_get_info (nns_edge_h edge_h, const char *key, char **value)
   nns_edge_unlock (eh);
   return ret;
 }
+
+/**
+ * @brief Set the memory allocator of the edge handle.
+ */
+int
+nns_edge_set_allocator (nns_edge_h edge_h,
+    const nns_edge_allocator_s * allocator)
+{
+  nns_edge_handle_s *eh;
+  int ret;
+
+  eh = (nns_edge_handle_s *) edge_h;
+  if (!eh) {
+    nns_edge_loge ("Invalid param, given edge handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (allocator && (!allocator->alloc || !allocator->aligned_alloc ||
+          !allocator->free)) {
+    nns_edge_loge ("Invalid param, all callbacks of the allocator should be set.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (eh)) {
+    nns_edge_loge ("Invalid param, given edge handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (eh);
+
+  if (eh->is_started) {
+    nns_edge_loge ("Cannot set the allocator, the edge handle is already started.");
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else {
+    ret = nns_edge_pool_set_allocator (eh->pool, allocator);
+
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      if (allocator)
+        eh->allocator = *allocator;
+      else
+        memset (&eh->allocator, 0, sizeof (nns_edge_allocator_s));
+    }
+  }
+
+  nns_edge_unlock (eh);
+  return ret;
+}
+
+/**
+ * @brief Set the callback to allocate the memory of received data.
+ */
+int
+nns_edge_set_alloc_callback (nns_edge_h edge_h, nns_edge_alloc_cb cb,
+    void *user_data)
+{
+  nns_edge_handle_s *eh;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  eh = (nns_edge_handle_s *) edge_h;
+  if (!eh) {
+    nns_edge_loge ("Invalid param, given edge handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!nns_edge_handle_is_valid (eh)) {
+    nns_edge_loge ("Invalid param, given edge handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (eh);
+
+  if (eh->is_started) {
+    nns_edge_loge ("Cannot set the callback, the edge handle is already started.");
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+  } else {
+    eh->alloc_cb = cb;
+    eh->alloc_data = user_data;
+  }
+
+  nns_edge_unlock (eh);
+  return ret;
+}
@@ -10,148 +10,1440 @@
  * @bug    No known bugs except for NYI items
  */
 
+#include <errno.h>
+#include <ctype.h>
+#include "nnstreamer-edge-log.h"
 #include "nnstreamer-edge-metadata.h"
 #include "nnstreamer-edge-util.h"
 
 /**
- * @brief Internal data structure for metadata.
+ * @brief The max number of interned keys. Other keys are owned by each metadata.
  */
-typedef struct _nns_edge_metadata_node_s nns_edge_metadata_node_s;
+#define NNS_EDGE_METADATA_INTERN_LIMIT 1024U
+#define NNS_EDGE_METADATA_INTERN_SLOTS (NNS_EDGE_METADATA_INTERN_LIMIT * 2U)
 
 /**
- * @brief Internal data structure for metadata.
+ * @brief The initial number of entries in the metadata.
  */
-struct _nns_edge_metadata_node_s
+#define NNS_EDGE_METADATA_INIT_CAPACITY 8U
+
+/**
+ * @brief The magic and version of serialized metadata.
+ * The metadata serialized with old version (list of null-terminated key and value strings) starts with the number of entries.
+ */
+#define NNS_EDGE_METADATA_MAGIC 0x4d454e4eU
+#define NNS_EDGE_METADATA_VERSION 1U
+
+/**
+ * @brief The magic of serialized delta of metadata. The delta has same format, and the removed key is marked with the type NNS_EDGE_METADATA_TYPE_REMOVED.
+ */
+#define NNS_EDGE_METADATA_DELTA_MAGIC 0x4d444e4eU
+#define NNS_EDGE_METADATA_TYPE_REMOVED 0xffU
+
+/**
+ * @brief The max length of the key in serialized metadata.
+ */
+#define NNS_EDGE_METADATA_KEY_LIMIT UINT16_MAX
+
+/**
+ * @brief Header of serialized metadata.
+ */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t num;
+} nns_edge_metadata_header_s;
+
+/**
+ * @brief Header of each entry in serialized metadata.
+ * The key (null-terminated) and the value follow the header. The string value is also null-terminated, and value_len includes the null character.
+ */
+typedef struct
+{
+  uint32_t hash; /**< lower 32 bits of the case-insensitive hash of the key */
+  uint16_t key_len; /**< the length of the key, excluding the null character */
+  uint8_t type; /**< the type of the value, see nns_edge_metadata_type_e */
+  uint8_t reserved;
+  uint32_t value_len; /**< the byte size of the value */
+} nns_edge_metadata_entry_header_s;
+
+/**
+ * @brief Internal data structure for the table of interned keys.
+ */
+typedef struct
 {
-  char *key;
-  char *value;
-  nns_edge_metadata_node_s *next;
+  pthread_mutex_t lock;
+  unsigned int num;
+  char *keys[NNS_EDGE_METADATA_INTERN_SLOTS];
+  uint64_t hashes[NNS_EDGE_METADATA_INTERN_SLOTS];
+} nns_edge_metadata_intern_s;
+
+static nns_edge_metadata_intern_s g_intern = {
+  .lock = PTHREAD_MUTEX_INITIALIZER,
 };
 
 /**
- * @brief Internal data structure to handle metadata. This struct should be managed in the handle.
+ * @brief Internal data structure for the value of metadata.
+ */
+typedef union
+{
+  char *str;
+  int64_t i64;
+  double f64;
+  struct
+  {
+    void *data;
+    nns_size_t len;
+  } bin;
+} nns_edge_metadata_value_u;
+
+/**
+ * @brief Internal data structure for metadata entry.
+ */
+typedef struct
+{
+  char *key; /**< interned key, or owned key if key_owned is true */
+  uint64_t hash; /**< case-insensitive hash of the key */
+  bool key_owned;
+  nns_edge_metadata_type_e type;
+  nns_edge_metadata_value_u value;
+} nns_edge_metadata_entry_s;
+
+/**
+ * @brief Internal data structure for the map of metadata entries.
+ * The entries are stored in insertion order, and the slots are the open-addressing index of the entries (index + 1, 0 for empty slot).
+ * If the metadata is deserialized, it keeps the serialized buffer as a view and the entries are materialized when the metadata is updated.
+ */
+typedef struct
+{
+  uint32_t num;
+  uint32_t capacity;
+  nns_edge_metadata_entry_s *entries;
+  uint32_t *slots; /**< the number of slots is twice of the capacity */
+
+  /* view over the serialized metadata */
+  void *view;
+  nns_size_t view_len;
+  uint32_t view_num;
+
+  nns_edge_allocator_s allocator; /**< allocator of the entries, slots and binary values */
+} nns_edge_metadata_map_s;
+
+/**
+ * @brief Internal data structure for the refcounted block of metadata. The block shared by several metadata handles should not be changed.
+ */
+typedef struct
+{
+  int refcount;
+  nns_edge_metadata_map_s map;
+} nns_edge_metadata_block_s;
+
+/**
+ * @brief Internal data structure to handle metadata. This struct should be managed in the handle.
+ * The copied metadata shares the block, and the block is copied when one of them is updated (copy-on-write).
+ */
+typedef struct
+{
+  nns_edge_metadata_block_s *block; /**< null if the metadata is empty */
+  nns_edge_allocator_s allocator; /**< allocator of the handle and the blocks */
+} nns_edge_metadata_s;
+
+/**
+ * @brief Internal data structure for the value found in the metadata.
+ */
+typedef struct
+{
+  const char *key;
+  nns_edge_metadata_type_e type;
+  const void *value; /**< the value, it may not be aligned if it is found in the view */
+  nns_size_t value_len; /**< the byte size of the value, excluding the null character of the string */
+} nns_edge_metadata_item_s;
+
+/**
+ * @brief Internal data structure to iterate the items in the metadata.
+ */
+typedef struct
+{
+  nns_edge_metadata_map_s *meta;
+  uint32_t index;
+  nns_size_t cur; /**< the offset of next entry in the view */
+} nns_edge_metadata_iter_s;
+
+/**
+ * @brief Internal function to get the case-insensitive hash of the key (FNV-1a).
+ */
+static uint64_t
+nns_edge_metadata_hash (const char *key)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  while (*key) {
+    hash ^= (uint64_t) tolower ((unsigned char) *key);
+    hash *= 0x100000001b3ULL;
+    key++;
+  }
+
+  return hash;
+}
+
+/**
+ * @brief Internal function to get the interned key. Returns null if the table is full.
+ */
+static char *
+nns_edge_metadata_intern (const char *key, const uint64_t hash)
+{
+  char *interned = NULL;
+  unsigned int idx;
+
+  nns_edge_lock (&g_intern);
+
+  idx = hash & (NNS_EDGE_METADATA_INTERN_SLOTS - 1);
+  while (g_intern.keys[idx]) {
+    if (g_intern.hashes[idx] == hash &&
+        strcasecmp (g_intern.keys[idx], key) == 0) {
+      interned = g_intern.keys[idx];
+      goto done;
+    }
+
+    idx = (idx + 1) & (NNS_EDGE_METADATA_INTERN_SLOTS - 1);
+  }
+
+  if (g_intern.num < NNS_EDGE_METADATA_INTERN_LIMIT) {
+    interned = nns_edge_strdup (key);
+
+    if (interned) {
+      g_intern.keys[idx] = interned;
+      g_intern.hashes[idx] = hash;
+      g_intern.num++;
+    }
+  }
+
+done:
+  nns_edge_unlock (&g_intern);
+  return interned;
+}
+
+/**
+ * @brief Internal function to get the byte size of the value in serialized metadata.
+ */
+static nns_size_t
+nns_edge_metadata_value_size (nns_edge_metadata_entry_s * entry)
+{
+  switch (entry->type) {
+    case NNS_EDGE_METADATA_TYPE_STRING:
+      return strlen (entry->value.str) + 1;
+    case NNS_EDGE_METADATA_TYPE_INT64:
+      return sizeof (int64_t);
+    case NNS_EDGE_METADATA_TYPE_DOUBLE:
+      return sizeof (double);
+    case NNS_EDGE_METADATA_TYPE_BINARY:
+      return entry->value.bin.len;
+    default:
+      break;
+  }
+
+  return 0U;
+}
+
+/**
+ * @brief Internal function to validate the serialized metadata in one pass.
+ */
+static bool
+nns_edge_metadata_view_is_valid (const void *data, const nns_size_t data_len,
+    const uint32_t magic)
+{
+  nns_edge_metadata_header_s header;
+  nns_edge_metadata_entry_header_s eh;
+  const char *ptr = (const char *) data;
+  nns_size_t cur;
+  uint32_t i;
+
+  if (data_len < sizeof (header))
+    return false;
+
+  memcpy (&header, ptr, sizeof (header));
+  if (header.magic != magic || header.version != NNS_EDGE_METADATA_VERSION)
+    return false;
+
+  cur = sizeof (header);
+  for (i = 0; i < header.num; i++) {
+    if (data_len - cur < sizeof (eh))
+      return false;
+
+    memcpy (&eh, ptr + cur, sizeof (eh));
+    cur += sizeof (eh);
+
+    /* key and null character */
+    if (eh.key_len == 0U || data_len - cur < (nns_size_t) eh.key_len + 1)
+      return false;
+    if (ptr[cur + eh.key_len] != '\0' || memchr (ptr + cur, '\0', eh.key_len))
+      return false;
+    cur += eh.key_len + 1;
+
+    if (data_len - cur < eh.value_len)
+      return false;
+
+    switch (eh.type) {
+      case NNS_EDGE_METADATA_TYPE_STRING:
+        if (eh.value_len < 2U || ptr[cur + eh.value_len - 1] != '\0')
+          return false;
+        break;
+      case NNS_EDGE_METADATA_TYPE_INT64:
+      case NNS_EDGE_METADATA_TYPE_DOUBLE:
+        if (eh.value_len != 8U)
+          return false;
+        break;
+      case NNS_EDGE_METADATA_TYPE_BINARY:
+        if (eh.value_len == 0U)
+          return false;
+        break;
+      case NNS_EDGE_METADATA_TYPE_REMOVED:
+        if (magic != NNS_EDGE_METADATA_DELTA_MAGIC || eh.value_len != 0U)
+          return false;
+        break;
+      default:
+        return false;
+    }
+
+    cur += eh.value_len;
+  }
+
+  return (cur == data_len);
+}
+
+/**
+ * @brief Internal function to read the item at given offset in the view. Returns the offset of next entry.
+ */
+static nns_size_t
+nns_edge_metadata_view_item (const void *view, nns_size_t cur,
+    nns_edge_metadata_item_s * item)
+{
+  nns_edge_metadata_entry_header_s eh;
+  const char *ptr = (const char *) view;
+
+  memcpy (&eh, ptr + cur, sizeof (eh));
+  cur += sizeof (eh);
+
+  item->key = ptr + cur;
+  item->type = (nns_edge_metadata_type_e) eh.type;
+  item->value = ptr + cur + eh.key_len + 1;
+  item->value_len = eh.value_len;
+  if (item->type == NNS_EDGE_METADATA_TYPE_STRING)
+    item->value_len--;
+
+  return cur + eh.key_len + 1 + eh.value_len;
+}
+
+/**
+ * @brief Internal function to get the item of the entry.
+ */
+static bool
+nns_edge_metadata_entry_to_item (nns_edge_metadata_entry_s * entry,
+    nns_edge_metadata_item_s * item)
+{
+  item->key = entry->key;
+  item->type = entry->type;
+
+  switch (entry->type) {
+    case NNS_EDGE_METADATA_TYPE_STRING:
+      item->value = entry->value.str;
+      item->value_len = strlen (entry->value.str);
+      break;
+    case NNS_EDGE_METADATA_TYPE_INT64:
+      item->value = &entry->value.i64;
+      item->value_len = sizeof (int64_t);
+      break;
+    case NNS_EDGE_METADATA_TYPE_DOUBLE:
+      item->value = &entry->value.f64;
+      item->value_len = sizeof (double);
+      break;
+    case NNS_EDGE_METADATA_TYPE_BINARY:
+      item->value = entry->value.bin.data;
+      item->value_len = entry->value.bin.len;
+      break;
+    default:
+      return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Internal function to find the item in the view.
+ */
+static bool
+nns_edge_metadata_view_find (nns_edge_metadata_map_s * meta, const char *key,
+    const uint64_t hash, nns_edge_metadata_item_s * item)
+{
+  nns_edge_metadata_entry_header_s eh;
+  const char *ptr = (const char *) meta->view;
+  nns_size_t cur;
+  uint32_t i;
+
+  cur = sizeof (nns_edge_metadata_header_s);
+  for (i = 0; i < meta->view_num; i++) {
+    memcpy (&eh, ptr + cur, sizeof (eh));
+
+    if (eh.hash == (uint32_t) hash &&
+        strcasecmp (ptr + cur + sizeof (eh), key) == 0) {
+      nns_edge_metadata_view_item (ptr, cur, item);
+      return true;
+    }
+
+    cur += sizeof (eh) + eh.key_len + 1 + eh.value_len;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Internal function to find the slot of given key. Returns the empty slot if the key does not exist.
+ */
+static uint32_t
+nns_edge_metadata_find_slot (nns_edge_metadata_map_s * meta, const char *key,
+    const uint64_t hash)
+{
+  nns_edge_metadata_entry_s *entry;
+  uint32_t mask, idx;
+
+  mask = meta->capacity * 2 - 1;
+  idx = hash & mask;
+
+  while (meta->slots[idx] != 0U) {
+    entry = &meta->entries[meta->slots[idx] - 1];
+
+    if (entry->hash == hash &&
+        (entry->key == key || strcasecmp (entry->key, key) == 0))
+      break;
+
+    idx = (idx + 1) & mask;
+  }
+
+  return idx;
+}
+
+/**
+ * @brief Internal function to find the item in the metadata.
+ */
+static bool
+nns_edge_metadata_find (nns_edge_metadata_map_s * meta, const char *key,
+    nns_edge_metadata_item_s * item)
+{
+  nns_edge_metadata_entry_s *entry;
+  uint64_t hash;
+  uint32_t idx;
+
+  if (!meta)
+    return false;
+
+  if (!STR_IS_VALID (key))
+    return false;
+
+  hash = nns_edge_metadata_hash (key);
+
+  if (meta->view)
+    return nns_edge_metadata_view_find (meta, key, hash, item);
+
+  if (meta->num == 0U)
+    return false;
+
+  idx = nns_edge_metadata_find_slot (meta, key, hash);
+  if (meta->slots[idx] == 0U)
+    return false;
+
+  entry = &meta->entries[meta->slots[idx] - 1];
+  return nns_edge_metadata_entry_to_item (entry, item);
+}
+
+/**
+ * @brief Internal function to start iterating the items in the metadata.
+ */
+static void
+nns_edge_metadata_iter_init (nns_edge_metadata_iter_s * iter,
+    nns_edge_metadata_map_s * meta)
+{
+  iter->meta = meta;
+  iter->index = 0U;
+  iter->cur = sizeof (nns_edge_metadata_header_s);
+}
+
+/**
+ * @brief Internal function to get the next item in the metadata. Returns false if there is no more item.
+ */
+static bool
+nns_edge_metadata_iter_next (nns_edge_metadata_iter_s * iter,
+    nns_edge_metadata_item_s * item)
+{
+  nns_edge_metadata_map_s *meta = iter->meta;
+
+  if (!meta)
+    return false;
+
+  if (meta->view) {
+    if (iter->index >= meta->view_num)
+      return false;
+
+    iter->cur = nns_edge_metadata_view_item (meta->view, iter->cur, item);
+  } else {
+    if (iter->index >= meta->num)
+      return false;
+
+    nns_edge_metadata_entry_to_item (&meta->entries[iter->index], item);
+  }
+
+  iter->index++;
+  return true;
+}
+
+/**
+ * @brief Internal function to release the value of metadata entry.
+ */
+static void
+nns_edge_metadata_clear_value (nns_edge_metadata_map_s * meta,
+    nns_edge_metadata_type_e type, nns_edge_metadata_value_u * value)
+{
+  switch (type) {
+    case NNS_EDGE_METADATA_TYPE_STRING:
+      SAFE_FREE (value->str);
+      break;
+    case NNS_EDGE_METADATA_TYPE_BINARY:
+      nns_edge_allocator_free (&meta->allocator, value->bin.data);
+      value->bin.data = NULL;
+      value->bin.len = 0U;
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief Internal function to expand the entries and rebuild the slots.
+ */
+static int
+nns_edge_metadata_reserve (nns_edge_metadata_map_s * meta, uint32_t num)
+{
+  nns_edge_metadata_entry_s *entries;
+  uint32_t *slots;
+  uint32_t capacity, i, idx;
+
+  if (num <= meta->capacity)
+    return NNS_EDGE_ERROR_NONE;
+
+  capacity = (meta->capacity > 0U) ? meta->capacity :
+      NNS_EDGE_METADATA_INIT_CAPACITY;
+  while (capacity < num)
+    capacity *= 2;
+
+  entries = (nns_edge_metadata_entry_s *) nns_edge_allocator_realloc (
+      &meta->allocator, meta->entries,
+      sizeof (nns_edge_metadata_entry_s) * meta->capacity,
+      sizeof (nns_edge_metadata_entry_s) * capacity);
+  if (!entries)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  meta->entries = entries;
+
+  slots = (uint32_t *) nns_edge_allocator_calloc (&meta->allocator,
+      capacity * 2, sizeof (uint32_t));
+  if (!slots)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  nns_edge_allocator_free (&meta->allocator, meta->slots);
+  meta->slots = slots;
+  meta->capacity = capacity;
+
+  for (i = 0; i < meta->num; i++) {
+    idx = nns_edge_metadata_find_slot (meta, entries[i].key, entries[i].hash);
+    meta->slots[idx] = i + 1;
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to set the value of given key. The metadata takes the ownership of the value if successful.
+ */
+static int
+nns_edge_metadata_put (nns_edge_metadata_map_s * meta, const char *key,
+    nns_edge_metadata_type_e type, nns_edge_metadata_value_u * value)
+{
+  nns_edge_metadata_entry_s *entry;
+  uint64_t hash;
+  uint32_t idx;
+  int ret;
+
+  if (strlen (key) > NNS_EDGE_METADATA_KEY_LIMIT)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  hash = nns_edge_metadata_hash (key);
+
+  if (meta->num > 0U) {
+    idx = nns_edge_metadata_find_slot (meta, key, hash);
+
+    /* Replace old value if key exists. */
+    if (meta->slots[idx] != 0U) {
+      entry = &meta->entries[meta->slots[idx] - 1];
+
+      nns_edge_metadata_clear_value (meta, entry->type, &entry->value);
+      entry->type = type;
+      entry->value = *value;
+      return NNS_EDGE_ERROR_NONE;
+    }
+  }
+
+  ret = nns_edge_metadata_reserve (meta, meta->num + 1);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  entry = &meta->entries[meta->num];
+  entry->hash = hash;
+  entry->key = nns_edge_metadata_intern (key, hash);
+  entry->key_owned = false;
+
+  if (!entry->key) {
+    entry->key = nns_edge_strdup (key);
+    entry->key_owned = true;
+
+    if (!entry->key)
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  entry->type = type;
+  entry->value = *value;
+
+  idx = nns_edge_metadata_find_slot (meta, key, hash);
+  meta->slots[idx] = ++meta->num;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to remove the entry of given key.
+ */
+static void
+nns_edge_metadata_remove_entry (nns_edge_metadata_map_s * meta,
+    const char *key)
+{
+  nns_edge_metadata_entry_s *entry;
+  uint32_t i, idx, pos;
+
+  if (meta->num == 0U)
+    return;
+
+  idx = nns_edge_metadata_find_slot (meta, key, nns_edge_metadata_hash (key));
+  if (meta->slots[idx] == 0U)
+    return;
+
+  pos = meta->slots[idx] - 1;
+  entry = &meta->entries[pos];
+
+  if (entry->key_owned)
+    SAFE_FREE (entry->key);
+  nns_edge_metadata_clear_value (meta, entry->type, &entry->value);
+
+  memmove (entry, entry + 1,
+      sizeof (nns_edge_metadata_entry_s) * (meta->num - pos - 1));
+  meta->num--;
+
+  /* Rebuild the slots, the index of entries is changed. */
+  memset (meta->slots, 0, sizeof (uint32_t) * meta->capacity * 2);
+  for (i = 0; i < meta->num; i++) {
+    idx = nns_edge_metadata_find_slot (meta, meta->entries[i].key,
+        meta->entries[i].hash);
+    meta->slots[idx] = i + 1;
+  }
+}
+
+/**
+ * @brief Internal function to set the item. The value is copied into the metadata.
+ */
+static int
+nns_edge_metadata_put_item (nns_edge_metadata_map_s * meta,
+    nns_edge_metadata_item_s * item)
+{
+  nns_edge_metadata_value_u val;
+  int ret;
+
+  switch (item->type) {
+    case NNS_EDGE_METADATA_TYPE_STRING:
+      val.str = nns_edge_strndup (item->value, item->value_len);
+      if (!val.str)
+        return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+      break;
+    case NNS_EDGE_METADATA_TYPE_INT64:
+      memcpy (&val.i64, item->value, sizeof (int64_t));
+      break;
+    case NNS_EDGE_METADATA_TYPE_DOUBLE:
+      memcpy (&val.f64, item->value, sizeof (double));
+      break;
+    case NNS_EDGE_METADATA_TYPE_BINARY:
+      val.bin.data = nns_edge_allocator_alloc (&meta->allocator,
+          item->value_len);
+      val.bin.len = item->value_len;
+      if (!val.bin.data)
+        return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+      memcpy (val.bin.data, item->value, item->value_len);
+      break;
+    default:
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  ret = nns_edge_metadata_put (meta, item->key, item->type, &val);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    nns_edge_metadata_clear_value (meta, item->type, &val);
+
+  return ret;
+}
+
+/**
+ * @brief Internal function to initialize metadata structure. The storage of the map is allocated with given allocator (null to use the default allocator).
+ */
+static int
+nns_edge_metadata_init (nns_edge_metadata_map_s * meta,
+    const nns_edge_allocator_s * allocator)
+{
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  memset (meta, 0, sizeof (nns_edge_metadata_map_s));
+  if (allocator)
+    meta->allocator = *allocator;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to remove all entries in metadata structure. The storage is kept to reuse it.
+ */
+static int
+nns_edge_metadata_free (nns_edge_metadata_map_s * meta)
+{
+  nns_edge_metadata_entry_s *entry;
+  uint32_t i;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  for (i = 0; i < meta->num; i++) {
+    entry = &meta->entries[i];
+
+    if (entry->key_owned)
+      SAFE_FREE (entry->key);
+    nns_edge_metadata_clear_value (meta, entry->type, &entry->value);
+  }
+
+  if (meta->num > 0U)
+    memset (meta->slots, 0, sizeof (uint32_t) * meta->capacity * 2);
+  meta->num = 0U;
+
+  nns_edge_free (meta->view);
+  meta->view = NULL;
+  meta->view_len = 0U;
+  meta->view_num = 0U;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to release all entries and the storage in metadata structure.
+ */
+static void
+nns_edge_metadata_release (nns_edge_metadata_map_s * meta)
+{
+  nns_edge_metadata_free (meta);
+
+  nns_edge_allocator_free (&meta->allocator, meta->entries);
+  nns_edge_allocator_free (&meta->allocator, meta->slots);
+  meta->entries = NULL;
+  meta->slots = NULL;
+  meta->capacity = 0U;
+}
+
+/**
+ * @brief Internal function to set the view over serialized metadata. The metadata takes the ownership of the data.
+ */
+static void
+nns_edge_metadata_set_view (nns_edge_metadata_map_s * meta, void *data,
+    const nns_size_t data_len)
+{
+  nns_edge_metadata_header_s header;
+
+  memcpy (&header, data, sizeof (header));
+
+  meta->view = data;
+  meta->view_len = data_len;
+  meta->view_num = header.num;
+}
+
+/**
+ * @brief Internal function to materialize all entries in the view, to update the metadata.
+ */
+static int
+nns_edge_metadata_materialize (nns_edge_metadata_map_s * meta)
+{
+  nns_edge_metadata_iter_s iter;
+  nns_edge_metadata_item_s item;
+  nns_edge_metadata_map_s tmp;
+  int ret;
+
+  if (!meta->view)
+    return NNS_EDGE_ERROR_NONE;
+
+  nns_edge_metadata_init (&tmp, &meta->allocator);
+
+  ret = nns_edge_metadata_reserve (&tmp, meta->view_num);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    goto error;
+
+  nns_edge_metadata_iter_init (&iter, meta);
+  while (nns_edge_metadata_iter_next (&iter, &item)) {
+    ret = nns_edge_metadata_put_item (&tmp, &item);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      goto error;
+  }
+
+  nns_edge_metadata_release (meta);
+  *meta = tmp;
+  return NNS_EDGE_ERROR_NONE;
+
+error:
+  nns_edge_metadata_release (&tmp);
+  return ret;
+}
+
+/**
+ * @brief Internal function to deserialize the metadata with old version format (list of null-terminated key and value strings).
+ */
+static int
+nns_edge_metadata_deserialize_legacy (nns_edge_metadata_map_s * meta,
+    const void *data, const nns_size_t data_len)
+{
+  nns_edge_metadata_item_s item;
+  const char *key, *value, *end;
+  nns_size_t cur;
+  uint32_t total;
+  int ret;
+
+  /* length + list of key-value pair */
+  total = ((uint32_t *) data)[0];
+
+  /* Each pair has 4 bytes at least, do not trust the length in data. */
+  ret = nns_edge_metadata_reserve (meta,
+      (total < data_len / 4) ? total : (uint32_t) (data_len / 4));
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  cur = sizeof (uint32_t);
+  while (cur < data_len && meta->num < total) {
+    key = (const char *) data + cur;
+    end = memchr (key, '\0', data_len - cur);
+    if (!end)
+      goto error;
+    cur += (end - key + 1);
+
+    value = (const char *) data + cur;
+    end = memchr (value, '\0', data_len - cur);
+    if (!end)
+      goto error;
+    cur += (end - value + 1);
+
+    if (!STR_IS_VALID (key) || !STR_IS_VALID (value))
+      goto error;
+
+    item.key = key;
+    item.type = NNS_EDGE_METADATA_TYPE_STRING;
+    item.value = value;
+    item.value_len = end - value;
+
+    ret = nns_edge_metadata_put_item (meta, &item);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_metadata_free (meta);
+      return ret;
+    }
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+
+error:
+  nns_edge_loge ("Failed to deserialize metadata, invalid data.");
+  nns_edge_metadata_free (meta);
+  return NNS_EDGE_ERROR_INVALID_PARAMETER;
+}
+
+/**
+ * @brief Internal function to copy all entries of the map. The dest map should be empty.
+ */
+static int
+nns_edge_metadata_map_copy (nns_edge_metadata_map_s * dest,
+    nns_edge_metadata_map_s * src)
+{
+  nns_edge_metadata_item_s item;
+  void *view;
+  uint32_t i;
+  int ret;
+
+  /* Copy the serialized buffer, the entries are not materialized. */
+  if (src->view) {
+    view = nns_edge_memdup (src->view, src->view_len);
+    if (!view)
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+    nns_edge_metadata_set_view (dest, view, src->view_len);
+    return NNS_EDGE_ERROR_NONE;
+  }
+
+  ret = nns_edge_metadata_reserve (dest, src->num);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  for (i = 0; i < src->num; i++) {
+    nns_edge_metadata_entry_to_item (&src->entries[i], &item);
+
+    ret = nns_edge_metadata_put_item (dest, &item);
+    if (ret != NNS_EDGE_ERROR_NONE) {
+      nns_edge_metadata_free (dest);
+      return ret;
+    }
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to create new block of metadata.
+ */
+static nns_edge_metadata_block_s *
+nns_edge_metadata_block_new (const nns_edge_allocator_s * allocator)
+{
+  nns_edge_metadata_block_s *block;
+
+  block = (nns_edge_metadata_block_s *) nns_edge_allocator_calloc (allocator,
+      1, sizeof (nns_edge_metadata_block_s));
+  if (block) {
+    block->refcount = 1;
+    nns_edge_metadata_init (&block->map, allocator);
+  }
+
+  return block;
+}
+
+/**
+ * @brief Internal function to release the reference of the block. The block is released if no one refers it.
+ */
+static void
+nns_edge_metadata_block_unref (nns_edge_metadata_block_s * block)
+{
+  nns_edge_allocator_s allocator;
+
+  if (!block)
+    return;
+
+  if (__atomic_sub_fetch (&block->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+    nns_edge_metadata_release (&block->map);
+
+    allocator = block->map.allocator;
+    nns_edge_allocator_free (&allocator, block);
+  }
+}
+
+/**
+ * @brief Internal function to get the map to read the entries. Returns null if the metadata is empty.
+ */
+static nns_edge_metadata_map_s *
+nns_edge_metadata_get_map (nns_edge_metadata_s * meta)
+{
+  if (!meta || !meta->block)
+    return NULL;
+
+  return &meta->block->map;
+}
+
+/**
+ * @brief Internal function to get the map to update the entries. If the block is shared, this copies the block.
+ */
+static nns_edge_metadata_map_s *
+nns_edge_metadata_get_writable_map (nns_edge_metadata_s * meta)
+{
+  nns_edge_metadata_block_s *block;
+
+  block = meta->block;
+  if (block &&
+      __atomic_load_n (&block->refcount, __ATOMIC_ACQUIRE) == 1)
+    return &block->map;
+
+  block = nns_edge_metadata_block_new (&meta->allocator);
+  if (!block)
+    return NULL;
+
+  if (meta->block) {
+    if (nns_edge_metadata_map_copy (&block->map,
+            &meta->block->map) != NNS_EDGE_ERROR_NONE) {
+      nns_edge_metadata_block_unref (block);
+      return NULL;
+    }
+
+    nns_edge_metadata_block_unref (meta->block);
+  }
+
+  meta->block = block;
+  return &block->map;
+}
+
+/**
+ * @brief Internal function to get the map to update all entries. If the block is shared, this creates new block.
+ */
+static nns_edge_metadata_map_s *
+nns_edge_metadata_reset_map (nns_edge_metadata_s * meta)
+{
+  nns_edge_metadata_block_s *block;
+
+  block = meta->block;
+  if (block &&
+      __atomic_load_n (&block->refcount, __ATOMIC_ACQUIRE) == 1) {
+    nns_edge_metadata_free (&block->map);
+    return &block->map;
+  }
+
+  block = nns_edge_metadata_block_new (&meta->allocator);
+  if (!block)
+    return NULL;
+
+  nns_edge_metadata_block_unref (meta->block);
+  meta->block = block;
+  return &block->map;
+}
+
+/**
+ * @brief Internal function to find the item in the metadata.
+ */
+static bool
+nns_edge_metadata_lookup (nns_edge_metadata_s * meta, const char *key,
+    nns_edge_metadata_item_s * item)
+{
+  nns_edge_metadata_map_s *map;
+
+  map = nns_edge_metadata_get_map (meta);
+  if (!map)
+    return false;
+
+  return nns_edge_metadata_find (map, key, item);
+}
+
+/**
+ * @brief Internal function to set the item in the metadata.
+ */
+static int
+nns_edge_metadata_update (nns_edge_metadata_s * meta,
+    nns_edge_metadata_item_s * item)
+{
+  nns_edge_metadata_map_s *map;
+  int ret;
+
+  if (strlen (item->key) > NNS_EDGE_METADATA_KEY_LIMIT)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  map = nns_edge_metadata_get_writable_map (meta);
+  if (!map)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  ret = nns_edge_metadata_materialize (map);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  return nns_edge_metadata_put_item (map, item);
+}
+
+/**
+ * @brief Internal function to create metadata.
+ */
+int
+nns_edge_metadata_create (nns_edge_metadata_h * metadata_h)
+{
+  return nns_edge_metadata_create_with_allocator (metadata_h, NULL);
+}
+
+/**
+ * @brief Internal function to create metadata with given allocator.
+ */
+int
+nns_edge_metadata_create_with_allocator (nns_edge_metadata_h * metadata_h,
+    const nns_edge_allocator_s * allocator)
+{
+  nns_edge_metadata_s *meta;
+
+  if (!metadata_h)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  meta = (nns_edge_metadata_s *) nns_edge_allocator_calloc (allocator, 1,
+      sizeof (nns_edge_metadata_s));
+  if (!meta)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  if (allocator)
+    meta->allocator = *allocator;
+
+  *metadata_h = meta;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to destroy metadata.
+ */
+int
+nns_edge_metadata_destroy (nns_edge_metadata_h metadata_h)
+{
+  nns_edge_metadata_s *meta;
+  nns_edge_allocator_s allocator;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  nns_edge_metadata_block_unref (meta->block);
+
+  allocator = meta->allocator;
+  nns_edge_allocator_free (&allocator, meta);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to remove all items in the metadata.
+ */
+int
+nns_edge_metadata_clear (nns_edge_metadata_h metadata_h)
+{
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_block_s *block;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  block = meta->block;
+  if (!block)
+    return NNS_EDGE_ERROR_NONE;
+
+  /* Keep the storage of the block to reuse it, if no one shares it. */
+  if (__atomic_load_n (&block->refcount, __ATOMIC_ACQUIRE) == 1)
+    return nns_edge_metadata_free (&block->map);
+
+  nns_edge_metadata_block_unref (block);
+  meta->block = NULL;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to set the metadata.
+ */
+int
+nns_edge_metadata_set (nns_edge_metadata_h metadata_h,
+    const char *key, const char *value)
+{
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!STR_IS_VALID (key))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!STR_IS_VALID (value))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  item.key = key;
+  item.type = NNS_EDGE_METADATA_TYPE_STRING;
+  item.value = value;
+  item.value_len = strlen (value);
+
+  return nns_edge_metadata_update (meta, &item);
+}
+
+/**
+ * @brief Internal function to set the metadata with int64 value.
+ */
+int
+nns_edge_metadata_set_int64 (nns_edge_metadata_h metadata_h,
+    const char *key, const int64_t value)
+{
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!STR_IS_VALID (key))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  item.key = key;
+  item.type = NNS_EDGE_METADATA_TYPE_INT64;
+  item.value = &value;
+  item.value_len = sizeof (int64_t);
+
+  return nns_edge_metadata_update (meta, &item);
+}
+
+/**
+ * @brief Internal function to set the metadata with double value.
+ */
+int
+nns_edge_metadata_set_double (nns_edge_metadata_h metadata_h,
+    const char *key, const double value)
+{
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!STR_IS_VALID (key))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  item.key = key;
+  item.type = NNS_EDGE_METADATA_TYPE_DOUBLE;
+  item.value = &value;
+  item.value_len = sizeof (double);
+
+  return nns_edge_metadata_update (meta, &item);
+}
+
+/**
+ * @brief Internal function to set the metadata with binary value.
+ */
+int
+nns_edge_metadata_set_binary (nns_edge_metadata_h metadata_h,
+    const char *key, const void *value, const nns_size_t value_len)
+{
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!STR_IS_VALID (key))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!value || value_len == 0U || value_len > UINT32_MAX)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  item.key = key;
+  item.type = NNS_EDGE_METADATA_TYPE_BINARY;
+  item.value = value;
+  item.value_len = value_len;
+
+  return nns_edge_metadata_update (meta, &item);
+}
+
+/**
+ * @brief Internal function to convert double value to the shortest string which can be parsed to same value.
  */
-typedef struct
+static void
+nns_edge_metadata_double_to_string (double value, char *str, size_t len)
 {
-  uint32_t list_len;
-  nns_edge_metadata_node_s *list;
-} nns_edge_metadata_s;
+  int precision;
+
+  for (precision = 6; precision <= 17; precision++) {
+    snprintf (str, len, "%.*g", precision, value);
+    if (strtod (str, NULL) == value)
+      break;
+  }
+}
 
 /**
- * @brief Internal function to find node in the list.
+ * @brief Internal function to get the metadata as a string. Caller should release the returned value using free().
  */
-static nns_edge_metadata_node_s *
-nns_edge_metadata_find (nns_edge_metadata_s * meta, const char *key)
+int
+nns_edge_metadata_get (nns_edge_metadata_h metadata_h,
+    const char *key, char **value)
 {
-  nns_edge_metadata_node_s *node;
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
+  char buf[32];
+  int64_t ival;
+  double dval;
 
-  if (!meta)
-    return NULL;
+  meta = (nns_edge_metadata_s *) metadata_h;
 
-  if (!STR_IS_VALID (key))
-    return NULL;
+  if (!value)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  node = meta->list;
-  while (node) {
-    if (strcasecmp (key, node->key) == 0)
-      return node;
+  if (!nns_edge_metadata_lookup (meta, key, &item))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-    node = node->next;
+  switch (item.type) {
+    case NNS_EDGE_METADATA_TYPE_STRING:
+      *value = nns_edge_strndup (item.value, item.value_len);
+      break;
+    case NNS_EDGE_METADATA_TYPE_INT64:
+      memcpy (&ival, item.value, sizeof (int64_t));
+      *value = nns_edge_strdup_printf ("%lld", (long long) ival);
+      break;
+    case NNS_EDGE_METADATA_TYPE_DOUBLE:
+      memcpy (&dval, item.value, sizeof (double));
+      nns_edge_metadata_double_to_string (dval, buf, sizeof (buf));
+      *value = nns_edge_strdup (buf);
+      break;
+    default:
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  return NULL;
+  return (*value) ? NNS_EDGE_ERROR_NONE : NNS_EDGE_ERROR_OUT_OF_MEMORY;
 }
 
 /**
- * @brief Internal function to initialize metadata structure.
+ * @brief Internal function to get the int64 value of metadata. The string value is converted to int64.
  */
-static int
-nns_edge_metadata_init (nns_edge_metadata_s * meta)
+int
+nns_edge_metadata_get_int64 (nns_edge_metadata_h metadata_h,
+    const char *key, int64_t * value)
 {
-  if (!meta)
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
+  char *end = NULL;
+  long long val;
+
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!value)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  memset (meta, 0, sizeof (nns_edge_metadata_s));
-  return NNS_EDGE_ERROR_NONE;
+  if (!nns_edge_metadata_lookup (meta, key, &item))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  switch (item.type) {
+    case NNS_EDGE_METADATA_TYPE_INT64:
+      memcpy (value, item.value, sizeof (int64_t));
+      return NNS_EDGE_ERROR_NONE;
+    case NNS_EDGE_METADATA_TYPE_STRING:
+      errno = 0;
+      val = strtoll ((const char *) item.value, &end, 10);
+      if (errno != 0 || end == item.value || *end != '\0')
+        break;
+
+      *value = (int64_t) val;
+      return NNS_EDGE_ERROR_NONE;
+    default:
+      break;
+  }
+
+  return NNS_EDGE_ERROR_INVALID_PARAMETER;
 }
 
 /**
- * @brief Internal function to free the list and items in metadata structure.
+ * @brief Internal function to get the double value of metadata. The int64 or string value is converted to double.
  */
-static int
-nns_edge_metadata_free (nns_edge_metadata_s * meta)
+int
+nns_edge_metadata_get_double (nns_edge_metadata_h metadata_h,
+    const char *key, double *value)
 {
-  nns_edge_metadata_node_s *node, *tmp;
-
-  if (!meta)
-    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
+  char *end = NULL;
+  int64_t ival;
+  double val;
 
-  node = meta->list;
-  meta->list_len = 0;
-  meta->list = NULL;
+  meta = (nns_edge_metadata_s *) metadata_h;
 
-  while (node) {
-    tmp = node->next;
+  if (!value)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-    SAFE_FREE (node->key);
-    SAFE_FREE (node->value);
-    SAFE_FREE (node);
+  if (!nns_edge_metadata_lookup (meta, key, &item))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-    node = tmp;
+  switch (item.type) {
+    case NNS_EDGE_METADATA_TYPE_DOUBLE:
+      memcpy (value, item.value, sizeof (double));
+      return NNS_EDGE_ERROR_NONE;
+    case NNS_EDGE_METADATA_TYPE_INT64:
+      memcpy (&ival, item.value, sizeof (int64_t));
+      *value = (double) ival;
+      return NNS_EDGE_ERROR_NONE;
+    case NNS_EDGE_METADATA_TYPE_STRING:
+      errno = 0;
+      val = strtod ((const char *) item.value, &end);
+      if (errno != 0 || end == item.value || *end != '\0')
+        break;
+
+      *value = val;
+      return NNS_EDGE_ERROR_NONE;
+    default:
+      break;
   }
 
-  return NNS_EDGE_ERROR_NONE;
+  return NNS_EDGE_ERROR_INVALID_PARAMETER;
 }
 
 /**
- * @brief Internal function to create metadata.
+ * @brief Internal function to get the binary value of metadata. Caller should release the returned value using nns_edge_free().
  */
 int
-nns_edge_metadata_create (nns_edge_metadata_h * metadata_h)
+nns_edge_metadata_get_binary (nns_edge_metadata_h metadata_h,
+    const char *key, void **value, nns_size_t * value_len)
 {
   nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
 
-  if (!metadata_h)
+  meta = (nns_edge_metadata_s *) metadata_h;
+
+  if (!value || !value_len)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  meta = calloc (1, sizeof (nns_edge_metadata_s));
-  if (!meta)
-    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  if (!nns_edge_metadata_lookup (meta, key, &item) ||
+      item.type != NNS_EDGE_METADATA_TYPE_BINARY)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  nns_edge_metadata_init (meta);
+  *value = nns_edge_memdup (item.value, item.value_len);
+  if (!*value)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
 
-  *metadata_h = meta;
+  *value_len = item.value_len;
   return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Internal function to destroy metadata.
+ * @brief Internal function to get the type of metadata.
  */
 int
-nns_edge_metadata_destroy (nns_edge_metadata_h metadata_h)
+nns_edge_metadata_get_type (nns_edge_metadata_h metadata_h,
+    const char *key, nns_edge_metadata_type_e * type)
 {
   nns_edge_metadata_s *meta;
+  nns_edge_metadata_item_s item;
 
   meta = (nns_edge_metadata_s *) metadata_h;
 
-  if (!meta)
+  if (!type)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  nns_edge_metadata_free (meta);
-  SAFE_FREE (meta);
+  if (!nns_edge_metadata_lookup (meta, key, &item))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
+  *type = item.type;
   return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Internal function to set the metadata.
+ * @brief Internal function to remove the item of given key. The shared block is not copied if the key does not exist.
  */
 int
-nns_edge_metadata_set (nns_edge_metadata_h metadata_h,
-    const char *key, const char *value)
+nns_edge_metadata_remove (nns_edge_metadata_h metadata_h, const char *key)
 {
   nns_edge_metadata_s *meta;
-  nns_edge_metadata_node_s *node;
+  nns_edge_metadata_map_s *map;
+  nns_edge_metadata_item_s item;
+  int ret;
 
   meta = (nns_edge_metadata_s *) metadata_h;
 
@@ -161,116 +1453,208 @@ nns_edge_metadata_set (nns_edge_metadata_h metadata_h,
   if (!STR_IS_VALID (key))
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  if (!STR_IS_VALID (value))
+  if (!nns_edge_metadata_lookup (meta, key, &item))
+    return NNS_EDGE_ERROR_NONE;
+
+  map = nns_edge_metadata_get_writable_map (meta);
+  if (!map)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  ret = nns_edge_metadata_materialize (map);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  nns_edge_metadata_remove_entry (map, key);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to copy the metadata. The block of metadata is shared until one of them is updated.
+ */
+int
+nns_edge_metadata_copy (nns_edge_metadata_h dest_h, nns_edge_metadata_h src_h)
+{
+  nns_edge_metadata_s *dest, *src;
+  nns_edge_metadata_block_s *block;
+
+  dest = (nns_edge_metadata_s *) dest_h;
+  src = (nns_edge_metadata_s *) src_h;
+
+  if (!dest || !src)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  /* Replace old value if key exists in the list. */
-  node = nns_edge_metadata_find (meta, key);
-  if (node) {
-    char *val = nns_edge_strdup (value);
+  block = src->block;
+  if (block == dest->block)
+    return NNS_EDGE_ERROR_NONE;
 
-    if (!val)
-      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  if (block)
+    __atomic_add_fetch (&block->refcount, 1, __ATOMIC_ACQ_REL);
+
+  nns_edge_metadata_block_unref (dest->block);
+  dest->block = block;
+
+  return NNS_EDGE_ERROR_NONE;
+}
 
-    SAFE_FREE (node->value);
-    node->value = val;
+/**
+ * @brief Internal function to get the byte size of serialized map.
+ */
+static int
+nns_edge_metadata_map_get_size (nns_edge_metadata_map_s * map,
+    nns_size_t * size)
+{
+  nns_edge_metadata_entry_s *entry;
+  nns_size_t total, vlen;
+  uint32_t i;
+
+  *size = 0U;
+
+  if (!map)
+    return NNS_EDGE_ERROR_NONE;
+
+  /* The view is not changed, the serialized buffer is copied. */
+  if (map->view) {
+    *size = map->view_len;
     return NNS_EDGE_ERROR_NONE;
   }
 
-  node = calloc (1, sizeof (nns_edge_metadata_node_s));
-  if (!node)
-    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  if (map->num == 0U)
+    return NNS_EDGE_ERROR_NONE;
 
-  node->key = nns_edge_strdup (key);
-  node->value = nns_edge_strdup (value);
+  /* header + list of entry (header, key and value) */
+  total = sizeof (nns_edge_metadata_header_s);
+  for (i = 0; i < map->num; i++) {
+    entry = &map->entries[i];
 
-  if (!node->key || !node->value) {
-    SAFE_FREE (node->key);
-    SAFE_FREE (node->value);
-    SAFE_FREE (node);
-    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
-  }
+    vlen = nns_edge_metadata_value_size (entry);
+    if (vlen > UINT32_MAX) {
+      nns_edge_loge ("Failed to serialize metadata, too large value (%s).",
+          entry->key);
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
 
-  /* Prepend new node to the start of the list. */
-  meta->list_len++;
-  node->next = meta->list;
-  meta->list = node;
+    total += sizeof (nns_edge_metadata_entry_header_s) + strlen (entry->key) +
+        1 + vlen;
+  }
 
+  *size = total;
   return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Internal function to get the metadata in the list. Caller should release the returned value using free().
+ * @brief Internal function to write the serialized map. The buffer should be large enough.
+ */
+static void
+nns_edge_metadata_map_write (nns_edge_metadata_map_s * map, char *ptr)
+{
+  nns_edge_metadata_entry_s *entry;
+  nns_edge_metadata_header_s header;
+  nns_edge_metadata_entry_header_s eh;
+  uint32_t i;
+
+  if (map->view) {
+    memcpy (ptr, map->view, map->view_len);
+    return;
+  }
+
+  header.magic = NNS_EDGE_METADATA_MAGIC;
+  header.version = NNS_EDGE_METADATA_VERSION;
+  header.num = map->num;
+  memcpy (ptr, &header, sizeof (header));
+  ptr += sizeof (header);
+
+  for (i = 0; i < map->num; i++) {
+    entry = &map->entries[i];
+
+    eh.hash = (uint32_t) entry->hash;
+    eh.key_len = (uint16_t) strlen (entry->key);
+    eh.type = (uint8_t) entry->type;
+    eh.reserved = 0U;
+    eh.value_len = (uint32_t) nns_edge_metadata_value_size (entry);
+
+    memcpy (ptr, &eh, sizeof (eh));
+    ptr += sizeof (eh);
+
+    memcpy (ptr, entry->key, eh.key_len + 1);
+    ptr += eh.key_len + 1;
+
+    switch (entry->type) {
+      case NNS_EDGE_METADATA_TYPE_STRING:
+        memcpy (ptr, entry->value.str, eh.value_len);
+        break;
+      case NNS_EDGE_METADATA_TYPE_BINARY:
+        memcpy (ptr, entry->value.bin.data, eh.value_len);
+        break;
+      default:
+        /* int64 or double */
+        memcpy (ptr, &entry->value, eh.value_len);
+        break;
+    }
+    ptr += eh.value_len;
+  }
+}
+
+/**
+ * @brief Internal function to get the byte size of serialized metadata.
  */
 int
-nns_edge_metadata_get (nns_edge_metadata_h metadata_h,
-    const char *key, char **value)
+nns_edge_metadata_get_serialized_size (nns_edge_metadata_h metadata_h,
+    nns_size_t * size)
 {
   nns_edge_metadata_s *meta;
-  nns_edge_metadata_node_s *node;
 
   meta = (nns_edge_metadata_s *) metadata_h;
 
-  if (!value)
+  if (!meta || !size)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  node = nns_edge_metadata_find (meta, key);
-  if (node) {
-    *value = nns_edge_strdup (node->value);
-    return (*value) ? NNS_EDGE_ERROR_NONE : NNS_EDGE_ERROR_OUT_OF_MEMORY;
-  }
-
-  return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  return nns_edge_metadata_map_get_size (nns_edge_metadata_get_map (meta),
+      size);
 }
 
 /**
- * @brief Internal function to copy the metadata.
+ * @brief Internal function to serialize the metadata into given buffer.
  */
 int
-nns_edge_metadata_copy (nns_edge_metadata_h dest_h, nns_edge_metadata_h src_h)
+nns_edge_metadata_serialize_into (nns_edge_metadata_h metadata_h,
+    void *data, const nns_size_t data_len)
 {
-  nns_edge_metadata_s *dest, *src;
-  nns_edge_metadata_s tmp;
-  nns_edge_metadata_node_s *node;
+  nns_edge_metadata_s *meta;
+  nns_edge_metadata_map_s *map;
+  nns_size_t total;
   int ret;
 
-  dest = (nns_edge_metadata_s *) dest_h;
-  src = (nns_edge_metadata_s *) src_h;
+  meta = (nns_edge_metadata_s *) metadata_h;
 
-  if (!dest || !src)
+  if (!meta)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  nns_edge_metadata_init (&tmp);
-
-  node = src->list;
-  while (node) {
-    ret = nns_edge_metadata_set (&tmp, node->key, node->value);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_metadata_free (&tmp);
-      return ret;
-    }
+  map = nns_edge_metadata_get_map (meta);
+  ret = nns_edge_metadata_map_get_size (map, &total);
+  if (ret != NNS_EDGE_ERROR_NONE || total == 0U)
+    return ret;
 
-    node = node->next;
+  if (!data || data_len < total) {
+    nns_edge_loge ("Failed to serialize metadata, the buffer is too small.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  /* Replace dest when new metadata is successfully copied. */
-  nns_edge_metadata_free (dest);
-  *dest = tmp;
-
+  nns_edge_metadata_map_write (map, (char *) data);
   return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Internal function to serialize the metadata. Caller should release the returned value using free().
+ * @brief Internal function to serialize the metadata. Caller should release the returned value using nns_edge_free().
  */
 int
 nns_edge_metadata_serialize (nns_edge_metadata_h metadata_h,
     void **data, nns_size_t * data_len)
 {
   nns_edge_metadata_s *meta;
-  nns_edge_metadata_node_s *node;
-  char *serialized, *ptr;
-  nns_size_t total, len;
+  nns_edge_metadata_map_s *map;
+  nns_size_t total;
+  void *serialized;
+  int ret;
 
   meta = (nns_edge_metadata_s *) metadata_h;
 
@@ -283,41 +1667,246 @@ nns_edge_metadata_serialize (nns_edge_metadata_h metadata_h,
   *data = NULL;
   *data_len = 0U;
 
-  if (meta->list_len == 0)
-    return NNS_EDGE_ERROR_NONE;
+  map = nns_edge_metadata_get_map (meta);
+  ret = nns_edge_metadata_map_get_size (map, &total);
+  if (ret != NNS_EDGE_ERROR_NONE || total == 0U)
+    return ret;
+
+  serialized = nns_edge_malloc (total);
+  if (!serialized)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  nns_edge_metadata_map_write (map, (char *) serialized);
+
+  *data = serialized;
+  *data_len = total;
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to deserialize memory into metadata.
+ */
+static int
+nns_edge_metadata_deserialize_internal (nns_edge_metadata_s * meta,
+    void *data, const nns_size_t data_len, bool take)
+{
+  nns_edge_metadata_map_s *map;
+  void *view;
+
+  if (!meta)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  /* length, # of metadata */
-  total = len = sizeof (uint32_t);
+  if (!data || data_len < sizeof (uint32_t))
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  node = meta->list;
-  while (node) {
-    total += (strlen (node->key) + strlen (node->value) + 2);
-    node = node->next;
+  /* The delta should be applied to the metadata synchronized with the sender. */
+  if (((uint32_t *) data)[0] == NNS_EDGE_METADATA_DELTA_MAGIC) {
+    nns_edge_loge ("Failed to deserialize metadata, the data is delta.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  serialized = ptr = (char *) nns_edge_malloc (total);
-  if (!serialized)
+  if (((uint32_t *) data)[0] == NNS_EDGE_METADATA_MAGIC &&
+      !nns_edge_metadata_view_is_valid (data, data_len,
+          NNS_EDGE_METADATA_MAGIC)) {
+    nns_edge_loge ("Failed to deserialize metadata, invalid data.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  map = nns_edge_metadata_reset_map (meta);
+  if (!map)
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
 
-  /* length + list of key-value pair */
-  ((uint32_t *) serialized)[0] = meta->list_len;
-  ptr += len;
+  if (((uint32_t *) data)[0] != NNS_EDGE_METADATA_MAGIC) {
+    int ret = nns_edge_metadata_deserialize_legacy (map, data, data_len);
+
+    if (ret == NNS_EDGE_ERROR_NONE && take)
+      nns_edge_free (data);
+    return ret;
+  }
+
+  if (take) {
+    view = data;
+  } else {
+    view = nns_edge_memdup (data, data_len);
+    if (!view)
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  nns_edge_metadata_set_view (map, view, data_len);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to deserialize memory into metadata.
+ */
+int
+nns_edge_metadata_deserialize (nns_edge_metadata_h metadata_h,
+    const void *data, const nns_size_t data_len)
+{
+  return nns_edge_metadata_deserialize_internal (metadata_h, (void *) data,
+      data_len, false);
+}
+
+/**
+ * @brief Internal function to deserialize memory into metadata, without copying the data.
+ */
+int
+nns_edge_metadata_deserialize_take (nns_edge_metadata_h metadata_h,
+    void *data, const nns_size_t data_len)
+{
+  return nns_edge_metadata_deserialize_internal (metadata_h, data, data_len,
+      true);
+}
+
+/**
+ * @brief Internal function to compare the values of two items.
+ */
+static bool
+nns_edge_metadata_item_is_equal (nns_edge_metadata_item_s * a,
+    nns_edge_metadata_item_s * b)
+{
+  return (a->type == b->type && a->value_len == b->value_len &&
+      memcmp (a->value, b->value, a->value_len) == 0);
+}
+
+/**
+ * @brief Internal function to write the entry of serialized metadata. Returns the byte size of the entry.
+ * @note If ptr is null, this function only calculates the size of the entry.
+ */
+static nns_size_t
+nns_edge_metadata_write_entry (char *ptr, nns_edge_metadata_item_s * item,
+    const uint8_t type)
+{
+  nns_edge_metadata_entry_header_s eh;
+
+  eh.hash = (uint32_t) nns_edge_metadata_hash (item->key);
+  eh.key_len = (uint16_t) strlen (item->key);
+  eh.type = type;
+  eh.reserved = 0U;
+
+  if (type == NNS_EDGE_METADATA_TYPE_REMOVED)
+    eh.value_len = 0U;
+  else if (type == NNS_EDGE_METADATA_TYPE_STRING)
+    eh.value_len = (uint32_t) item->value_len + 1;
+  else
+    eh.value_len = (uint32_t) item->value_len;
+
+  if (ptr) {
+    memcpy (ptr, &eh, sizeof (eh));
+    ptr += sizeof (eh);
+
+    memcpy (ptr, item->key, eh.key_len + 1);
+    ptr += eh.key_len + 1;
+
+    if (type == NNS_EDGE_METADATA_TYPE_STRING) {
+      memcpy (ptr, item->value, item->value_len);
+      ptr[item->value_len] = '\0';
+    } else if (eh.value_len > 0U) {
+      memcpy (ptr, item->value, eh.value_len);
+    }
+  }
+
+  return sizeof (eh) + eh.key_len + 1 + eh.value_len;
+}
+
+/**
+ * @brief Internal function to write the delta of the metadata from the base. Returns the number of entries.
+ * @note If ptr is null, this function only calculates the size of the delta.
+ */
+static uint32_t
+nns_edge_metadata_write_delta (char *ptr, nns_edge_metadata_map_s * base,
+    nns_edge_metadata_map_s * meta, nns_size_t * size)
+{
+  nns_edge_metadata_iter_s iter;
+  nns_edge_metadata_item_s item, old;
+  nns_size_t len;
+  uint32_t num = 0U;
+
+  *size = sizeof (nns_edge_metadata_header_s);
+
+  /* Added or changed items */
+  nns_edge_metadata_iter_init (&iter, meta);
+  while (nns_edge_metadata_iter_next (&iter, &item)) {
+    if (nns_edge_metadata_find (base, item.key, &old) &&
+        nns_edge_metadata_item_is_equal (&item, &old))
+      continue;
+
+    len = nns_edge_metadata_write_entry (ptr ? ptr + *size : NULL, &item,
+        (uint8_t) item.type);
+    *size += len;
+    num++;
+  }
+
+  /* Removed keys */
+  nns_edge_metadata_iter_init (&iter, base);
+  while (nns_edge_metadata_iter_next (&iter, &item)) {
+    if (nns_edge_metadata_find (meta, item.key, &old))
+      continue;
+
+    len = nns_edge_metadata_write_entry (ptr ? ptr + *size : NULL, &item,
+        NNS_EDGE_METADATA_TYPE_REMOVED);
+    *size += len;
+    num++;
+  }
+
+  return num;
+}
+
+/**
+ * @brief Internal function to serialize the delta of the metadata from the base. Caller should release the returned value using nns_edge_free().
+ */
+int
+nns_edge_metadata_serialize_delta (nns_edge_metadata_h base_h,
+    nns_edge_metadata_h metadata_h, void **data, nns_size_t * data_len)
+{
+  nns_edge_metadata_map_s *base, *meta;
+  nns_edge_metadata_header_s header;
+  char *serialized;
+  nns_size_t total;
+
+  if (!base_h || !metadata_h)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!data || !data_len)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  *data = NULL;
+  *data_len = 0U;
+
+  base = nns_edge_metadata_get_map (base_h);
+  meta = nns_edge_metadata_get_map (metadata_h);
+
+  /* Both are empty, nothing to send. */
+  if ((!base || (!base->view && base->num == 0U)) &&
+      (!meta || (!meta->view && meta->num == 0U)))
+    return NNS_EDGE_ERROR_NONE;
 
-  node = meta->list;
-  while (node) {
-    len = strlen (node->key);
-    memcpy (ptr, node->key, len);
-    ptr[len] = '\0';
-    ptr += (len + 1);
+  header.magic = NNS_EDGE_METADATA_DELTA_MAGIC;
+  header.version = NNS_EDGE_METADATA_VERSION;
+  header.num = 0U;
 
-    len = strlen (node->value);
-    memcpy (ptr, node->value, len);
-    ptr[len] = '\0';
-    ptr += (len + 1);
+  /* The metadata shares the block with the base, there is no change. */
+  if (base != meta) {
+    header.num = nns_edge_metadata_write_delta (NULL, base, meta, &total);
 
-    node = node->next;
+    if (header.num > 0U && total > UINT32_MAX) {
+      nns_edge_loge ("Failed to serialize the delta of metadata, too large.");
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
   }
 
+  if (header.num == 0U)
+    total = sizeof (header);
+
+  serialized = (char *) nns_edge_malloc (total);
+  if (!serialized)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+
+  if (header.num > 0U)
+    nns_edge_metadata_write_delta (serialized, base, meta, &total);
+  memcpy (serialized, &header, sizeof (header));
+
   *data = serialized;
   *data_len = total;
 
@@ -325,15 +1914,31 @@ nns_edge_metadata_serialize (nns_edge_metadata_h metadata_h,
 }
 
 /**
- * @brief Internal function to deserialize memory into metadata.
+ * @brief Internal function to check the serialized data is the delta of metadata.
+ */
+bool
+nns_edge_metadata_is_delta (const void *data, const nns_size_t data_len)
+{
+  uint32_t magic;
+
+  if (!data || data_len < sizeof (uint32_t))
+    return false;
+
+  memcpy (&magic, data, sizeof (uint32_t));
+  return (magic == NNS_EDGE_METADATA_DELTA_MAGIC);
+}
+
+/**
+ * @brief Internal function to update the metadata with the serialized delta.
  */
 int
-nns_edge_metadata_deserialize (nns_edge_metadata_h metadata_h,
+nns_edge_metadata_apply_delta (nns_edge_metadata_h metadata_h,
     const void *data, const nns_size_t data_len)
 {
   nns_edge_metadata_s *meta;
-  char *key, *value;
-  nns_size_t cur, total;
+  nns_edge_metadata_map_s *map, delta;
+  nns_edge_metadata_iter_s iter;
+  nns_edge_metadata_item_s item;
   int ret;
 
   meta = (nns_edge_metadata_s *) metadata_h;
@@ -341,27 +1946,37 @@ nns_edge_metadata_deserialize (nns_edge_metadata_h metadata_h,
   if (!meta)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
 
-  if (!data || data_len <= 0)
+  if (!nns_edge_metadata_view_is_valid (data, data_len,
+          NNS_EDGE_METADATA_DELTA_MAGIC)) {
+    nns_edge_loge ("Failed to apply the delta of metadata, invalid data.");
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
 
-  nns_edge_metadata_free (meta);
+  /* Iterate the delta without copying the data. */
+  nns_edge_metadata_init (&delta, NULL);
+  nns_edge_metadata_set_view (&delta, (void *) data, data_len);
 
-  /* length + list of key-value pair */
-  total = ((uint32_t *) data)[0];
+  if (delta.view_num == 0U)
+    return NNS_EDGE_ERROR_NONE;
 
-  cur = sizeof (uint32_t);
-  while (cur < data_len || meta->list_len < total) {
-    key = (char *) data + cur;
-    cur += (strlen (key) + 1);
+  map = nns_edge_metadata_get_writable_map (meta);
+  if (!map)
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
 
-    value = (char *) data + cur;
-    cur += (strlen (value) + 1);
+  ret = nns_edge_metadata_materialize (map);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
 
-    ret = nns_edge_metadata_set (meta, key, value);
-    if (ret != NNS_EDGE_ERROR_NONE) {
-      nns_edge_metadata_free (meta);
-      return ret;
+  nns_edge_metadata_iter_init (&iter, &delta);
+  while (nns_edge_metadata_iter_next (&iter, &item)) {
+    if ((uint8_t) item.type == NNS_EDGE_METADATA_TYPE_REMOVED) {
+      nns_edge_metadata_remove_entry (map, item.key);
+      continue;
     }
+
+    ret = nns_edge_metadata_put_item (map, &item);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      return ret;
   }
 
   return NNS_EDGE_ERROR_NONE;
@@ -14,6 +14,7 @@
 #ifndef __NNSTREAMER_EDGE_METADATA_H__
 #define __NNSTREAMER_EDGE_METADATA_H__
 
+#include <stdbool.h>
 #include "nnstreamer-edge.h"
 
 #ifdef __cplusplus
@@ -22,41 +23,140 @@ extern "C" {
 
 typedef void *nns_edge_metadata_h;
 
+/**
+ * @brief Enumeration for the type of metadata value.
+ */
+typedef enum {
+  NNS_EDGE_METADATA_TYPE_STRING = 0,
+  NNS_EDGE_METADATA_TYPE_INT64,
+  NNS_EDGE_METADATA_TYPE_DOUBLE,
+  NNS_EDGE_METADATA_TYPE_BINARY,
+  NNS_EDGE_METADATA_TYPE_UNKNOWN
+} nns_edge_metadata_type_e;
+
 /**
  * @brief Internal function to create metadata.
  */
 int nns_edge_metadata_create (nns_edge_metadata_h *metadata_h);
 
+/**
+ * @brief Internal function to create metadata with given allocator. The handle, the storage of entries and binary values are allocated with the allocator.
+ * @note The buffers returned to the caller (serialized data, copied binary value) are allocated with the default allocator.
+ */
+int nns_edge_metadata_create_with_allocator (nns_edge_metadata_h *metadata_h, const nns_edge_allocator_s *allocator);
+
 /**
  * @brief Internal function to destroy metadata.
  */
 int nns_edge_metadata_destroy (nns_edge_metadata_h metadata_h);
 
+/**
+ * @brief Internal function to remove all items in the metadata.
+ */
+int nns_edge_metadata_clear (nns_edge_metadata_h metadata_h);
+
 /**
  * @brief Internal function to set the metadata.
  */
 int nns_edge_metadata_set (nns_edge_metadata_h metadata_h, const char *key, const char *value);
 
 /**
- * @brief Internal function to get the metadata in the list. Caller should release the returned value using free().
+ * @brief Internal function to get the metadata as a string. Caller should release the returned value using free().
+ * @note The int64 or double value is converted to string. It returns an error if the value is binary.
  */
 int nns_edge_metadata_get (nns_edge_metadata_h metadata_h, const char *key, char **value);
 
+/**
+ * @brief Internal function to set the metadata with int64 value.
+ */
+int nns_edge_metadata_set_int64 (nns_edge_metadata_h metadata_h, const char *key, const int64_t value);
+
+/**
+ * @brief Internal function to get the int64 value of metadata. The string value is converted to int64.
+ */
+int nns_edge_metadata_get_int64 (nns_edge_metadata_h metadata_h, const char *key, int64_t *value);
+
+/**
+ * @brief Internal function to set the metadata with double value.
+ */
+int nns_edge_metadata_set_double (nns_edge_metadata_h metadata_h, const char *key, const double value);
+
+/**
+ * @brief Internal function to get the double value of metadata. The int64 or string value is converted to double.
+ */
+int nns_edge_metadata_get_double (nns_edge_metadata_h metadata_h, const char *key, double *value);
+
+/**
+ * @brief Internal function to set the metadata with binary value.
+ */
+int nns_edge_metadata_set_binary (nns_edge_metadata_h metadata_h, const char *key, const void *value, const nns_size_t value_len);
+
+/**
+ * @brief Internal function to get the binary value of metadata. Caller should release the returned value using nns_edge_free().
+ */
+int nns_edge_metadata_get_binary (nns_edge_metadata_h metadata_h, const char *key, void **value, nns_size_t *value_len);
+
+/**
+ * @brief Internal function to get the type of metadata.
+ */
+int nns_edge_metadata_get_type (nns_edge_metadata_h metadata_h, const char *key, nns_edge_metadata_type_e *type);
+
+/**
+ * @brief Internal function to remove the item of given key. It does nothing if the key does not exist.
+ */
+int nns_edge_metadata_remove (nns_edge_metadata_h metadata_h, const char *key);
+
 /**
  * @brief Internal function to copy the metadata.
  */
 int nns_edge_metadata_copy (nns_edge_metadata_h dest_h, nns_edge_metadata_h src_h);
 
 /**
- * @brief Internal function to serialize the metadata. Caller should release the returned value using free().
+ * @brief Internal function to serialize the metadata. Caller should release the returned value using nns_edge_free().
+ * @note The metadata is serialized with length-prefixed format (header and the list of entries), which keeps the type of values.
  */
 int nns_edge_metadata_serialize (nns_edge_metadata_h metadata_h, void **data, nns_size_t *data_len);
 
+/**
+ * @brief Internal function to get the byte size of serialized metadata. The size is 0 if the metadata is empty.
+ */
+int nns_edge_metadata_get_serialized_size (nns_edge_metadata_h metadata_h, nns_size_t *size);
+
+/**
+ * @brief Internal function to serialize the metadata into given buffer.
+ * @note The buffer should be larger than the size from nns_edge_metadata_get_serialized_size(). Nothing is written if the metadata is empty.
+ */
+int nns_edge_metadata_serialize_into (nns_edge_metadata_h metadata_h, void *data, const nns_size_t data_len);
+
 /**
  * @brief Internal function to deserialize memory into metadata.
+ * @note The data is validated and copied, the entries are read from the copied data until the metadata is updated. The metadata serialized with old version is also supported.
  */
 int nns_edge_metadata_deserialize (nns_edge_metadata_h metadata_h, const void *data, const nns_size_t data_len);
 
+/**
+ * @brief Internal function to deserialize memory into metadata, without copying the data.
+ * @note If successful, the metadata takes the ownership of the data and the entries are read from the data until the metadata is updated. The data should be allocated with nns_edge_malloc().
+ */
+int nns_edge_metadata_deserialize_take (nns_edge_metadata_h metadata_h, void *data, const nns_size_t data_len);
+
+/**
+ * @brief Internal function to serialize the delta of the metadata from the base. Caller should release the returned value using nns_edge_free().
+ * @note The delta includes the items added or changed, and the keys removed from the base. It is empty if both metadata are empty.
+ */
+int nns_edge_metadata_serialize_delta (nns_edge_metadata_h base_h, nns_edge_metadata_h metadata_h, void **data, nns_size_t *data_len);
+
+/**
+ * @brief Internal function to check the serialized data is the delta of metadata.
+ */
+bool nns_edge_metadata_is_delta (const void *data, const nns_size_t data_len);
+
+/**
+ * @brief Internal function to update the metadata with the serialized delta.
+ * @note The delta should be serialized with the base which has same items as the metadata.
+ */
+int nns_edge_metadata_apply_delta (nns_edge_metadata_h metadata_h, const void *data, const nns_size_t data_len);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -42,6 +42,10 @@ typedef struct
   pthread_mutex_t lock;
   pthread_cond_t cond;
   bool cleared;
+
+  /* buffer to serialize edge data, accessed in the send thread only */
+  void *send_buf;
+  nns_size_t send_buf_size;
 } nns_edge_broker_s;
 
 /**
@@ -70,32 +74,38 @@ on_message_callback (struct mosquitto *client, void *data,
       message->mid, message->topic);
 
   msg_len = (nns_size_t) message->payloadlen;
-  msg = nns_edge_memdup (message->payload, msg_len);
-
-  if (msg) {
-    if (bh->event_cb) {
-      nns_edge_data_h data_h;
 
-      if (nns_edge_data_create (&data_h) != NNS_EDGE_ERROR_NONE) {
-        nns_edge_loge ("Failed to create data handle in msg thread.");
-        SAFE_FREE (msg);
-        return;
-      }
+  if (bh->event_cb) {
+    nns_edge_data_h data_h;
 
-      nns_edge_data_deserialize (data_h, (void *) msg, (nns_size_t) msg_len);
+    if (nns_edge_data_create (&data_h) != NNS_EDGE_ERROR_NONE) {
+      nns_edge_loge ("Failed to create data handle in msg thread.");
+      return;
+    }
 
+    /**
+     * The payload is valid until this callback returns and the data handle is released before that.
+     * Deserialize the message without copying the raw data.
+     */
+    ret = nns_edge_data_deserialize_view (data_h, message->payload, msg_len,
+        NULL);
+    if (ret == NNS_EDGE_ERROR_NONE) {
       ret = nns_edge_event_invoke_callback (bh->event_cb, bh->user_data,
           NNS_EDGE_EVENT_NEW_DATA_RECEIVED, data_h, sizeof (nns_edge_data_h),
           NULL);
       if (ret != NNS_EDGE_ERROR_NONE)
         nns_edge_loge ("Failed to send an event for received message.");
-
-      nns_edge_data_destroy (data_h);
-      SAFE_FREE (msg);
     } else {
-      /* Push received message into msg queue. DO NOT free msg here. */
-      nns_edge_queue_push (bh->message_queue, msg, msg_len, nns_edge_free);
+      nns_edge_loge ("Failed to deserialize received message.");
     }
+
+    nns_edge_data_destroy (data_h);
+  } else {
+    msg = nns_edge_memdup (message->payload, msg_len);
+
+    /* Push received message into msg queue. DO NOT free msg here. */
+    if (msg)
+      nns_edge_queue_push (bh->message_queue, msg, msg_len, nns_edge_free);
   }
 
   return;
@@ -116,7 +126,7 @@ _nns_edge_mqtt_init_client (const char *id, const char *topic, const char *host,
 
   nns_edge_logd ("Trying to connect MQTT (ID:%s, URL:%s:%d).", id, host, port);
 
-  bh = (nns_edge_broker_s *) calloc (1, sizeof (nns_edge_broker_s));
+  bh = (nns_edge_broker_s *) nns_edge_calloc (1, sizeof (nns_edge_broker_s));
   if (!bh) {
     nns_edge_loge ("Failed to allocate memory for broker handle.");
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -176,7 +186,7 @@ _nns_edge_mqtt_init_client (const char *id, const char *topic, const char *host,
   return NNS_EDGE_ERROR_NONE;
 
 error:
-  SAFE_FREE (bh);
+  SAFE_EDGE_FREE (bh);
   if (handle)
     mosquitto_destroy (handle);
   mosquitto_lib_cleanup ();
@@ -311,10 +321,11 @@ nns_edge_mqtt_close (nns_edge_broker_h broker_h)
   bh->message_queue = NULL;
   nns_edge_lock_destroy (bh);
   nns_edge_cond_destroy (bh);
+  nns_edge_free (bh->send_buf);
   SAFE_FREE (bh->id);
   SAFE_FREE (bh->topic);
   SAFE_FREE (bh->host);
-  SAFE_FREE (bh);
+  SAFE_EDGE_FREE (bh);
 
   return NNS_EDGE_ERROR_NONE;
 }
@@ -323,23 +334,32 @@ nns_edge_mqtt_close (nns_edge_broker_h broker_h)
  * @brief Internal util function to send edge-data via MQTT connection.
  */
 int
-nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h)
+nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h,
+    nns_size_t alignment)
 {
-  int ret;
-  void *data = NULL;
+  nns_edge_broker_s *bh;
   nns_size_t size;
+  int ret;
+
+  if (!broker_h) {
+    nns_edge_loge ("Invalid param, given broker handle is invalid.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  bh = (nns_edge_broker_s *) broker_h;
 
-  ret = nns_edge_data_serialize (data_h, &data, &size);
+  /* MQTT library copies the payload, reuse the buffer to serialize edge data. */
+  ret = nns_edge_data_serialize_reuse (data_h, alignment, &bh->send_buf,
+      &bh->send_buf_size, &size);
   if (NNS_EDGE_ERROR_NONE != ret) {
     nns_edge_loge ("Failed to serialize the edge data.");
     return ret;
   }
 
-  ret = nns_edge_mqtt_publish (broker_h, data, size);
+  ret = nns_edge_mqtt_publish (broker_h, bh->send_buf, size);
   if (NNS_EDGE_ERROR_NONE != ret)
     nns_edge_loge ("Failed to send data to destination.");
 
-  SAFE_FREE (data);
   return ret;
 }
 
@@ -53,14 +53,14 @@ int nns_edge_mqtt_subscribe (nns_edge_broker_h broker_h);
 bool nns_edge_mqtt_is_connected (nns_edge_broker_h broker_h);
 
 /**
- * @brief Get message from mqtt broker with within timeout. (0 for inifinite timeout)
+ * @brief Get message from mqtt broker with within timeout. (0 for inifinite timeout) Caller should release the message using nns_edge_free().
  */
 int nns_edge_mqtt_get_message (nns_edge_broker_h broker_h, void **msg, nns_size_t *msg_len, unsigned int timeout);
 
 /**
- * @brief Internal util function to send edge-data via MQTT connection.
+ * @brief Internal util function to send edge-data via MQTT connection. If alignment is larger than 0, edge-data is serialized with aligned format.
  */
-int nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h);
+int nns_edge_mqtt_publish_data (nns_edge_broker_h broker_h, nns_edge_data_h data_h, nns_size_t alignment);
 
 /**
  * @brief Set event callback for new message.
@@ -0,0 +1,457 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2022 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nnstreamer-edge-pool.c
+ * @date   16 October 2026
+ * @brief  Thread-safe pool to recycle edge data handles and memory buffers.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @bug    No known bugs except for NYI items.
+ */
+
+#include "nnstreamer-edge-data.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-pool.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief The size classes of buffers, power of 2 from 64 bytes to 16 megabytes.
+ */
+#define POOL_MIN_SHIFT (6U)
+#define POOL_MAX_SHIFT (24U)
+#define POOL_NUM_CLASSES (POOL_MAX_SHIFT - POOL_MIN_SHIFT + 1U)
+#define POOL_CLASS_NONE (0xffffffffU)
+
+/**
+ * @brief Default limits of the pool.
+ */
+#define POOL_DEFAULT_DATA_LIMIT (16U)
+#define POOL_DEFAULT_BUFFER_LIMIT (4U * 1024U * 1024U)
+
+/**
+ * @brief The header size of the buffer, to keep the alignment of the memory returned to caller.
+ */
+#define POOL_BUFFER_HEADER_SIZE (16U)
+#define POOL_BUFFER_TO_MEM(b) ((void *) ((char *) (b) + POOL_BUFFER_HEADER_SIZE))
+#define POOL_MEM_TO_BUFFER(m) ((nns_edge_pool_buffer_s *) ((char *) (m) - POOL_BUFFER_HEADER_SIZE))
+
+/**
+ * @brief Internal structure for the header of pooled buffer.
+ */
+typedef struct _nns_edge_pool_buffer_s nns_edge_pool_buffer_s;
+
+/**
+ * @brief Internal structure for the header of pooled buffer.
+ */
+struct _nns_edge_pool_buffer_s
+{
+  uint32_t index; /**< size class of the buffer */
+  nns_edge_pool_buffer_s *next;
+};
+
+/**
+ * @brief Internal structure for pool.
+ */
+typedef struct
+{
+  pthread_mutex_t lock;
+
+  /* recycled data handles */
+  unsigned int max_data;
+  unsigned int num_data;
+  nns_edge_data_h *data;
+
+  /* recycled buffers */
+  nns_edge_allocator_s allocator;
+  nns_size_t max_bytes;
+  nns_size_t cached_bytes;
+  nns_edge_pool_buffer_s *buffers[POOL_NUM_CLASSES];
+
+  /* statistics */
+  uint64_t data_hit;
+  uint64_t data_miss;
+  uint64_t buffer_hit;
+  uint64_t buffer_miss;
+} nns_edge_pool_s;
+
+/**
+ * @brief Get the size class of the buffer.
+ */
+static uint32_t
+_get_size_class (nns_size_t size)
+{
+  uint32_t shift = POOL_MIN_SHIFT;
+
+  while (shift <= POOL_MAX_SHIFT) {
+    if (size <= ((nns_size_t) 1 << shift))
+      return shift - POOL_MIN_SHIFT;
+    shift++;
+  }
+
+  return POOL_CLASS_NONE;
+}
+
+/**
+ * @brief Get the byte size of the size class.
+ */
+static nns_size_t
+_get_class_size (uint32_t index)
+{
+  return (nns_size_t) 1 << (index + POOL_MIN_SHIFT);
+}
+
+/**
+ * @brief Release cached data handles until the number of data is less than given limit.
+ * @note This function should be called with lock.
+ */
+static void
+_trim_data (nns_edge_pool_s * pool, unsigned int limit)
+{
+  while (pool->num_data > limit)
+    nns_edge_data_destroy (pool->data[--pool->num_data]);
+}
+
+/**
+ * @brief Release cached buffers until the total size is less than given limit.
+ * @note This function should be called with lock.
+ */
+static void
+_trim_buffers (nns_edge_pool_s * pool, nns_size_t limit)
+{
+  nns_edge_pool_buffer_s *buffer;
+  uint32_t i;
+
+  /* Release large buffers first. */
+  i = POOL_NUM_CLASSES;
+  while (pool->cached_bytes > limit && i > 0U) {
+    buffer = pool->buffers[i - 1];
+
+    if (buffer) {
+      pool->buffers[i - 1] = buffer->next;
+      pool->cached_bytes -= _get_class_size (i - 1);
+      nns_edge_allocator_free (&pool->allocator, buffer);
+    } else {
+      i--;
+    }
+  }
+}
+
+/**
+ * @brief Create pool.
+ */
+int
+nns_edge_pool_create (nns_edge_pool_h * handle)
+{
+  nns_edge_pool_s *pool;
+
+  if (!handle) {
+    nns_edge_loge ("[Pool] Invalid param, handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  pool = (nns_edge_pool_s *) nns_edge_calloc (1, sizeof (nns_edge_pool_s));
+  if (!pool) {
+    nns_edge_loge ("[Pool] Failed to allocate new memory.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  nns_edge_lock_init (pool);
+  pool->max_bytes = POOL_DEFAULT_BUFFER_LIMIT;
+
+  if (nns_edge_pool_set_data_limit (pool, POOL_DEFAULT_DATA_LIMIT) !=
+      NNS_EDGE_ERROR_NONE) {
+    nns_edge_pool_destroy (pool);
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  *handle = pool;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Destroy pool and release all cached data handles and buffers.
+ */
+int
+nns_edge_pool_destroy (nns_edge_pool_h handle)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+
+  if (!pool) {
+    nns_edge_loge ("[Pool] Invalid param, pool is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (pool);
+  _trim_data (pool, 0U);
+  _trim_buffers (pool, 0U);
+  SAFE_EDGE_FREE (pool->data);
+  nns_edge_unlock (pool);
+
+  nns_edge_lock_destroy (pool);
+  SAFE_EDGE_FREE (pool);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Set the max number of cached data handles.
+ */
+int
+nns_edge_pool_set_data_limit (nns_edge_pool_h handle, unsigned int limit)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  nns_edge_data_h *data = NULL;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!pool) {
+    nns_edge_loge ("[Pool] Invalid param, pool is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (pool);
+
+  _trim_data (pool, limit);
+
+  if (limit > 0U) {
+    data = (nns_edge_data_h *) nns_edge_allocator_realloc (NULL, pool->data,
+        sizeof (nns_edge_data_h) * pool->max_data,
+        sizeof (nns_edge_data_h) * limit);
+    if (!data) {
+      nns_edge_loge ("[Pool] Failed to allocate new memory for data.");
+      ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+      goto done;
+    }
+  } else {
+    SAFE_EDGE_FREE (pool->data);
+  }
+
+  pool->data = data;
+  pool->max_data = limit;
+
+done:
+  nns_edge_unlock (pool);
+  return ret;
+}
+
+/**
+ * @brief Set the max bytes of cached buffers.
+ */
+int
+nns_edge_pool_set_buffer_limit (nns_edge_pool_h handle, nns_size_t limit)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+
+  if (!pool) {
+    nns_edge_loge ("[Pool] Invalid param, pool is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (pool);
+  _trim_buffers (pool, limit);
+  pool->max_bytes = limit;
+  nns_edge_unlock (pool);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Set the memory allocator of buffers.
+ */
+int
+nns_edge_pool_set_allocator (nns_edge_pool_h handle,
+    const nns_edge_allocator_s * allocator)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+
+  if (!pool) {
+    nns_edge_loge ("[Pool] Invalid param, pool is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (pool);
+
+  /* Release cached data handles and buffers allocated with old allocator. */
+  _trim_data (pool, 0U);
+  _trim_buffers (pool, 0U);
+
+  if (allocator)
+    pool->allocator = *allocator;
+  else
+    memset (&pool->allocator, 0, sizeof (nns_edge_allocator_s));
+
+  nns_edge_unlock (pool);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Get the data handle from the pool.
+ */
+int
+nns_edge_pool_get_data (nns_edge_pool_h handle, nns_edge_data_h * data_h)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  nns_edge_allocator_s allocator;
+
+  if (!pool) {
+    nns_edge_loge ("[Pool] Invalid param, pool is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  if (!data_h) {
+    nns_edge_loge ("[Pool] Invalid param, data_h is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (pool);
+  if (pool->num_data > 0U) {
+    *data_h = pool->data[--pool->num_data];
+    pool->data_hit++;
+    nns_edge_unlock (pool);
+    return NNS_EDGE_ERROR_NONE;
+  }
+  pool->data_miss++;
+  allocator = pool->allocator;
+  nns_edge_unlock (pool);
+
+  return nns_edge_data_create_with_allocator (data_h, &allocator);
+}
+
+/**
+ * @brief Return the data handle to the pool.
+ */
+void
+nns_edge_pool_put_data (nns_edge_pool_h handle, nns_edge_data_h data_h)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+
+  if (!pool || !data_h)
+    return;
+
+  /* Release raw data and information before caching the handle. */
+  if (nns_edge_data_reset (data_h) == NNS_EDGE_ERROR_NONE) {
+    nns_edge_lock (pool);
+    if (pool->num_data < pool->max_data) {
+      pool->data[pool->num_data++] = data_h;
+      data_h = NULL;
+    }
+    nns_edge_unlock (pool);
+  }
+
+  if (data_h)
+    nns_edge_data_destroy (data_h);
+}
+
+/**
+ * @brief Allocate the buffer from the pool.
+ */
+void *
+nns_edge_pool_alloc (nns_edge_pool_h handle, nns_size_t size)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  nns_edge_pool_buffer_s *buffer = NULL;
+  uint32_t index;
+
+  if (!pool)
+    return nns_edge_malloc (size);
+
+  if (size == 0U || size > SIZE_MAX - POOL_BUFFER_HEADER_SIZE) {
+    nns_edge_loge ("[Pool] Invalid param, cannot allocate %llu bytes.",
+        (unsigned long long) size);
+    return NULL;
+  }
+
+  index = _get_size_class (size);
+
+  nns_edge_lock (pool);
+  if (index != POOL_CLASS_NONE && pool->buffers[index]) {
+    buffer = pool->buffers[index];
+    pool->buffers[index] = buffer->next;
+    pool->cached_bytes -= _get_class_size (index);
+    pool->buffer_hit++;
+  } else {
+    pool->buffer_miss++;
+  }
+  nns_edge_unlock (pool);
+
+  if (!buffer) {
+    if (index != POOL_CLASS_NONE)
+      size = _get_class_size (index);
+
+    buffer = (nns_edge_pool_buffer_s *) nns_edge_allocator_alloc (&pool->allocator,
+        POOL_BUFFER_HEADER_SIZE + size);
+    if (!buffer) {
+      nns_edge_loge ("[Pool] Failed to allocate new memory for buffer.");
+      return NULL;
+    }
+
+    buffer->index = index;
+  }
+
+  buffer->next = NULL;
+  return POOL_BUFFER_TO_MEM (buffer);
+}
+
+/**
+ * @brief Return the buffer to the pool.
+ */
+void
+nns_edge_pool_free (nns_edge_pool_h handle, void *buffer)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  nns_edge_pool_buffer_s *b;
+  nns_size_t size;
+
+  if (!buffer)
+    return;
+
+  if (!pool) {
+    nns_edge_free (buffer);
+    return;
+  }
+
+  b = POOL_MEM_TO_BUFFER (buffer);
+
+  if (b->index != POOL_CLASS_NONE) {
+    size = _get_class_size (b->index);
+
+    nns_edge_lock (pool);
+    if (pool->cached_bytes + size <= pool->max_bytes) {
+      b->next = pool->buffers[b->index];
+      pool->buffers[b->index] = b;
+      pool->cached_bytes += size;
+      b = NULL;
+    }
+    nns_edge_unlock (pool);
+  }
+
+  /* The pool is full or the buffer is larger than max size class. */
+  if (b)
+    nns_edge_allocator_free (&pool->allocator, b);
+}
+
+/**
+ * @brief Get the statistics of the pool.
+ */
+char *
+nns_edge_pool_get_stats (nns_edge_pool_h handle)
+{
+  nns_edge_pool_s *pool = (nns_edge_pool_s *) handle;
+  char *stats;
+
+  if (!pool) {
+    nns_edge_loge ("[Pool] Invalid param, pool is null.");
+    return NULL;
+  }
+
+  nns_edge_lock (pool);
+  stats = nns_edge_strdup_printf ("data_hit=%llu,data_miss=%llu,"
+      "data_cached=%u,buffer_hit=%llu,buffer_miss=%llu,buffer_cached_bytes=%llu",
+      (unsigned long long) pool->data_hit, (unsigned long long) pool->data_miss,
+      pool->num_data, (unsigned long long) pool->buffer_hit,
+      (unsigned long long) pool->buffer_miss,
+      (unsigned long long) pool->cached_bytes);
+  nns_edge_unlock (pool);
+
+  return stats;
+}
@@ -0,0 +1,120 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2022 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nnstreamer-edge-pool.h
+ * @date   16 October 2026
+ * @brief  Thread-safe pool to recycle edge data handles and memory buffers.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug No known bugs except for NYI items.
+ */
+
+#ifndef __NNSTREAMER_EDGE_POOL_H__
+#define __NNSTREAMER_EDGE_POOL_H__
+
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void *nns_edge_pool_h;
+
+/**
+ * @brief Create pool.
+ * @param[out] handle Newly created handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_create (nns_edge_pool_h *handle);
+
+/**
+ * @brief Destroy pool and release all cached data handles and buffers.
+ * @param[in] handle The pool handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_destroy (nns_edge_pool_h handle);
+
+/**
+ * @brief Set the max number of cached data handles. 0 disables recycling data handles.
+ * @param[in] handle The pool handle.
+ * @param[in] limit The max number of data handles in the pool.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_set_data_limit (nns_edge_pool_h handle, unsigned int limit);
+
+/**
+ * @brief Set the max bytes of cached buffers. 0 disables recycling buffers.
+ * @param[in] handle The pool handle.
+ * @param[in] limit The max bytes of buffers in the pool.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_set_buffer_limit (nns_edge_pool_h handle, nns_size_t limit);
+
+/**
+ * @brief Set the memory allocator of buffers and data handles. Cached buffers and data handles are released.
+ * @param[in] handle The pool handle.
+ * @param[in] allocator The memory allocator, null to use the default allocator.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ * @note The buffers allocated with old allocator should be released before changing the allocator.
+ */
+int nns_edge_pool_set_allocator (nns_edge_pool_h handle, const nns_edge_allocator_s *allocator);
+
+/**
+ * @brief Get the data handle from the pool. New handle is created if the pool is empty.
+ * @param[in] handle The pool handle.
+ * @param[out] data_h The edge data handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_pool_get_data (nns_edge_pool_h handle, nns_edge_data_h *data_h);
+
+/**
+ * @brief Return the data handle to the pool. The handle is destroyed if the pool is full.
+ * @param[in] handle The pool handle.
+ * @param[in] data_h The edge data handle.
+ */
+void nns_edge_pool_put_data (nns_edge_pool_h handle, nns_edge_data_h data_h);
+
+/**
+ * @brief Allocate the buffer from the pool.
+ * @param[in] handle Nullable, the pool handle. If null, this function allocates new memory.
+ * @param[in] size The byte size of the buffer.
+ * @return Newly allocated buffer, null if failed to allocate memory.
+ * @note Caller should release the buffer using nns_edge_pool_free() with the same pool handle.
+ */
+void *nns_edge_pool_alloc (nns_edge_pool_h handle, nns_size_t size);
+
+/**
+ * @brief Return the buffer to the pool. The buffer is released if the pool is full.
+ * @param[in] handle Nullable, the pool handle used to allocate the buffer.
+ * @param[in] buffer The buffer to be released.
+ */
+void nns_edge_pool_free (nns_edge_pool_h handle, void *buffer);
+
+/**
+ * @brief Get the statistics of the pool.
+ * @param[in] handle The pool handle.
+ * @return Newly allocated string, null if given param is invalid.
+ * @note Caller should release returned string using free().
+ */
+char *nns_edge_pool_get_stats (nns_edge_pool_h handle);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_POOL_H__ */
@@ -70,7 +70,7 @@ _pop_data (nns_edge_queue_s * q, bool clear, void **data, nns_size_t * size)
       popped = true;
     }
 
-    SAFE_FREE (qdata);
+    SAFE_EDGE_FREE (qdata);
   }
 
   return popped;
@@ -89,7 +89,7 @@ nns_edge_queue_create (nns_edge_queue_h * handle)
     return NNS_EDGE_ERROR_INVALID_PARAMETER;
   }
 
-  q = calloc (1, sizeof (nns_edge_queue_s));
+  q = nns_edge_calloc (1, sizeof (nns_edge_queue_s));
   if (!q) {
     nns_edge_loge ("[Queue] Failed to allocate new memory.");
     return NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -121,7 +121,7 @@ nns_edge_queue_destroy (nns_edge_queue_h handle)
 
   nns_edge_cond_destroy (q);
   nns_edge_lock_destroy (q);
-  SAFE_FREE (q);
+  SAFE_EDGE_FREE (q);
 
   return NNS_EDGE_ERROR_NONE;
 }
@@ -209,7 +209,7 @@ nns_edge_queue_push (nns_edge_queue_h handle, void *data, nns_size_t size,
     }
   }
 
-  qdata = calloc (1, sizeof (nns_edge_queue_data_s));
+  qdata = nns_edge_calloc (1, sizeof (nns_edge_queue_data_s));
   if (!qdata) {
     nns_edge_loge ("[Queue] Failed to allocate new memory for data.");
     ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
@@ -323,7 +323,7 @@ nns_edge_queue_clear (nns_edge_queue_h handle)
   }
 
   nns_edge_lock (q);
-  nns_edge_cond_signal (q);
+  nns_edge_cond_broadcast (q);
 
   while (q->length > 0U)
     _pop_data (q, true, NULL, NULL);
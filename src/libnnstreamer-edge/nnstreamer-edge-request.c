@@ -0,0 +1,1206 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2022 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nnstreamer-edge-request.c
+ * @date   16 October 2026
+ * @brief  Thread-safe table of outstanding requests, to match the responses of query client.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @bug    No known bugs except for NYI items.
+ */
+
+#include "nnstreamer-edge-data.h"
+#include "nnstreamer-edge-log.h"
+#include "nnstreamer-edge-request.h"
+#include "nnstreamer-edge-util.h"
+
+/**
+ * @brief The number of buckets in the table, power of 2.
+ */
+#define REQUEST_NUM_BUCKETS (256U)
+#define REQUEST_BUCKET(id) ((id) & (REQUEST_NUM_BUCKETS - 1U))
+
+/**
+ * @brief The number of recent latencies to get the percentile, and the min number to send the duplicated request.
+ */
+#define REQUEST_LATENCY_SAMPLES (64U)
+#define REQUEST_HEDGE_MIN_SAMPLES (8U)
+
+/**
+ * @brief The number of completed requests whose duplicate may be responded later.
+ */
+#define REQUEST_HEDGED_DONE (64U)
+
+/**
+ * @brief Internal structure for the outstanding request.
+ */
+typedef struct _nns_edge_request_entry_s nns_edge_request_entry_s;
+
+/**
+ * @brief Internal structure for the outstanding request.
+ */
+struct _nns_edge_request_entry_s
+{
+  uint32_t id;
+  int64_t sent_time; /**< monotonic time (microseconds) when the request is sent */
+  bool waiting; /**< true if the caller is waiting for the response */
+  bool expired; /**< true if the request is expired before the response is received */
+  nns_edge_data_h response; /**< the response received for the waiting caller */
+  int64_t target; /**< the target (client ID of the connection) which the request is sent to, 0 if not set */
+  nns_edge_data_h data; /**< the request kept to send the duplicate, NULL if the duplicate is not allowed or already sent */
+  bool hedged; /**< true if the request is popped to send the duplicate */
+  int64_t hedge_target; /**< the target which the duplicate is sent to, 0 if not set */
+  int64_t hedge_time; /**< monotonic time (microseconds) when the duplicate is sent */
+  nns_edge_request_entry_s *next;
+};
+
+/**
+ * @brief Internal structure for the statistics of the target.
+ */
+typedef struct _nns_edge_request_target_s nns_edge_request_target_s;
+
+/**
+ * @brief Internal structure for the statistics of the target.
+ */
+struct _nns_edge_request_target_s
+{
+  int64_t id;
+  unsigned int outstanding; /**< the number of requests sent to the target and waiting for the response */
+  int64_t latency; /**< EWMA of the latency (microseconds), 0 if no response is received */
+  unsigned int failures; /**< the number of consecutive failures */
+  int64_t ejected_until; /**< monotonic time (microseconds), the target is not selected until this time */
+  nns_edge_request_target_s *next;
+};
+
+/**
+ * @brief The result of the request sent to the target.
+ */
+typedef enum {
+  REQUEST_RESULT_DONE = 0, /**< the response is received */
+  REQUEST_RESULT_FAILED, /**< failed to send the request or timed out */
+  REQUEST_RESULT_CANCELED, /**< the request is released without the response */
+} nns_edge_request_result_e;
+
+/**
+ * @brief Internal structure for the table of outstanding requests.
+ */
+typedef struct
+{
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  uint32_t last_id;
+  unsigned int count;
+  nns_edge_request_entry_s *buckets[REQUEST_NUM_BUCKETS];
+
+  /* statistics of the targets to select the target of next request */
+  nns_edge_request_target_s *targets;
+  unsigned int eject_failures;
+  int64_t eject_time; /**< microseconds */
+  unsigned int next_index;
+
+  /* recent latencies to send the duplicated request (hedged request) */
+  unsigned int hedge_percentile; /**< 0 if the hedged request is disabled */
+  int64_t latencies[REQUEST_LATENCY_SAMPLES];
+  unsigned int num_latencies;
+  unsigned int latency_index;
+  int64_t hedge_delay; /**< microseconds, the percentile of recent latencies */
+  bool hedge_updated; /**< true if the latency is added after the delay is calculated */
+  uint32_t hedged_done[REQUEST_HEDGED_DONE];
+  unsigned int hedged_index;
+} nns_edge_request_s;
+
+/**
+ * @brief The names of the policies, see nns_edge_request_policy_e.
+ */
+static const char *request_policy_names[NNS_EDGE_REQUEST_POLICY_MAX] = {
+  "none", "least-outstanding", "ewma"
+};
+
+/**
+ * @brief Find the request and its previous entry in the bucket.
+ * @note This function should be called with lock.
+ */
+static nns_edge_request_entry_s *
+_find_entry (nns_edge_request_s * req, uint32_t id,
+    nns_edge_request_entry_s ** prev)
+{
+  nns_edge_request_entry_s *cur;
+
+  *prev = NULL;
+  for (cur = req->buckets[REQUEST_BUCKET (id)]; cur; cur = cur->next) {
+    if (cur->id == id)
+      return cur;
+    *prev = cur;
+  }
+
+  return NULL;
+}
+
+/**
+ * @brief Find the statistics of the target, and add new one if create is true.
+ * @note This function should be called with lock.
+ */
+static nns_edge_request_target_s *
+_find_target (nns_edge_request_s * req, int64_t id, bool create)
+{
+  nns_edge_request_target_s *t;
+
+  for (t = req->targets; t; t = t->next) {
+    if (t->id == id)
+      return t;
+  }
+
+  if (create) {
+    t = nns_edge_calloc (1, sizeof (nns_edge_request_target_s));
+    if (!t) {
+      nns_edge_loge ("[Request] Failed to allocate new memory.");
+      return NULL;
+    }
+
+    t->id = id;
+    t->next = req->targets;
+    req->targets = t;
+  }
+
+  return t;
+}
+
+/**
+ * @brief Update the statistics of the target with the result of the request, and detach the request from the target.
+ * @note This function should be called with lock.
+ */
+static void
+_finish_target (nns_edge_request_s * req, int64_t * target, int64_t sent_time,
+    nns_edge_request_result_e result)
+{
+  nns_edge_request_target_s *t;
+  int64_t now, latency;
+
+  if (*target == 0)
+    return;
+
+  t = _find_target (req, *target, false);
+  *target = 0;
+  if (!t)
+    return;
+
+  if (t->outstanding > 0U)
+    t->outstanding--;
+
+  now = nns_edge_get_monotonic_time ();
+
+  if (result == REQUEST_RESULT_DONE) {
+    latency = now - sent_time;
+    if (latency <= 0)
+      latency = 1;
+
+    /* EWMA, the weight of new latency is 1/4. */
+    t->latency = (t->latency == 0) ? latency : (latency + 3 * t->latency) / 4;
+    t->failures = 0U;
+    t->ejected_until = 0;
+
+    req->latencies[req->latency_index] = latency;
+    req->latency_index = (req->latency_index + 1U) % REQUEST_LATENCY_SAMPLES;
+    if (req->num_latencies < REQUEST_LATENCY_SAMPLES)
+      req->num_latencies++;
+    req->hedge_updated = true;
+  } else if (result == REQUEST_RESULT_FAILED) {
+    if (++t->failures >= req->eject_failures) {
+      nns_edge_logw ("[Request] Eject the target %lld, %u consecutive failures.",
+          (long long) t->id, t->failures);
+      t->failures = 0U;
+      t->ejected_until = now + req->eject_time;
+    }
+  }
+}
+
+/**
+ * @brief Update the statistics of the targets which the request and its duplicate are sent to.
+ * @note This function should be called with lock.
+ */
+static void
+_finish_entry (nns_edge_request_s * req, nns_edge_request_entry_s * entry,
+    nns_edge_request_result_e result)
+{
+  _finish_target (req, &entry->target, entry->sent_time, result);
+  _finish_target (req, &entry->hedge_target, entry->hedge_time, result);
+}
+
+/**
+ * @brief Compare the latencies to sort them.
+ */
+static int
+_compare_latency (const void *a, const void *b)
+{
+  int64_t la = *(const int64_t *) a;
+  int64_t lb = *(const int64_t *) b;
+
+  return (la > lb) - (la < lb);
+}
+
+/**
+ * @brief Get the delay to send the duplicated request, 0 if the duplicate is not allowed yet.
+ * @note This function should be called with lock.
+ */
+static int64_t
+_get_hedge_delay (nns_edge_request_s * req)
+{
+  int64_t sorted[REQUEST_LATENCY_SAMPLES];
+  unsigned int n = req->num_latencies;
+
+  if (req->hedge_percentile == 0U || n < REQUEST_HEDGE_MIN_SAMPLES)
+    return 0;
+
+  if (req->hedge_updated) {
+    /* Nearest-rank percentile of recent latencies. */
+    memcpy (sorted, req->latencies, sizeof (int64_t) * n);
+    qsort (sorted, n, sizeof (int64_t), _compare_latency);
+    req->hedge_delay = sorted[(n * req->hedge_percentile + 99U) / 100U - 1U];
+    req->hedge_updated = false;
+  }
+
+  return req->hedge_delay;
+}
+
+/**
+ * @brief Remember the request completed after its duplicate is sent, to drop the response received later.
+ * @note This function should be called with lock.
+ */
+static void
+_push_hedged_done (nns_edge_request_s * req, uint32_t id)
+{
+  req->hedged_done[req->hedged_index] = id;
+  req->hedged_index = (req->hedged_index + 1U) % REQUEST_HEDGED_DONE;
+}
+
+/**
+ * @brief Check the request is completed after its duplicate is sent. The ID is forgotten after this.
+ * @note This function should be called with lock.
+ */
+static bool
+_pop_hedged_done (nns_edge_request_s * req, uint32_t id)
+{
+  unsigned int i;
+
+  for (i = 0; i < REQUEST_HEDGED_DONE; i++) {
+    if (req->hedged_done[i] == id) {
+      req->hedged_done[i] = 0U;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Remove the entry from the table and release it.
+ * @note This function should be called with lock.
+ */
+static void
+_remove_entry (nns_edge_request_s * req, nns_edge_request_entry_s * entry,
+    nns_edge_request_entry_s * prev)
+{
+  _finish_entry (req, entry, REQUEST_RESULT_CANCELED);
+
+  if (prev)
+    prev->next = entry->next;
+  else
+    req->buckets[REQUEST_BUCKET (entry->id)] = entry->next;
+
+  req->count--;
+
+  if (entry->response)
+    nns_edge_data_destroy (entry->response);
+  if (entry->data)
+    nns_edge_data_destroy (entry->data);
+  SAFE_EDGE_FREE (entry);
+}
+
+/**
+ * @brief Find the oldest request which is not waited by the caller. If target is not 0, find the request sent to the target or not sent yet.
+ * @note This function should be called with lock.
+ */
+static nns_edge_request_entry_s *
+_find_oldest (nns_edge_request_s * req, int64_t target,
+    nns_edge_request_entry_s ** prev)
+{
+  nns_edge_request_entry_s *cur, *p, *oldest = NULL;
+  unsigned int b;
+
+  *prev = NULL;
+  for (b = 0; b < REQUEST_NUM_BUCKETS; b++) {
+    for (p = NULL, cur = req->buckets[b]; cur; p = cur, cur = cur->next) {
+      if (cur->waiting)
+        continue;
+
+      if (target != 0 && cur->target != 0 && cur->target != target &&
+          cur->hedge_target != target)
+        continue;
+
+      if (!oldest || cur->sent_time < oldest->sent_time) {
+        oldest = cur;
+        *prev = p;
+      }
+    }
+  }
+
+  return oldest;
+}
+
+/**
+ * @brief Add new entry of the request.
+ */
+static int
+_add_entry (nns_edge_request_s * req, uint32_t id, bool waiting)
+{
+  nns_edge_request_entry_s *entry, *cur, *prev;
+  uint32_t b = REQUEST_BUCKET (id);
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!req || id == 0U) {
+    nns_edge_loge ("[Request] Invalid param, request table is null or ID is 0.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  entry = nns_edge_calloc (1, sizeof (nns_edge_request_entry_s));
+  if (!entry) {
+    nns_edge_loge ("[Request] Failed to allocate new memory.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  entry->id = id;
+  entry->sent_time = nns_edge_get_monotonic_time ();
+  entry->waiting = waiting;
+
+  nns_edge_lock (req);
+
+  cur = _find_entry (req, id, &prev);
+  if (cur) {
+    /* The caller waiting for the response adds the request before it is sent. */
+    if (!cur->waiting || waiting) {
+      nns_edge_loge ("[Request] Invalid param, the request %u is already outstanding.",
+          id);
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    } else {
+      cur->sent_time = entry->sent_time;
+    }
+
+    SAFE_EDGE_FREE (entry);
+  } else if (req->count >= NNS_EDGE_REQUEST_MAX &&
+      !(cur = _find_oldest (req, 0, &prev))) {
+    nns_edge_loge ("[Request] Too many requests are waiting for the response.");
+    ret = NNS_EDGE_ERROR_IO;
+    SAFE_EDGE_FREE (entry);
+  } else {
+    /* The response of the oldest request may not be received, remove it. */
+    if (cur) {
+      nns_edge_logw ("[Request] The table is full, remove the oldest request %u.",
+          cur->id);
+      _remove_entry (req, cur, prev);
+    }
+
+    entry->next = req->buckets[b];
+    req->buckets[b] = entry;
+    req->count++;
+  }
+
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Create the table of outstanding requests.
+ */
+int
+nns_edge_request_create (nns_edge_request_h * handle)
+{
+  nns_edge_request_s *req;
+
+  if (!handle) {
+    nns_edge_loge ("[Request] Invalid param, handle is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  req = nns_edge_calloc (1, sizeof (nns_edge_request_s));
+  if (!req) {
+    nns_edge_loge ("[Request] Failed to allocate new memory.");
+    return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+  }
+
+  nns_edge_lock_init (req);
+  nns_edge_cond_init (req);
+  req->eject_failures = NNS_EDGE_REQUEST_EJECT_FAILURES;
+  req->eject_time = NNS_EDGE_REQUEST_EJECT_TIME * 1000LL;
+
+  *handle = req;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Destroy the table and release all outstanding requests.
+ */
+int
+nns_edge_request_destroy (nns_edge_request_h handle)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+
+  if (!req) {
+    nns_edge_loge ("[Request] Invalid param, request table is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_request_clear (req);
+
+  nns_edge_cond_destroy (req);
+  nns_edge_lock_destroy (req);
+  SAFE_EDGE_FREE (req);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Generate new request ID.
+ */
+uint32_t
+nns_edge_request_new_id (nns_edge_request_h handle)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  uint32_t id;
+
+  if (!req)
+    return 0U;
+
+  nns_edge_lock (req);
+  if (++req->last_id == 0U)
+    req->last_id = 1U;
+  id = req->last_id;
+  nns_edge_unlock (req);
+
+  return id;
+}
+
+/**
+ * @brief Add the request which is waiting for the response.
+ */
+int
+nns_edge_request_add (nns_edge_request_h handle, uint32_t id)
+{
+  return _add_entry ((nns_edge_request_s *) handle, id, false);
+}
+
+/**
+ * @brief Add the request, the caller waits for the response with nns_edge_request_wait().
+ */
+int
+nns_edge_request_add_waiting (nns_edge_request_h handle, uint32_t id)
+{
+  return _add_entry ((nns_edge_request_s *) handle, id, true);
+}
+
+/**
+ * @brief Remove the request.
+ */
+int
+nns_edge_request_remove (nns_edge_request_h handle, uint32_t id)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+
+  if (!req) {
+    nns_edge_loge ("[Request] Invalid param, request table is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+
+  entry = _find_entry (req, id, &prev);
+  if (entry) {
+    _finish_entry (req, entry, REQUEST_RESULT_FAILED);
+    _remove_entry (req, entry, prev);
+
+    /* Wake up the caller waiting for the response. */
+    nns_edge_cond_broadcast (req);
+  }
+
+  nns_edge_unlock (req);
+
+  return entry ? NNS_EDGE_ERROR_NONE : NNS_EDGE_ERROR_INVALID_PARAMETER;
+}
+
+/**
+ * @brief Complete the request with its response.
+ */
+int
+nns_edge_request_done (nns_edge_request_h handle, uint32_t id, int64_t target,
+    nns_edge_data_h data_h, bool *taken)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!req || !taken) {
+    nns_edge_loge ("[Request] Invalid param, request table or taken is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  *taken = false;
+
+  nns_edge_lock (req);
+
+  entry = _find_entry (req, id, &prev);
+  if (!entry) {
+    /* The response of the duplicate, the request is already completed. */
+    if (_pop_hedged_done (req, id))
+      *taken = true;
+    else
+      ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (entry->response) {
+    /* The caller waiting for the response already has the first one. */
+    *taken = true;
+    goto done;
+  }
+
+  /* The first response completes the request, and the other one is cancelled. */
+  if (entry->hedge_target != 0 && entry->hedge_target == target)
+    _finish_target (req, &entry->hedge_target, entry->hedge_time,
+        REQUEST_RESULT_DONE);
+  else
+    _finish_target (req, &entry->target, entry->sent_time, REQUEST_RESULT_DONE);
+  _finish_entry (req, entry, REQUEST_RESULT_CANCELED);
+
+  if (entry->hedged)
+    _push_hedged_done (req, id);
+
+  if (entry->data) {
+    nns_edge_data_destroy (entry->data);
+    entry->data = NULL;
+  }
+
+  if (!entry->waiting) {
+    _remove_entry (req, entry, prev);
+  } else if (!entry->response) {
+    /* The waiting caller takes the response, the data is released after this function. */
+    ret = nns_edge_data_copy_transfer (data_h, &entry->response);
+    *taken = (ret == NNS_EDGE_ERROR_NONE);
+
+    if (!*taken)
+      _remove_entry (req, entry, prev);
+    nns_edge_cond_broadcast (req);
+  }
+
+done:
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Complete the oldest request sent to the target when the response without request ID is received.
+ */
+int
+nns_edge_request_done_oldest (nns_edge_request_h handle, int64_t target)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!req || target == 0) {
+    nns_edge_loge ("[Request] Invalid param, request table is null or target is 0.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+
+  /* The server responds the requests in order. */
+  entry = _find_oldest (req, target, &prev);
+  if (!entry) {
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  if (entry->hedge_target == target)
+    _finish_target (req, &entry->hedge_target, entry->hedge_time,
+        REQUEST_RESULT_DONE);
+  else
+    _finish_target (req, &entry->target, entry->sent_time, REQUEST_RESULT_DONE);
+
+  _remove_entry (req, entry, prev);
+
+done:
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Complete the request which is expired before the response is received.
+ */
+int
+nns_edge_request_expire (nns_edge_request_h handle, uint32_t id,
+    bool *waiting)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!req || !waiting) {
+    nns_edge_loge ("[Request] Invalid param, request table or waiting is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  *waiting = false;
+
+  nns_edge_lock (req);
+
+  entry = _find_entry (req, id, &prev);
+  if (!entry || entry->response || entry->expired) {
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  /* The response of the duplicate is dropped. */
+  if (entry->hedged)
+    _push_hedged_done (req, id);
+
+  if (entry->waiting) {
+    /* The waiting caller removes the request. */
+    entry->expired = true;
+    *waiting = true;
+    nns_edge_cond_broadcast (req);
+  } else {
+    _remove_entry (req, entry, prev);
+  }
+
+done:
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Wait for the response of the request added with nns_edge_request_add_waiting().
+ */
+int
+nns_edge_request_wait (nns_edge_request_h handle, uint32_t id,
+    unsigned int timeout_ms, nns_edge_data_h * response_h)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+  int64_t end_time, remaining;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!req || !response_h) {
+    nns_edge_loge ("[Request] Invalid param, request table or response is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  *response_h = NULL;
+  end_time = nns_edge_get_monotonic_time () + (int64_t) timeout_ms * 1000;
+
+  nns_edge_lock (req);
+
+  while (true) {
+    entry = _find_entry (req, id, &prev);
+    if (!entry || !entry->waiting) {
+      /* Failed to send the request, or the connection is closed. */
+      nns_edge_loge ("[Request] The request %u is not outstanding.", id);
+      ret = NNS_EDGE_ERROR_IO;
+      break;
+    }
+
+    if (entry->response) {
+      *response_h = entry->response;
+      entry->response = NULL;
+      _remove_entry (req, entry, prev);
+      break;
+    }
+
+    if (entry->expired) {
+      nns_edge_loge ("[Request] The request %u is expired.", id);
+      _remove_entry (req, entry, prev);
+      ret = NNS_EDGE_ERROR_TIMEOUT;
+      break;
+    }
+
+    if (timeout_ms == 0U) {
+      nns_edge_cond_wait (req);
+      continue;
+    }
+
+    remaining = end_time - nns_edge_get_monotonic_time ();
+    if (remaining <= 0) {
+      nns_edge_loge ("[Request] Timed out, the response of request %u is not received.",
+          id);
+      _finish_entry (req, entry, REQUEST_RESULT_FAILED);
+      _remove_entry (req, entry, prev);
+      ret = NNS_EDGE_ERROR_TIMEOUT;
+      break;
+    }
+
+    /* Round up the remaining time, 0 means to wait without timeout. */
+    nns_edge_cond_wait_until (req, (remaining + 999) / 1000);
+  }
+
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Remove all outstanding requests.
+ */
+int
+nns_edge_request_clear (nns_edge_request_h handle)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *cur, *next;
+  nns_edge_request_target_s *t;
+  unsigned int b;
+
+  if (!req) {
+    nns_edge_loge ("[Request] Invalid param, request table is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+
+  for (b = 0; b < REQUEST_NUM_BUCKETS; b++) {
+    cur = req->buckets[b];
+    req->buckets[b] = NULL;
+
+    while (cur) {
+      next = cur->next;
+      if (cur->response)
+        nns_edge_data_destroy (cur->response);
+      if (cur->data)
+        nns_edge_data_destroy (cur->data);
+      SAFE_EDGE_FREE (cur);
+      cur = next;
+    }
+  }
+
+  req->count = 0U;
+  memset (req->hedged_done, 0, sizeof (req->hedged_done));
+
+  while (req->targets) {
+    t = req->targets;
+    req->targets = t->next;
+    SAFE_EDGE_FREE (t);
+  }
+
+  /* Wake up the callers waiting for the response. */
+  nns_edge_cond_broadcast (req);
+  nns_edge_unlock (req);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Get the number of outstanding requests.
+ */
+unsigned int
+nns_edge_request_get_count (nns_edge_request_h handle)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  unsigned int count;
+
+  if (!req)
+    return 0U;
+
+  nns_edge_lock (req);
+  count = req->count;
+  nns_edge_unlock (req);
+
+  return count;
+}
+
+/**
+ * @brief Set the condition to eject the target.
+ */
+int
+nns_edge_request_set_ejection (nns_edge_request_h handle,
+    unsigned int failures, unsigned int eject_time)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+
+  if (!req || failures == 0U) {
+    nns_edge_loge ("[Request] Invalid param, request table is null or failures is 0.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+  req->eject_failures = failures;
+  req->eject_time = eject_time * 1000LL;
+  nns_edge_unlock (req);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Set the target which the request is sent to.
+ */
+int
+nns_edge_request_set_target (nns_edge_request_h handle, uint32_t id,
+    int64_t target)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+  nns_edge_request_target_s *t;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!req) {
+    nns_edge_loge ("[Request] Invalid param, request table is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+
+  entry = _find_entry (req, id, &prev);
+  if (!entry) {
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  /* The request is moved from previous target, failed to send it. */
+  _finish_target (req, &entry->target, entry->sent_time, REQUEST_RESULT_FAILED);
+
+  if (target != 0) {
+    t = _find_target (req, target, true);
+    if (!t) {
+      ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+      goto done;
+    }
+
+    t->outstanding++;
+    entry->target = target;
+    entry->sent_time = nns_edge_get_monotonic_time ();
+  }
+
+done:
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Select the target of next request with the policy.
+ */
+int64_t
+nns_edge_request_select (nns_edge_request_h handle, const int64_t * targets,
+    unsigned int num, nns_edge_request_policy_e policy)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_target_s *t;
+  int64_t now, latency, avg_latency = 0, cost, best_cost = 0;
+  unsigned int i, n, pass, sampled = 0U;
+  int best = -1;
+
+  if (!req || !targets || num == 0U)
+    return 0;
+
+  nns_edge_lock (req);
+
+  /* The target without the response is regarded as the average latency. */
+  for (i = 0; i < num; i++) {
+    t = _find_target (req, targets[i], false);
+    if (t && t->latency > 0) {
+      avg_latency += t->latency;
+      sampled++;
+    }
+  }
+
+  if (sampled > 0U)
+    avg_latency /= sampled;
+
+  now = nns_edge_get_monotonic_time ();
+
+  /**
+   * Start from the next index in every selection, the targets having same cost are selected in turn.
+   * If all targets are ejected, select one of the ejected targets.
+   */
+  for (pass = 0; pass < 2U && best < 0; pass++) {
+    for (n = 0; n < num; n++) {
+      i = (req->next_index + n) % num;
+      t = _find_target (req, targets[i], false);
+
+      if (pass == 0U && t && t->ejected_until > now)
+        continue;
+
+      latency = (t && t->latency > 0) ? t->latency : avg_latency;
+      cost = t ? t->outstanding : 0;
+      if (policy == NNS_EDGE_REQUEST_POLICY_EWMA)
+        cost = (latency + 1) * (cost + 1);
+
+      if (best < 0 || cost < best_cost) {
+        best = (int) i;
+        best_cost = cost;
+      }
+    }
+  }
+
+  req->next_index++;
+
+  nns_edge_unlock (req);
+
+  return targets[best];
+}
+
+/**
+ * @brief Remove the requests sent to the target and its statistics. (e.g., the connection is closed)
+ */
+int
+nns_edge_request_clear_target (nns_edge_request_h handle, int64_t target)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *cur, *prev, *next;
+  nns_edge_request_target_s *t, *tprev = NULL;
+  unsigned int b;
+
+  if (!req || target == 0) {
+    nns_edge_loge ("[Request] Invalid param, request table is null or target is 0.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+
+  for (b = 0; b < REQUEST_NUM_BUCKETS; b++) {
+    prev = NULL;
+
+    for (cur = req->buckets[b]; cur; cur = next) {
+      next = cur->next;
+
+      if (cur->hedge_target == target) {
+        /* Wait for the response from the target of the request. */
+        _finish_target (req, &cur->hedge_target, cur->hedge_time,
+            REQUEST_RESULT_CANCELED);
+        prev = cur;
+      } else if (cur->target == target && cur->hedge_target != 0) {
+        /* Wait for the response of the duplicate. */
+        _finish_target (req, &cur->target, cur->sent_time,
+            REQUEST_RESULT_CANCELED);
+        cur->target = cur->hedge_target;
+        cur->sent_time = cur->hedge_time;
+        cur->hedge_target = 0;
+        prev = cur;
+      } else if (cur->target == target) {
+        _remove_entry (req, cur, prev);
+      } else {
+        prev = cur;
+      }
+    }
+  }
+
+  for (t = req->targets; t; tprev = t, t = t->next) {
+    if (t->id == target) {
+      if (tprev)
+        tprev->next = t->next;
+      else
+        req->targets = t->next;
+
+      SAFE_EDGE_FREE (t);
+      break;
+    }
+  }
+
+  /* Wake up the callers waiting for the response. */
+  nns_edge_cond_broadcast (req);
+  nns_edge_unlock (req);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Set the percentile of latency to send the duplicated request to other target.
+ */
+int
+nns_edge_request_set_hedge (nns_edge_request_h handle, unsigned int percentile)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+
+  if (!req || percentile >= 100U) {
+    nns_edge_loge ("[Request] Invalid param, request table is null or percentile is not less than 100.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+  req->hedge_percentile = percentile;
+  req->hedge_updated = true;
+  nns_edge_unlock (req);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Keep the request sent to the target, to send the duplicate later.
+ */
+int
+nns_edge_request_set_data (nns_edge_request_h handle, uint32_t id,
+    nns_edge_data_h data_h)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+  int ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  if (!req || !data_h) {
+    nns_edge_loge ("[Request] Invalid param, request table or data is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+
+  /* The response may be received before the transfer is done. */
+  entry = _find_entry (req, id, &prev);
+  if (entry && req->hedge_percentile > 0U && entry->target != 0 &&
+      !entry->hedged && !entry->data && !entry->response) {
+    entry->data = data_h;
+    ret = NNS_EDGE_ERROR_NONE;
+  }
+
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Pop the oldest request which is not responded within the percentile of latency.
+ */
+int
+nns_edge_request_pop_hedge (nns_edge_request_h handle, uint32_t * id,
+    int64_t * target, nns_edge_data_h * data_h, unsigned int *wait_ms)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *cur, *oldest = NULL;
+  int64_t delay, now, next;
+  unsigned int b;
+
+  if (!req || !id || !target || !data_h || !wait_ms) {
+    nns_edge_loge ("[Request] Invalid param, request table or output is null.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  *data_h = NULL;
+  *wait_ms = 0U;
+
+  nns_edge_lock (req);
+
+  for (b = 0; b < REQUEST_NUM_BUCKETS; b++) {
+    for (cur = req->buckets[b]; cur; cur = cur->next) {
+      if (!cur->data || cur->target == 0 || cur->expired)
+        continue;
+
+      if (!oldest || cur->sent_time < oldest->sent_time)
+        oldest = cur;
+    }
+  }
+
+  /* Nothing to be duplicated, wait until new request is sent. */
+  if (!oldest)
+    goto done;
+
+  delay = _get_hedge_delay (req);
+  if (delay <= 0) {
+    /* Not enough latencies, check it again later. */
+    *wait_ms = 10U;
+    goto done;
+  }
+
+  now = nns_edge_get_monotonic_time ();
+
+  if (oldest->sent_time + delay <= now) {
+    oldest->hedged = true;
+    *id = oldest->id;
+    *target = oldest->target;
+    *data_h = oldest->data;
+    oldest->data = NULL;
+    next = now;
+  } else {
+    next = oldest->sent_time + delay;
+  }
+
+  /* Round up the remaining time. */
+  *wait_ms = (unsigned int) ((next - now + 999) / 1000);
+
+done:
+  nns_edge_unlock (req);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Set the target which the duplicated request is sent to.
+ */
+int
+nns_edge_request_set_hedge_target (nns_edge_request_h handle, uint32_t id,
+    int64_t target)
+{
+  nns_edge_request_s *req = (nns_edge_request_s *) handle;
+  nns_edge_request_entry_s *entry, *prev;
+  nns_edge_request_target_s *t;
+  int ret = NNS_EDGE_ERROR_NONE;
+
+  if (!req || target == 0) {
+    nns_edge_loge ("[Request] Invalid param, request table is null or target is 0.");
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+  }
+
+  nns_edge_lock (req);
+
+  /* The response may be received before the duplicate is sent. */
+  entry = _find_entry (req, id, &prev);
+  if (!entry || !entry->hedged || entry->hedge_target != 0 ||
+      entry->target == target || entry->response) {
+    ret = NNS_EDGE_ERROR_INVALID_PARAMETER;
+    goto done;
+  }
+
+  t = _find_target (req, target, true);
+  if (!t) {
+    ret = NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    goto done;
+  }
+
+  t->outstanding++;
+  entry->hedge_target = target;
+  entry->hedge_time = nns_edge_get_monotonic_time ();
+
+done:
+  nns_edge_unlock (req);
+
+  return ret;
+}
+
+/**
+ * @brief Get the name of the policy.
+ */
+const char *
+nns_edge_request_get_policy_name (nns_edge_request_policy_e policy)
+{
+  if (policy < NNS_EDGE_REQUEST_POLICY_NONE ||
+      policy >= NNS_EDGE_REQUEST_POLICY_MAX)
+    return NULL;
+
+  return request_policy_names[policy];
+}
+
+/**
+ * @brief Get the policy from its name.
+ */
+nns_edge_request_policy_e
+nns_edge_request_get_policy (const char *name)
+{
+  int i;
+
+  if (!STR_IS_VALID (name))
+    return NNS_EDGE_REQUEST_POLICY_MAX;
+
+  for (i = 0; i < NNS_EDGE_REQUEST_POLICY_MAX; i++) {
+    if (0 == strcasecmp (name, request_policy_names[i]))
+      return (nns_edge_request_policy_e) i;
+  }
+
+  return NNS_EDGE_REQUEST_POLICY_MAX;
+}
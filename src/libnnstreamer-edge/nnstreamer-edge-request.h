@@ -0,0 +1,279 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (C) 2022 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file   nnstreamer-edge-request.h
+ * @date   16 October 2026
+ * @brief  Thread-safe table of outstanding requests, to match the responses of query client.
+ * @see    https://github.com/nnstreamer/nnstreamer-edge
+ * @note   This file is internal header for nnstreamer-edge. DO NOT export this file.
+ * @bug    No known bugs except for NYI items.
+ */
+
+#ifndef __NNSTREAMER_EDGE_REQUEST_H__
+#define __NNSTREAMER_EDGE_REQUEST_H__
+
+#include <stdbool.h>
+#include "nnstreamer-edge.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef void *nns_edge_request_h;
+
+/**
+ * @brief Policies to select the target (connected server) of the request.
+ */
+typedef enum {
+  NNS_EDGE_REQUEST_POLICY_NONE = 0, /**< the target is not selected, the request is sent to all connected servers */
+  NNS_EDGE_REQUEST_POLICY_LEAST_OUTSTANDING, /**< the target having the fewest outstanding requests */
+  NNS_EDGE_REQUEST_POLICY_EWMA, /**< the target having the lowest EWMA latency, weighted by the outstanding requests */
+
+  NNS_EDGE_REQUEST_POLICY_MAX
+} nns_edge_request_policy_e;
+
+/**
+ * @brief The default number of consecutive failures to eject the target.
+ */
+#define NNS_EDGE_REQUEST_EJECT_FAILURES (3U)
+
+/**
+ * @brief The default time (milliseconds) the ejected target is not selected.
+ */
+#define NNS_EDGE_REQUEST_EJECT_TIME (10000U)
+
+/**
+ * @brief The max number of outstanding requests. The oldest request which is not waited is removed if the table is full.
+ */
+#define NNS_EDGE_REQUEST_MAX (4096U)
+
+/**
+ * @brief Create the table of outstanding requests.
+ * @param[out] handle Newly created handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_create (nns_edge_request_h *handle);
+
+/**
+ * @brief Destroy the table and release all outstanding requests.
+ * @param[in] handle The request table handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_destroy (nns_edge_request_h handle);
+
+/**
+ * @brief Generate new request ID. The ID is not 0, and it wraps around after 2^32 - 1 requests.
+ * @param[in] handle The request table handle.
+ * @return The request ID. 0 if the handle is invalid.
+ */
+uint32_t nns_edge_request_new_id (nns_edge_request_h handle);
+
+/**
+ * @brief Add the request which is waiting for the response.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the request is already outstanding.
+ * @retval #NNS_EDGE_ERROR_IO The table is full with the requests waited by the callers.
+ */
+int nns_edge_request_add (nns_edge_request_h handle, uint32_t id);
+
+/**
+ * @brief Add the request before it is sent, the caller waits for the response with nns_edge_request_wait().
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the request is already outstanding.
+ * @retval #NNS_EDGE_ERROR_IO The table is full with the requests waited by the callers.
+ * @note nns_edge_request_add() with same ID succeeds while the caller is waiting for the response.
+ */
+int nns_edge_request_add_waiting (nns_edge_request_h handle, uint32_t id);
+
+/**
+ * @brief Remove the request. (e.g., failed to send the request) The caller waiting for the response gets an error.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the request is not outstanding.
+ */
+int nns_edge_request_remove (nns_edge_request_h handle, uint32_t id);
+
+/**
+ * @brief Complete the request when its response is received.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @param[in] target The target which sent the response, 0 if unknown.
+ * @param[in] data_h The edge data handle of the response.
+ * @param[out] taken true if the response is consumed, the caller waiting for the response takes the copy of data or the response of the duplicated request is dropped.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to copy the response.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the request is not outstanding.
+ */
+int nns_edge_request_done (nns_edge_request_h handle, uint32_t id, int64_t target, nns_edge_data_h data_h, bool *taken);
+
+/**
+ * @brief Complete the oldest request sent to the target when the response without request ID is received. (e.g., the server does not keep the request ID in the response) The request waited by the caller is not completed.
+ * @param[in] handle The request table handle.
+ * @param[in] target The target which sent the response.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or there is no request to be completed.
+ */
+int nns_edge_request_done_oldest (nns_edge_request_h handle, int64_t target);
+
+/**
+ * @brief Complete the request which is expired before the response is received. The caller waiting for the response gets timeout error.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @param[out] waiting true if the caller is waiting for the response.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the request is not outstanding.
+ */
+int nns_edge_request_expire (nns_edge_request_h handle, uint32_t id, bool *waiting);
+
+/**
+ * @brief Wait for the response of the request added with nns_edge_request_add_waiting(). The request is removed when this function returns.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @param[in] timeout_ms The timeout in milliseconds, 0 to wait until the response is received.
+ * @param[out] response_h The edge data handle of the response. Caller should release it using nns_edge_data_destroy().
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_TIMEOUT The response is not received until the timeout, or the request is expired.
+ * @retval #NNS_EDGE_ERROR_IO The request is removed, failed to send the request or the connection is closed.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_wait (nns_edge_request_h handle, uint32_t id, unsigned int timeout_ms, nns_edge_data_h *response_h);
+
+/**
+ * @brief Remove all outstanding requests. (e.g., the connection is closed)
+ * @param[in] handle The request table handle.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_clear (nns_edge_request_h handle);
+
+/**
+ * @brief Get the number of outstanding requests.
+ * @param[in] handle The request table handle.
+ * @return The number of requests waiting for the response.
+ */
+unsigned int nns_edge_request_get_count (nns_edge_request_h handle);
+
+/**
+ * @brief Set the condition to eject the target. The target is not selected for a while after consecutive failures. (e.g., send failure or timeout)
+ * @param[in] handle The request table handle.
+ * @param[in] failures The number of consecutive failures to eject the target.
+ * @param[in] eject_time The time in milliseconds the ejected target is not selected.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_set_ejection (nns_edge_request_h handle, unsigned int failures, unsigned int eject_time);
+
+/**
+ * @brief Set the target which the request is sent to. If the request is moved from previous target, it is counted as a failure of previous target.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @param[in] target The client ID of the connection, 0 to detach the request from the target.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the request is not outstanding.
+ */
+int nns_edge_request_set_target (nns_edge_request_h handle, uint32_t id, int64_t target);
+
+/**
+ * @brief Select the target of next request with the policy. The ejected target is not selected unless all targets are ejected.
+ * @param[in] handle The request table handle.
+ * @param[in] targets The client IDs of the connections.
+ * @param[in] num The number of targets.
+ * @param[in] policy The policy to select the target.
+ * @return The selected target. 0 if the parameter is invalid.
+ */
+int64_t nns_edge_request_select (nns_edge_request_h handle, const int64_t *targets, unsigned int num, nns_edge_request_policy_e policy);
+
+/**
+ * @brief Remove the requests sent to the target and its statistics. (e.g., the connection is closed) The request whose duplicate is sent to other target waits for the response of the duplicate.
+ * @param[in] handle The request table handle.
+ * @param[in] target The client ID of the connection.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_clear_target (nns_edge_request_h handle, int64_t target);
+
+/**
+ * @brief Set the percentile of latency to send the duplicated request (hedged request) to other target, 0 to disable it.
+ * @param[in] handle The request table handle.
+ * @param[in] percentile The percentile (1 to 99) of recent latencies. The duplicate is sent if the response is not received within this latency.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_set_hedge (nns_edge_request_h handle, unsigned int percentile);
+
+/**
+ * @brief Keep the request sent to the target, to send the duplicate later. The table takes the ownership of the data on success.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @param[in] data_h The edge data handle of the request.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, the hedged request is disabled or the request is not outstanding.
+ */
+int nns_edge_request_set_data (nns_edge_request_h handle, uint32_t id, nns_edge_data_h data_h);
+
+/**
+ * @brief Pop the oldest request which is not responded within the percentile of latency.
+ * @param[in] handle The request table handle.
+ * @param[out] id The request ID.
+ * @param[out] target The target which the request is sent to. The duplicate should be sent to other target.
+ * @param[out] data_h The edge data handle of the request, NULL if there is no request to be duplicated. Caller should release it using nns_edge_data_destroy().
+ * @param[out] wait_ms The time in milliseconds until next request is to be duplicated. 0 if there is no request to be duplicated, the sender should wait until new request is set with nns_edge_request_set_data().
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid.
+ */
+int nns_edge_request_pop_hedge (nns_edge_request_h handle, uint32_t *id, int64_t *target, nns_edge_data_h *data_h, unsigned int *wait_ms);
+
+/**
+ * @brief Set the target which the duplicated request is sent to. The first response completes the request, and the other one is dropped.
+ * @param[in] handle The request table handle.
+ * @param[in] id The request ID.
+ * @param[in] target The client ID of the connection.
+ * @return 0 on success. Otherwise a negative error value.
+ * @retval #NNS_EDGE_ERROR_NONE Successful.
+ * @retval #NNS_EDGE_ERROR_OUT_OF_MEMORY Failed to allocate required memory.
+ * @retval #NNS_EDGE_ERROR_INVALID_PARAMETER Given parameter is invalid, or the request is not outstanding.
+ */
+int nns_edge_request_set_hedge_target (nns_edge_request_h handle, uint32_t id, int64_t target);
+
+/**
+ * @brief Get the name of the policy.
+ */
+const char *nns_edge_request_get_policy_name (nns_edge_request_policy_e policy);
+
+/**
+ * @brief Get the policy from its name. Returns NNS_EDGE_REQUEST_POLICY_MAX if the name is invalid.
+ */
+nns_edge_request_policy_e nns_edge_request_get_policy (const char *name);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __NNSTREAMER_EDGE_REQUEST_H__ */
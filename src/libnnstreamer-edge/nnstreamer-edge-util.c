@@ -18,18 +18,65 @@
 #include "nnstreamer-edge-util.h"
 
 /**
- * @brief Generate ID.
+ * @brief Internal structure for the default memory allocator of the process.
+ */
+typedef struct _nns_edge_default_allocator_s nns_edge_default_allocator_s;
+
+/**
+ * @brief Internal structure for the default memory allocator of the process.
+ */
+struct _nns_edge_default_allocator_s
+{
+  nns_edge_allocator_s allocator;
+  nns_edge_default_allocator_s *next; /**< the allocator set before */
+};
+
+/**
+ * @brief The default memory allocator, the standard library is used if it is null.
+ * The memory is released with the default allocator at the time of release, so it should be changed only when no edge handle and edge data exist.
+ * The allocators set before are not released, to keep the pointer loaded in other thread valid.
+ */
+static nns_edge_default_allocator_s *g_default_allocator = NULL;
+static nns_edge_default_allocator_s *g_allocator_list = NULL;
+static pthread_mutex_t g_allocator_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Get the monotonic time in microseconds.
  */
 int64_t
-nns_edge_generate_id (void)
+nns_edge_get_monotonic_time (void)
 {
   struct timespec ts;
-  int64_t _id;
 
   clock_gettime (CLOCK_MONOTONIC, &ts);
-  _id = ((int64_t) ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+  return ((int64_t) ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
 
-  return _id;
+/**
+ * @brief Generate ID.
+ */
+int64_t
+nns_edge_generate_id (void)
+{
+  return nns_edge_get_monotonic_time ();
+}
+
+/**
+ * @brief Get the hash value of string (FNV-1a).
+ */
+uint64_t
+nns_edge_hash_string (const char *str)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  if (str) {
+    while (*str) {
+      hash ^= (unsigned char) (*str++);
+      hash *= 0x100000001b3ULL;
+    }
+  }
+
+  return hash;
 }
 
 /**
@@ -114,7 +161,7 @@ nns_edge_get_available_port (void)
 }
 
 /**
- * @brief Get host string (host:port). Caller should release returned string using nns_edge_free().
+ * @brief Get host string (host:port). Caller should release returned string using free().
  */
 char *
 nns_edge_get_host_string (const char *host, const int port)
@@ -162,16 +209,73 @@ nns_edge_parse_port_number (const char *port_str)
 }
 
 /**
- * @brief Allocate new memory. The max size is SIZE_MAX.
- * @note Caller should release newly allocated memory using nns_edge_free().
+ * @brief Set the default memory allocator of the process.
+ */
+int
+nns_edge_set_default_allocator (const nns_edge_allocator_s * allocator)
+{
+  nns_edge_default_allocator_s *def = NULL;
+
+  if (allocator) {
+    if (!allocator->alloc || !allocator->aligned_alloc || !allocator->free) {
+      nns_edge_loge ("Invalid param, all callbacks of the allocator should be set.");
+      return NNS_EDGE_ERROR_INVALID_PARAMETER;
+    }
+
+    def = (nns_edge_default_allocator_s *) calloc (1,
+        sizeof (nns_edge_default_allocator_s));
+    if (!def) {
+      nns_edge_loge ("Failed to allocate memory for the allocator.");
+      return NNS_EDGE_ERROR_OUT_OF_MEMORY;
+    }
+
+    def->allocator = *allocator;
+  }
+
+  pthread_mutex_lock (&g_allocator_lock);
+  if (def) {
+    def->next = g_allocator_list;
+    g_allocator_list = def;
+  }
+
+  __atomic_store_n (&g_default_allocator, def, __ATOMIC_RELEASE);
+  pthread_mutex_unlock (&g_allocator_lock);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Internal function to get the allocator. Returns null if the standard library should be used.
+ */
+static const nns_edge_allocator_s *
+_get_allocator (const nns_edge_allocator_s * allocator)
+{
+  nns_edge_default_allocator_s *def;
+
+  if (allocator && allocator->alloc)
+    return allocator;
+
+  def = __atomic_load_n (&g_default_allocator, __ATOMIC_ACQUIRE);
+  return def ? &def->allocator : NULL;
+}
+
+/**
+ * @brief Allocate new memory with given allocator.
  */
 void *
-nns_edge_malloc (nns_size_t size)
+nns_edge_allocator_alloc (const nns_edge_allocator_s * allocator,
+    nns_size_t size)
 {
   void *mem = NULL;
 
-  if (size > 0 && size <= SIZE_MAX)
-    mem = malloc (size);
+  if (size > 0 && size <= SIZE_MAX) {
+    allocator = _get_allocator (allocator);
+
+    if (allocator)
+      mem = allocator->alloc (size, allocator->user_data);
+    else
+      mem = malloc (size);
+  }
 
   if (!mem)
     nns_edge_loge ("Failed to allocate memory (%" PRIu64 ").", size);
@@ -180,15 +284,153 @@ nns_edge_malloc (nns_size_t size)
 }
 
 /**
- * @brief Free allocated memory.
+ * @brief Allocate new memory aligned to given bytes with given allocator.
+ */
+void *
+nns_edge_allocator_aligned_alloc (const nns_edge_allocator_s * allocator,
+    nns_size_t alignment, nns_size_t size)
+{
+  void *mem = NULL;
+
+  if (alignment < sizeof (void *) || (alignment & (alignment - 1)) != 0) {
+    nns_edge_loge ("Invalid param, alignment %" PRIu64 " is not power of 2.",
+        alignment);
+    return NULL;
+  }
+
+  if (size > 0 && size <= SIZE_MAX) {
+    allocator = _get_allocator (allocator);
+
+    if (allocator) {
+      mem = allocator->aligned_alloc (alignment, size, allocator->user_data);
+    } else if (posix_memalign (&mem, (size_t) alignment, (size_t) size) != 0) {
+      mem = NULL;
+    }
+  }
+
+  if (!mem)
+    nns_edge_loge ("Failed to allocate aligned memory (%" PRIu64 ").", size);
+
+  return mem;
+}
+
+/**
+ * @brief Allocate new memory filled with zero with given allocator.
+ */
+void *
+nns_edge_allocator_calloc (const nns_edge_allocator_s * allocator,
+    nns_size_t num, nns_size_t size)
+{
+  void *mem = NULL;
+
+  if (num > 0 && size > 0 && size <= SIZE_MAX / num) {
+    allocator = _get_allocator (allocator);
+
+    if (allocator) {
+      mem = allocator->alloc (num * size, allocator->user_data);
+      if (mem)
+        memset (mem, 0, num * size);
+    } else {
+      mem = calloc (num, size);
+    }
+  }
+
+  if (!mem)
+    nns_edge_loge ("Failed to allocate memory (%" PRIu64 " x %" PRIu64 ").",
+        num, size);
+
+  return mem;
+}
+
+/**
+ * @brief Change the size of the memory allocated with given allocator.
+ */
+void *
+nns_edge_allocator_realloc (const nns_edge_allocator_s * allocator,
+    void *data, nns_size_t old_size, nns_size_t size)
+{
+  void *mem = NULL;
+
+  if (!data)
+    return nns_edge_allocator_alloc (allocator, size);
+
+  if (size > 0 && size <= SIZE_MAX) {
+    allocator = _get_allocator (allocator);
+
+    if (!allocator) {
+      mem = realloc (data, size);
+    } else {
+      /* The allocator does not have the callback to resize the memory. */
+      mem = allocator->alloc (size, allocator->user_data);
+      if (mem) {
+        memcpy (mem, data, (old_size < size) ? old_size : size);
+        allocator->free (data, allocator->user_data);
+      }
+    }
+  }
+
+  if (!mem)
+    nns_edge_loge ("Failed to reallocate memory (%" PRIu64 ").", size);
+
+  return mem;
+}
+
+/**
+ * @brief Free allocated memory with given allocator.
  */
 void
-nns_edge_free (void *data)
+nns_edge_allocator_free (const nns_edge_allocator_s * allocator, void *data)
 {
-  if (data)
+  if (!data)
+    return;
+
+  allocator = _get_allocator (allocator);
+
+  if (allocator)
+    allocator->free (data, allocator->user_data);
+  else
     free (data);
 }
 
+/**
+ * @brief Allocate new memory with the default allocator. The max size is SIZE_MAX.
+ * @note Caller should release newly allocated memory using nns_edge_free().
+ */
+void *
+nns_edge_malloc (nns_size_t size)
+{
+  return nns_edge_allocator_alloc (NULL, size);
+}
+
+/**
+ * @brief Allocate new memory filled with zero with the default allocator.
+ * @note Caller should release newly allocated memory using nns_edge_free().
+ */
+void *
+nns_edge_calloc (nns_size_t num, nns_size_t size)
+{
+  return nns_edge_allocator_calloc (NULL, num, size);
+}
+
+/**
+ * @brief Allocate new memory aligned to given bytes with the default allocator.
+ * @note Caller should release newly allocated memory using nns_edge_free().
+ */
+void *
+nns_edge_malloc_aligned (nns_size_t alignment, nns_size_t size)
+{
+  return nns_edge_allocator_aligned_alloc (NULL, alignment, size);
+}
+
+/**
+ * @brief Free allocated memory with the default allocator.
+ */
+void
+nns_edge_free (void *data)
+{
+  nns_edge_allocator_free (NULL, data);
+}
+
 /**
  * @brief Allocate new memory and copy bytes.
  * @note Caller should release newly allocated memory using nns_edge_free().
@@ -210,7 +452,7 @@ nns_edge_memdup (const void *data, nns_size_t size)
 
 /**
  * @brief Allocate new memory and copy string.
- * @note Caller should release newly allocated string using nns_edge_free().
+ * @note Caller should release newly allocated string using free().
  */
 char *
 nns_edge_strdup (const char *str)
@@ -225,7 +467,7 @@ nns_edge_strdup (const char *str)
 
 /**
  * @brief Allocate new memory and copy bytes of string.
- * @note Caller should release newly allocated string using nns_edge_free().
+ * @note Caller should release newly allocated string using free().
  */
 char *
 nns_edge_strndup (const char *str, nns_size_t len)
@@ -233,7 +475,8 @@ nns_edge_strndup (const char *str, nns_size_t len)
   char *new_str = NULL;
 
   if (str) {
-    new_str = (char *) nns_edge_malloc (len + 1);
+    /* The string may be returned to the caller, do not use the allocator. */
+    new_str = (char *) malloc (len + 1);
 
     if (new_str) {
       strncpy (new_str, str, len);
@@ -246,7 +489,7 @@ nns_edge_strndup (const char *str, nns_size_t len)
 
 /**
  * @brief Allocate new memory and print formatted string.
- * @note Caller should release newly allocated string using nns_edge_free().
+ * @note Caller should release newly allocated string using free().
  */
 char *
 nns_edge_strdup_printf (const char *format, ...)
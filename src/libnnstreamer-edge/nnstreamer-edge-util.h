@@ -54,6 +54,7 @@ extern "C" {
 #define STR_IS_VALID(s) ((s) && (s)[0] != '\0')
 #define PORT_IS_VALID(p) ((p) > 0 && (p) <= 65535)
 #define SAFE_FREE(p) do { if (p) { free (p); (p) = NULL; } } while (0)
+#define SAFE_EDGE_FREE(p) do { if (p) { nns_edge_free (p); (p) = NULL; } } while (0)
 
 #define NNS_EDGE_MAGIC 0xfeedfeed
 #define NNS_EDGE_MAGIC_DEAD 0xdeaddead
@@ -75,12 +76,17 @@ extern "C" {
       gettimeofday (&now, NULL); \
       ts.tv_sec = now.tv_sec + (ms) / 1000; \
       ts.tv_nsec = now.tv_usec * 1000 + ((ms) % 1000) * 1000000; \
+      if (ts.tv_nsec >= 1000000000) { \
+        ts.tv_sec++; \
+        ts.tv_nsec -= 1000000000; \
+      } \
       pthread_cond_timedwait (&(h)->cond, &(h)->lock, &ts); \
     } else { \
       pthread_cond_wait (&(h)->cond, &(h)->lock); \
     } \
   } while (0)
 #define nns_edge_cond_signal(h) do { pthread_cond_signal (&(h)->cond); } while (0)
+#define nns_edge_cond_broadcast(h) do { pthread_cond_broadcast (&(h)->cond); } while (0)
 
 /**
  * @brief Internal data structure for raw data.
@@ -89,13 +95,24 @@ typedef struct {
   void *data;
   nns_size_t data_len;
   nns_edge_data_destroy_cb destroy_cb;
+  bool transferable; /**< true if the memory is allocated with the alloc callback of the application */
 } nns_edge_raw_data_s;
 
+/**
+ * @brief Get the monotonic time in microseconds.
+ */
+int64_t nns_edge_get_monotonic_time (void);
+
 /**
  * @brief Generate client ID.
  */
 int64_t nns_edge_generate_id (void);
 
+/**
+ * @brief Get the hash value of string.
+ */
+uint64_t nns_edge_hash_string (const char *str);
+
 /**
  * @brief Generate the version key.
  */
@@ -112,7 +129,7 @@ bool nns_edge_parse_version_key (const uint64_t version_key, unsigned int *major
 int nns_edge_get_available_port (void);
 
 /**
- * @brief Get host string (host:port). Caller should release returned string using nns_edge_free().
+ * @brief Get host string (host:port). Caller should release returned string using free().
  */
 char *nns_edge_get_host_string (const char *host, const int port);
 
@@ -127,13 +144,54 @@ void nns_edge_parse_host_string (const char *host_str, char **host, int *port);
 int nns_edge_parse_port_number (const char *port_str);
 
 /**
- * @brief Allocate new memory. The max size is SIZE_MAX.
+ * @brief Allocate new memory with given allocator. If the allocator is null or empty, the default allocator is used.
+ * @note Caller should release newly allocated memory using nns_edge_allocator_free() with same allocator.
+ */
+void *nns_edge_allocator_alloc (const nns_edge_allocator_s *allocator, nns_size_t size);
+
+/**
+ * @brief Allocate new memory aligned to given bytes with given allocator. If the allocator is null or empty, the default allocator is used.
+ * @note Caller should release newly allocated memory using nns_edge_allocator_free() with same allocator.
+ */
+void *nns_edge_allocator_aligned_alloc (const nns_edge_allocator_s *allocator, nns_size_t alignment, nns_size_t size);
+
+/**
+ * @brief Allocate new memory filled with zero with given allocator. If the allocator is null or empty, the default allocator is used.
+ * @note Caller should release newly allocated memory using nns_edge_allocator_free() with same allocator.
+ */
+void *nns_edge_allocator_calloc (const nns_edge_allocator_s *allocator, nns_size_t num, nns_size_t size);
+
+/**
+ * @brief Change the size of the memory allocated with given allocator. The contents are kept up to the smaller size.
+ * @note Given memory is released if new memory is allocated. Otherwise it is not changed.
+ */
+void *nns_edge_allocator_realloc (const nns_edge_allocator_s *allocator, void *data, nns_size_t old_size, nns_size_t size);
+
+/**
+ * @brief Free allocated memory with given allocator. If the allocator is null or empty, the default allocator is used.
+ */
+void nns_edge_allocator_free (const nns_edge_allocator_s *allocator, void *data);
+
+/**
+ * @brief Allocate new memory with the default allocator. The max size is SIZE_MAX.
  * @note Caller should release newly allocated memory using nns_edge_free().
  */
 void *nns_edge_malloc (nns_size_t size);
 
 /**
- * @brief Free allocated memory.
+ * @brief Allocate new memory filled with zero with the default allocator.
+ * @note Caller should release newly allocated memory using nns_edge_free().
+ */
+void *nns_edge_calloc (nns_size_t num, nns_size_t size);
+
+/**
+ * @brief Allocate new memory aligned to given bytes with the default allocator.
+ * @note Caller should release newly allocated memory using nns_edge_free().
+ */
+void *nns_edge_malloc_aligned (nns_size_t alignment, nns_size_t size);
+
+/**
+ * @brief Free allocated memory with the default allocator.
  */
 void nns_edge_free (void *data);
 
@@ -145,19 +203,19 @@ void *nns_edge_memdup (const void *data, nns_size_t size);
 
 /**
  * @brief Allocate new memory and copy string.
- * @note Caller should release newly allocated string using nns_edge_free().
+ * @note Caller should release newly allocated string using free().
  */
 char *nns_edge_strdup (const char *str);
 
 /**
  * @brief Allocate new memory and copy bytes of string.
- * @note Caller should release newly allocated string using nns_edge_free().
+ * @note Caller should release newly allocated string using free().
  */
 char *nns_edge_strndup (const char *str, nns_size_t len);
 
 /**
  * @brief Allocate new memory and print formatted string.
- * @note Caller should release newly allocated string using nns_edge_free().
+ * @note Caller should release newly allocated string using free().
  */
 char *nns_edge_strdup_printf (const char *format, ...);
 
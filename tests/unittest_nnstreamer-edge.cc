@@ -8,7 +8,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <arpa/inet.h>
 #include "nnstreamer-edge.h"
+#include "nnstreamer-edge-codec.h"
 #include "nnstreamer-edge-data.h"
 #include "nnstreamer-edge-event.h"
 #include "nnstreamer-edge-metadata.h"
@@ -16,6 +18,8 @@
 #include "nnstreamer-edge-log.h"
 #include "nnstreamer-edge-util.h"
 #include "nnstreamer-edge-queue.h"
+#include "nnstreamer-edge-pool.h"
+#include "nnstreamer-edge-request.h"
 
 /**
  * @brief Data struct for unittest.
@@ -27,6 +31,7 @@ typedef struct
   bool is_server;
   bool event_cb_released;
   unsigned int received;
+  unsigned int capability;
 } ne_test_data_s;
 
 /**
@@ -85,6 +90,9 @@ _test_edge_event_cb (nns_edge_event_h event_h, void *user_data)
     case NNS_EDGE_EVENT_CALLBACK_RELEASED:
       _td->event_cb_released = true;
       break;
+    case NNS_EDGE_EVENT_CAPABILITY:
+      _td->capability++;
+      break;
     case NNS_EDGE_EVENT_NEW_DATA_RECEIVED:
       _td->received++;
 
@@ -130,6 +138,149 @@ _test_edge_event_cb (nns_edge_event_h event_h, void *user_data)
   return NNS_EDGE_ERROR_NONE;
 }
 
+/**
+ * @brief Data struct to check the metadata of received data for test.
+ */
+typedef struct
+{
+  unsigned int received;
+  unsigned int matched;
+} ne_test_meta_data_s;
+
+/**
+ * @brief Edge event callback for test, check the metadata updated in each data.
+ */
+static int
+_test_meta_event_cb (nns_edge_event_h event_h, void *user_data)
+{
+  ne_test_meta_data_s *_tm = (ne_test_meta_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  int64_t index = -1;
+  char *val = NULL;
+  bool matched;
+  int ret;
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
+
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_info_int64 (data_h, "index", &index);
+  matched = (ret == NNS_EDGE_ERROR_NONE);
+
+  /* The value of key1 is changed from 2nd data, key2 exists in even data. */
+  ret = nns_edge_data_get_info (data_h, "test-key1", &val);
+  matched = matched && (ret == NNS_EDGE_ERROR_NONE) &&
+      (strcmp (val, (index < 2) ? "test-value1" : "test-value1-changed") == 0);
+  SAFE_FREE (val);
+
+  ret = nns_edge_data_get_info (data_h, "test-key2", &val);
+  if (index % 2 == 0)
+    matched = matched && (ret == NNS_EDGE_ERROR_NONE) &&
+        (strcmp (val, "test-value2") == 0);
+  else
+    matched = matched && (ret != NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (val);
+
+  if (matched)
+    _tm->matched++;
+  _tm->received++;
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Memory allocator for test, count allocated memories.
+ */
+typedef struct
+{
+  unsigned int allocated;
+  unsigned int released;
+} ne_test_allocator_s;
+
+/**
+ * @brief Allocate memory for test.
+ */
+static void *
+_test_alloc (nns_size_t size, void *user_data)
+{
+  ne_test_allocator_s *ta = (ne_test_allocator_s *) user_data;
+
+  __atomic_add_fetch (&ta->allocated, 1U, __ATOMIC_SEQ_CST);
+  return malloc (size);
+}
+
+/**
+ * @brief Allocate aligned memory for test.
+ */
+static void *
+_test_aligned_alloc (nns_size_t alignment, nns_size_t size, void *user_data)
+{
+  ne_test_allocator_s *ta = (ne_test_allocator_s *) user_data;
+  void *mem = NULL;
+
+  if (posix_memalign (&mem, alignment, size) != 0)
+    return NULL;
+
+  __atomic_add_fetch (&ta->allocated, 1U, __ATOMIC_SEQ_CST);
+  return mem;
+}
+
+/**
+ * @brief Release memory for test.
+ */
+static void
+_test_free (void *data, void *user_data)
+{
+  ne_test_allocator_s *ta = (ne_test_allocator_s *) user_data;
+
+  __atomic_add_fetch (&ta->released, 1U, __ATOMIC_SEQ_CST);
+  free (data);
+}
+
+/**
+ * @brief The number of memories released with the callback for test.
+ */
+static unsigned int g_test_released = 0U;
+
+/**
+ * @brief Release the memory allocated with the callback for test.
+ */
+static void
+_test_alloc_cb_free (void *data)
+{
+  __atomic_add_fetch (&g_test_released, 1U, __ATOMIC_SEQ_CST);
+  free (data);
+}
+
+/**
+ * @brief Callback to allocate the memory of received data for test.
+ */
+static void *
+_test_alloc_cb (unsigned int index, nns_size_t size,
+    nns_edge_data_destroy_cb * destroy_cb, void *user_data)
+{
+  ne_test_allocator_s *ta = (ne_test_allocator_s *) user_data;
+  void *mem = NULL;
+
+  EXPECT_EQ (index, 0U);
+
+  if (posix_memalign (&mem, 64U, size) != 0)
+    return NULL;
+
+  __atomic_add_fetch (&ta->allocated, 1U, __ATOMIC_SEQ_CST);
+  *destroy_cb = _test_alloc_cb_free;
+  return mem;
+}
+
 /**
  * @brief Connect to local host, multiple clients.
  */
@@ -265,894 +416,5151 @@ TEST(edge, connectLocal)
 }
 
 /**
- * @brief Create edge handle - invalid param.
+ * @brief Data struct to check the requests pipelined in query client.
  */
-TEST(edge, createHandleInvalidParam01_n)
+typedef struct
 {
-  nns_edge_h edge_h;
-  int ret;
-
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_UNKNOWN,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  nns_edge_data_h requests[8];
+  unsigned int received;
+  int64_t request_ids[8];
+  int64_t response_ids[8];
+  int64_t response_index[8];
+} ne_test_pipeline_data_s;
 
 /**
- * @brief Create edge handle - invalid param.
+ * @brief Edge event callback for test, keep the requests in query server.
  */
-TEST(edge, createHandleInvalidParam02_n)
+static int
+_test_pipeline_server_cb (nns_edge_event_h event_h, void *user_data)
 {
+  ne_test_pipeline_data_s *_tp = (ne_test_pipeline_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  unsigned int n;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-/**
- * @brief Create edge handle - invalid param.
- */
-TEST(edge, createHandleInvalidParam03_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_HYBRID,
-      NNS_EDGE_NODE_TYPE_UNKNOWN, &edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-/**
- * @brief Start - invalid param.
- */
-TEST(edge, startInvalidParam01_n)
-{
-  int ret;
+  n = __atomic_load_n (&_tp->received, __ATOMIC_SEQ_CST);
+  if (n < 8U) {
+    nns_edge_data_copy (data_h, &_tp->requests[n]);
+    __atomic_add_fetch (&_tp->received, 1U, __ATOMIC_SEQ_CST);
+  }
 
-  ret = nns_edge_start (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Start - invalid param.
+ * @brief Edge event callback for test, check the responses in query client.
  */
-TEST(edge, startInvalidParam02_n)
+static int
+_test_pipeline_client_cb (nns_edge_event_h event_h, void *user_data)
 {
-  nns_edge_h edge_h;
+  ne_test_pipeline_data_s *_tp = (ne_test_pipeline_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  unsigned int n;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_start (edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  n = _tp->received;
+  if (n < 8U) {
+    nns_edge_data_get_info_int64 (data_h, "request_id", &_tp->response_ids[n]);
+    nns_edge_data_get_info_int64 (data_h, "index", &_tp->response_index[n]);
+    __atomic_add_fetch (&_tp->received, 1U, __ATOMIC_SEQ_CST);
+  }
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
-
-/**
- * @brief Release edge handle - invalid param.
- */
-TEST(edge, releaseHandleInvalidParam01_n)
-{
-  int ret;
 
-  ret = nns_edge_release_handle (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Release edge handle - invalid param.
+ * @brief Send many requests without waiting for the responses, and match the responses received out of order.
  */
-TEST(edge, releaseHandleInvalidParam02_n)
+TEST(edge, connectQueryPipelining)
 {
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_h server_h, client_h;
+  ne_test_pipeline_data_s _ts, _tc;
+  nns_edge_data_h data_h;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  memset (&_ts, 0, sizeof (ne_test_pipeline_data_s));
+  memset (&_tc, 0, sizeof (ne_test_pipeline_data_s));
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (server_h, _test_pipeline_server_cb, &_ts);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  SAFE_FREE (val);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  /* Prepare client */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (client_h, _test_pipeline_client_cb, &_tc);
+  nns_edge_set_info (client_h, "CAPS", "test client");
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  usleep (200000);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Set event callback - null param to clear event callback.
- */
-TEST(edge, setEventCbSetNullCallback)
-{
-  nns_edge_h edge_h;
-  ne_test_data_s *_td;
-  int ret;
+  usleep (200000);
 
-  _td = _get_test_data (false);
-  ASSERT_TRUE (_td != NULL);
+  /* Send requests, the server does not respond until all requests are received. */
+  for (i = 0; i < 8U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_set_info_int64 (data_h, "index", i);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_send (client_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    /* New request ID is set in the data. */
+    ret = nns_edge_data_get_info_int64 (data_h, "request_id",
+        &_tc.request_ids[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_GT (_tc.request_ids[i], 0);
+    if (i > 0U)
+      EXPECT_NE (_tc.request_ids[i], _tc.request_ids[i - 1]);
 
-  /* Set null param to clear event callback. */
-  ret = nns_edge_set_event_callback (edge_h, NULL, NULL);
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Wait for the requests (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (__atomic_load_n (&_ts.received, __ATOMIC_SEQ_CST) >= 8U)
+      break;
+  } while (retry++ < 100U);
+
+  ASSERT_EQ (_ts.received, 8U);
+
+  ret = nns_edge_get_info (client_h, "OUTSTANDING_REQUESTS", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "8");
+  SAFE_FREE (val);
 
-  EXPECT_TRUE (_td->event_cb_released);
+  /* Respond in reverse order. */
+  for (i = 8U; i > 0U; i--) {
+    ret = nns_edge_send (server_h, _ts.requests[i - 1]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_release_handle (edge_h);
+  /* Wait for the responses (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (__atomic_load_n (&_tc.received, __ATOMIC_SEQ_CST) >= 8U)
+      break;
+  } while (retry++ < 100U);
+
+  EXPECT_EQ (_tc.received, 8U);
+
+  /* The response has the ID of its request. */
+  for (i = 0; i < _tc.received; i++) {
+    EXPECT_EQ (_tc.response_index[i], 7 - (int64_t) i);
+    EXPECT_EQ (_tc.response_ids[i], _tc.request_ids[7 - i]);
+  }
+
+  ret = nns_edge_get_info (client_h, "OUTSTANDING_REQUESTS", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
 
-  _free_test_data (_td);
+  for (i = 0; i < 8U; i++)
+    nns_edge_data_destroy (_ts.requests[i]);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set event callback - invalid param.
+ * @brief Data struct to send the queries in many threads.
  */
-TEST(edge, setEventCbInvalidParam01_n)
+typedef struct
 {
-  int ret;
-
-  ret = nns_edge_set_event_callback (NULL, _test_edge_event_cb, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  nns_edge_h server_h;
+  nns_edge_h client_h;
+  unsigned int events; /**< the number of data received in event callback of client */
+  unsigned int responses; /**< the number of responses matched with the requests */
+} ne_test_query_data_s;
 
 /**
- * @brief Set event callback - invalid param.
+ * @brief Edge event callback for test, query server responds the request except the data having "skip".
  */
-TEST(edge, setEventCbInvalidParam02_n)
+static int
+_test_query_server_cb (nns_edge_event_h event_h, void *user_data)
 {
-  nns_edge_h edge_h;
-  ne_test_data_s *_td;
+  ne_test_query_data_s *_tq = (ne_test_query_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  char *val = NULL;
   int ret;
 
-  _td = _get_test_data (false);
-  ASSERT_TRUE (_td != NULL);
-
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* The response has the client ID and request ID of the request. */
+  if (nns_edge_data_get_info (data_h, "skip", &val) != NNS_EDGE_ERROR_NONE) {
+    ret = nns_edge_send (_tq->server_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+  SAFE_FREE (val);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  _free_test_data (_td);
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Connect - invalid param.
+ * @brief Edge event callback for test, count the data received in query client.
  */
-TEST(edge, connectInvalidParam01_n)
+static int
+_test_query_client_cb (nns_edge_event_h event_h, void *user_data)
 {
+  ne_test_query_data_s *_tq = (ne_test_query_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
   int ret;
 
-  ret = nns_edge_connect (NULL, "127.0.0.1", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  if (event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    __atomic_add_fetch (&_tq->events, 1U, __ATOMIC_SEQ_CST);
+
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Connect - invalid param.
+ * @brief Thread to send the queries and check the responses.
  */
-TEST(edge, connectInvalidParam02_n)
+static void *
+_test_thread_edge_query (void *thread_data)
 {
-  nns_edge_h edge_h;
+  ne_test_query_data_s *_tq = (ne_test_query_data_s *) thread_data;
+  nns_edge_data_h request_h, response_h;
+  int64_t index, request_id, response_id;
+  unsigned int i;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 5U; i++) {
+    ret = nns_edge_data_create (&request_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_set_info_int64 (request_h, "index", (int64_t) i);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_query (_tq->client_h, request_h, &response_h, 5000U);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+    if (ret == NNS_EDGE_ERROR_NONE) {
+      nns_edge_data_get_info_int64 (request_h, "request_id", &request_id);
+      nns_edge_data_get_info_int64 (response_h, "request_id", &response_id);
+      nns_edge_data_get_info_int64 (response_h, "index", &index);
 
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+      if (request_id == response_id && index == (int64_t) i)
+        __atomic_add_fetch (&_tq->responses, 1U, __ATOMIC_SEQ_CST);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+      nns_edge_data_destroy (response_h);
+    }
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_destroy (request_h);
+  }
+
+  return NULL;
 }
 
 /**
- * @brief Connect - invalid param.
+ * @brief Send the queries in many threads, each thread waits for its response.
  */
-TEST(edge, connectInvalidParam03_n)
+TEST(edge, connectQuerySync)
 {
-  nns_edge_h edge_h;
-  int ret;
+  ne_test_query_data_s _tq;
+  nns_edge_data_h request_h, response_h;
+  pthread_t query_thread[4];
+  struct timeval start, end;
+  unsigned int i;
+  int64_t elapsed;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  memset (&_tq, 0, sizeof (ne_test_query_data_s));
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_tq.server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (_tq.server_h, _test_query_server_cb, &_tq);
+  nns_edge_set_info (_tq.server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (_tq.server_h, "PORT", val);
+  nns_edge_set_info (_tq.server_h, "CAPS", "test server");
+  SAFE_FREE (val);
 
-  ret = nns_edge_connect (edge_h, NULL, 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_release_handle (edge_h);
+  /* Prepare client */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &_tq.client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
-
-/**
- * @brief Connect - invalid param.
- */
-TEST(edge, connectInvalidParam04_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_set_event_callback (_tq.client_h, _test_query_client_cb, &_tq);
+  nns_edge_set_info (_tq.client_h, "CAPS", "test client");
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_start (_tq.server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  ret = nns_edge_start (_tq.client_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_connect (edge_h, "", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_connect (_tq.client_h, "127.0.0.1", port);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Connect - invalid param.
- */
-TEST(edge, connectInvalidParam05_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  usleep (200000);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 4U; i++)
+    pthread_create (&query_thread[i], NULL, _test_thread_edge_query, &_tq);
+  for (i = 0; i < 4U; i++)
+    pthread_join (query_thread[i], NULL);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (_tq.responses, 20U);
+
+  /* The server does not respond, the query is timed out. */
+  ret = nns_edge_data_create (&request_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_data_set_info (request_h, "skip", "true");
 
-  /* Invalid port number */
-  ret = nns_edge_connect (edge_h, "127.0.0.1", -1);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 0);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 77777);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  gettimeofday (&start, NULL);
+  ret = nns_edge_query (_tq.client_h, request_h, &response_h, 300U);
+  gettimeofday (&end, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_TIMEOUT);
+  EXPECT_TRUE (response_h == NULL);
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+  elapsed = (end.tv_sec - start.tv_sec) * 1000 + (end.tv_usec - start.tv_usec) / 1000;
+  EXPECT_GE (elapsed, 300);
+  EXPECT_LT (elapsed, 3000);
 
-/**
- * @brief Connect - invalid param.
- */
-TEST(edge, connectInvalidParam06_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  nns_edge_data_destroy (request_h);
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* The responses are not passed to the event callback. */
+  EXPECT_EQ (_tq.events, 0U);
 
-  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  ret = nns_edge_get_info (_tq.client_h, "OUTSTANDING_REQUESTS", &val);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
 
-  /* not started */
-  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_release_handle (_tq.client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (_tq.server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Disconnect - invalid param.
+ * @brief Data struct to check the batch of requests in query server.
  */
-TEST(edge, disconnectInvalidParam01_n)
+typedef struct
 {
-  int ret;
-
-  ret = nns_edge_disconnect (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  nns_edge_h server_h;
+  unsigned int batches; /**< the number of batches */
+  unsigned int requests; /**< the number of requests in all batches */
+  unsigned int max_size; /**< the max number of requests in a batch */
+  unsigned int last_size; /**< the number of requests in last batch */
+  unsigned int responses[2]; /**< the number of responses received in each client */
+} ne_test_batch_data_s;
 
 /**
- * @brief Disconnect - invalid param.
+ * @brief Edge event callback for test, query server responds all requests in the batch.
  */
-TEST(edge, disconnectInvalidParam02_n)
+static int
+_test_batch_server_cb (nns_edge_event_h event_h, void *user_data)
 {
-  nns_edge_h edge_h;
+  ne_test_batch_data_s *_tb = (ne_test_batch_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h *batch;
+  unsigned int i, num;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  /* The requests should be delivered in a batch. */
+  EXPECT_NE (event, NNS_EDGE_EVENT_NEW_DATA_RECEIVED);
+  if (event != NNS_EDGE_EVENT_NEW_BATCH_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_disconnect (edge_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_new_batch (event_h, &batch, &num);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* Each response has the client ID of its request. */
+  for (i = 0; i < num; i++) {
+    ret = nns_edge_send (_tb->server_h, batch[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_destroy (batch[i]);
+  }
+  SAFE_FREE (batch);
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  if (num > _tb->max_size)
+    _tb->max_size = num;
+  _tb->last_size = num;
+  __atomic_add_fetch (&_tb->requests, num, __ATOMIC_SEQ_CST);
+  __atomic_add_fetch (&_tb->batches, 1U, __ATOMIC_SEQ_CST);
+
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Send - invalid param.
+ * @brief Edge event callback for test, count the responses in query client.
  */
-TEST(edge, sendInvalidParam01_n)
+static int
+_test_batch_client_cb (nns_edge_event_h event_h, void *user_data)
 {
-  nns_edge_data_h data_h;
+  unsigned int *responses = (unsigned int *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, "client_id", "10");
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_send (NULL, data_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  if (event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    __atomic_add_fetch (responses, 1U, __ATOMIC_SEQ_CST);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  return NNS_EDGE_ERROR_NONE;
 }
 
 /**
- * @brief Send - invalid param.
+ * @brief Query server gathers the requests from all clients into a batch.
  */
-TEST(edge, sendInvalidParam02_n)
+TEST(edge, connectQueryBatch)
 {
-  nns_edge_h edge_h;
+  nns_edge_h client_h[2];
+  ne_test_batch_data_s _tb;
   nns_edge_data_h data_h;
-  int ret;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  memset (&_tb, 0, sizeof (ne_test_batch_data_s));
+  port = nns_edge_get_available_port ();
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_tb.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (_tb.server_h, _test_batch_server_cb, &_tb);
+  nns_edge_set_info (_tb.server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (_tb.server_h, "PORT", val);
+  nns_edge_set_info (_tb.server_h, "CAPS", "test server");
+  nns_edge_set_info (_tb.server_h, "BATCH_SIZE", "4");
+  nns_edge_set_info (_tb.server_h, "BATCH_TIMEOUT", "500");
+  SAFE_FREE (val);
 
-  ret = nns_edge_data_set_info (data_h, "client_id", "10");
+  ret = nns_edge_start (_tb.server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_send (edge_h, data_h);
+  /* The batch size cannot be changed after starting the server. */
+  ret = nns_edge_set_info (_tb.server_h, "BATCH_SIZE", "8");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* Prepare clients */
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_set_event_callback (client_h[i], _test_batch_client_cb,
+        &_tb.responses[i]);
+    nns_edge_set_info (client_h[i], "CAPS", "test client");
 
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_start (client_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+  usleep (200000);
 
-/**
- * @brief Send - invalid param.
- */
-TEST(edge, sendInvalidParam03_n)
-{
-  nns_edge_h edge_h;
-  int ret;
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_connect (client_h[i], "127.0.0.1", port);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  usleep (200000);
 
-  ret = nns_edge_send (edge_h, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  /* 9 requests, 2 batches are full and the last one is timed out. */
+  for (i = 0; i < 9U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_set_info_int64 (data_h, "index", (int64_t) i);
 
-  ret = nns_edge_release_handle (edge_h);
+    ret = nns_edge_send (client_h[i % 2U], data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    nns_edge_data_destroy (data_h);
+  }
+
+  /* Wait for the responses (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (__atomic_load_n (&_tb.responses[0], __ATOMIC_SEQ_CST) >= 5U &&
+        __atomic_load_n (&_tb.responses[1], __ATOMIC_SEQ_CST) >= 4U)
+      break;
+  } while (retry++ < 100U);
+
+  EXPECT_EQ (_tb.responses[0], 5U);
+  EXPECT_EQ (_tb.responses[1], 4U);
+  EXPECT_EQ (_tb.requests, 9U);
+  EXPECT_EQ (_tb.batches, 3U);
+  EXPECT_EQ (_tb.max_size, 4U);
+  EXPECT_EQ (_tb.last_size, 1U);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_release_handle (client_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+  ret = nns_edge_release_handle (_tb.server_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Data struct of query server to test the requests balanced in query client.
  */
-TEST(edge, setInfoInvalidParam01_n)
+typedef struct
 {
-  int ret;
-
-  ret = nns_edge_set_info (NULL, "caps", "temp-caps");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
+  nns_edge_h server_h;
+  int mode; /**< 0: respond the request, 1: hold the request, 2: drop the request, 3: respond after 300 ms, 4: respond new data without request ID */
+  unsigned int received;
+  nns_edge_data_h held[8];
+} ne_test_lb_server_s;
 
 /**
- * @brief Set info - invalid param.
+ * @brief Edge event callback for test, query server responds, holds or drops the request.
  */
-TEST(edge, setInfoInvalidParam02_n)
+static int
+_test_lb_server_cb (nns_edge_event_h event_h, void *user_data)
 {
-  nns_edge_h edge_h;
+  ne_test_lb_server_s *_ts = (ne_test_lb_server_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h, response_h;
+  int64_t client_id;
+  unsigned int n;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
 
-  ret = nns_edge_set_info (edge_h, "caps", "temp-caps");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  n = __atomic_fetch_add (&_ts->received, 1U, __ATOMIC_SEQ_CST);
+  if (_ts->mode == 3)
+    usleep (300000);
+
+  if (_ts->mode == 0 || _ts->mode == 3) {
+    ret = nns_edge_send (_ts->server_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  } else if (_ts->mode == 4) {
+    ret = nns_edge_data_get_info_int64 (data_h, "client_id", &client_id);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_create (&response_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_set_info_int64 (response_h, "client_id", client_id);
+    nns_edge_data_set_info (response_h, "response", "new");
+
+    ret = nns_edge_send (_ts->server_h, response_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_destroy (response_h);
+  } else if (_ts->mode == 1 && n < 8U) {
+    nns_edge_data_copy (data_h, &_ts->held[n]);
+  }
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Query client connected to many servers, the requests are balanced and the unhealthy server is ejected.
+ */
+TEST(edge, connectQueryBalanced)
+{
+  nns_edge_h client_h;
+  ne_test_lb_server_s _ts[2];
+  ne_test_query_data_s _tq;
+  nns_edge_data_h data_h, response_h;
+  unsigned int i, n, retry, timeouts;
+  int ret, port[2];
+  char *val;
+
+  memset (_ts, 0, sizeof (_ts));
+  memset (&_tq, 0, sizeof (ne_test_query_data_s));
+
+  /* Prepare servers (127.0.0.1:port), hold the requests. */
+  for (i = 0; i < 2U; i++) {
+    port[i] = nns_edge_get_available_port ();
+    val = nns_edge_strdup_printf ("%d", port[i]);
+    ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_ts[i].server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_set_event_callback (_ts[i].server_h, _test_lb_server_cb, &_ts[i]);
+    nns_edge_set_info (_ts[i].server_h, "IP", "127.0.0.1");
+    nns_edge_set_info (_ts[i].server_h, "PORT", val);
+    nns_edge_set_info (_ts[i].server_h, "CAPS", "test server");
+    SAFE_FREE (val);
+
+    _ts[i].mode = 1;
+    ret = nns_edge_start (_ts[i].server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Prepare client */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (client_h, _test_query_client_cb, &_tq);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  nns_edge_set_info (client_h, "LB_POLICY", "least-outstanding");
+  nns_edge_set_info (client_h, "LB_EJECT_FAILURES", "1");
+
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_connect (client_h, "127.0.0.1", port[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Already connected. */
+  ret = nns_edge_connect (client_h, "127.0.0.1", port[0]);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Send requests, the servers do not respond. */
+  for (i = 0; i < 8U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_send (client_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    nns_edge_data_destroy (data_h);
+  }
+
+  /* Wait for the requests (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (__atomic_load_n (&_ts[0].received, __ATOMIC_SEQ_CST) +
+        __atomic_load_n (&_ts[1].received, __ATOMIC_SEQ_CST) >= 8U)
+      break;
+  } while (retry++ < 100U);
+
+  /* Each request is sent to the server having the fewest outstanding requests. */
+  EXPECT_EQ (_ts[0].received, 4U);
+  EXPECT_EQ (_ts[1].received, 4U);
+
+  /* Respond the requests. */
+  for (i = 0; i < 2U; i++) {
+    for (n = 0; n < _ts[i].received && n < 8U; n++) {
+      ret = nns_edge_send (_ts[i].server_h, _ts[i].held[n]);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      nns_edge_data_destroy (_ts[i].held[n]);
+    }
+  }
+
+  /* Wait for the responses (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (__atomic_load_n (&_tq.events, __ATOMIC_SEQ_CST) >= 8U)
+      break;
+  } while (retry++ < 100U);
+
+  EXPECT_EQ (_tq.events, 8U);
+
+  ret = nns_edge_get_info (client_h, "OUTSTANDING_REQUESTS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
+
+  /* The second server drops the requests, it is ejected after the query is timed out. */
+  _ts[0].mode = 0;
+  _ts[0].received = 0U;
+  _ts[1].mode = 2;
+  _ts[1].received = 0U;
+  timeouts = 0U;
+
+  for (i = 0; i < 6U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_query (client_h, data_h, &response_h, 300U);
+    if (ret == NNS_EDGE_ERROR_TIMEOUT)
+      timeouts++;
+    else if (ret == NNS_EDGE_ERROR_NONE)
+      nns_edge_data_destroy (response_h);
+
+    nns_edge_data_destroy (data_h);
+  }
+
+  EXPECT_EQ (timeouts, 1U);
+  EXPECT_EQ (_ts[0].received, 5U);
+  EXPECT_EQ (_ts[1].received, 1U);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_release_handle (_ts[i].server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+}
+
+/**
+ * @brief Query server responds new data without request ID, the ID of the request is echoed in order.
+ */
+TEST(edge, connectQueryNoRequestId)
+{
+  nns_edge_h client_h;
+  ne_test_lb_server_s _ts;
+  ne_test_query_data_s _tq;
+  nns_edge_data_h data_h;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
+
+  memset (&_ts, 0, sizeof (_ts));
+  memset (&_tq, 0, sizeof (ne_test_query_data_s));
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (_ts.server_h, _test_lb_server_cb, &_ts);
+  nns_edge_set_info (_ts.server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (_ts.server_h, "PORT", val);
+  nns_edge_set_info (_ts.server_h, "CAPS", "test server");
+  SAFE_FREE (val);
+
+  _ts.mode = 4;
+  ret = nns_edge_start (_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Prepare client */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (client_h, _test_query_client_cb, &_tq);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  for (i = 0; i < 8U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_send (client_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    nns_edge_data_destroy (data_h);
+  }
+
+  /* Wait for the responses (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (__atomic_load_n (&_tq.events, __ATOMIC_SEQ_CST) >= 8U)
+      break;
+  } while (retry++ < 100U);
+
+  EXPECT_EQ (_tq.events, 8U);
+
+  /* The requests are not outstanding anymore. */
+  ret = nns_edge_get_info (client_h, "OUTSTANDING_REQUESTS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Query client waits for the response, query server responds new data without request ID.
+ */
+TEST(edge, connectQuerySyncNewResponse)
+{
+  nns_edge_h client_h;
+  ne_test_lb_server_s _ts;
+  ne_test_query_data_s _tq;
+  nns_edge_data_h request_h, response_h;
+  int64_t request_id, response_id;
+  unsigned int i;
+  int ret, port;
+  char *val;
+
+  memset (&_ts, 0, sizeof (_ts));
+  memset (&_tq, 0, sizeof (ne_test_query_data_s));
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (_ts.server_h, _test_lb_server_cb, &_ts);
+  nns_edge_set_info (_ts.server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (_ts.server_h, "PORT", val);
+  nns_edge_set_info (_ts.server_h, "CAPS", "test server");
+  SAFE_FREE (val);
+
+  _ts.mode = 4;
+  ret = nns_edge_start (_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Prepare client */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (client_h, _test_query_client_cb, &_tq);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  for (i = 0; i < 3U; i++) {
+    ret = nns_edge_data_create (&request_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    /* The response is returned before the timeout. */
+    response_h = NULL;
+    ret = nns_edge_query (client_h, request_h, &response_h, 3000U);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ASSERT_TRUE (response_h != NULL);
+
+    ret = nns_edge_data_get_info (response_h, "response", &val);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_STREQ (val, "new");
+    SAFE_FREE (val);
+
+    request_id = response_id = 0;
+    nns_edge_data_get_info_int64 (request_h, "request_id", &request_id);
+    nns_edge_data_get_info_int64 (response_h, "request_id", &response_id);
+    EXPECT_TRUE (request_id > 0);
+    EXPECT_EQ (request_id, response_id);
+
+    nns_edge_data_destroy (request_h);
+    nns_edge_data_destroy (response_h);
+  }
+
+  EXPECT_EQ (_ts.received, 3U);
+
+  /* The responses are not passed to the event callback. */
+  EXPECT_EQ (_tq.events, 0U);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Query server echoes the request having the deadline, the response does not have the deadline.
+ */
+TEST(edge, connectQueryEchoDeadline)
+{
+  nns_edge_h client_h;
+  ne_test_lb_server_s _ts;
+  ne_test_query_data_s _tq;
+  nns_edge_data_h request_h, response_h;
+  int64_t request_id, response_id, deadline;
+  unsigned int i;
+  int ret, port;
+  char *val;
+
+  memset (&_ts, 0, sizeof (_ts));
+  memset (&_tq, 0, sizeof (ne_test_query_data_s));
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port), respond the received request. */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (_ts.server_h, _test_lb_server_cb, &_ts);
+  nns_edge_set_info (_ts.server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (_ts.server_h, "PORT", val);
+  nns_edge_set_info (_ts.server_h, "CAPS", "test server");
+  SAFE_FREE (val);
+
+  ret = nns_edge_start (_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Prepare client, the request has the deadline. */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (client_h, _test_query_client_cb, &_tq);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "REQUEST_TIMEOUT", "3000");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  for (i = 0; i < 3U; i++) {
+    ret = nns_edge_data_create (&request_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_set_info_int64 (request_h, "index", (int64_t) i);
+
+    response_h = NULL;
+    ret = nns_edge_query (client_h, request_h, &response_h, 3000U);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ASSERT_TRUE (response_h != NULL);
+
+    request_id = response_id = 0;
+    nns_edge_data_get_info_int64 (request_h, "request_id", &request_id);
+    nns_edge_data_get_info_int64 (response_h, "request_id", &response_id);
+    EXPECT_TRUE (request_id > 0);
+    EXPECT_EQ (request_id, response_id);
+
+    /* The deadline in the clock of query server is not sent back. */
+    ret = nns_edge_data_get_info_int64 (response_h, "deadline", &deadline);
+    EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+    nns_edge_data_destroy (request_h);
+    nns_edge_data_destroy (response_h);
+  }
+
+  EXPECT_EQ (_ts.received, 3U);
+  EXPECT_EQ (_tq.events, 0U);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (_ts.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Query client sends the duplicated request to other server, if the response is delayed.
+ */
+TEST(edge, connectQueryHedged)
+{
+  nns_edge_h client_h;
+  ne_test_lb_server_s _ts[2];
+  ne_test_query_data_s _tq;
+  nns_edge_data_h data_h, response_h;
+  unsigned int i;
+  int64_t start, elapsed;
+  int ret, port[2];
+  char *val;
+
+  memset (_ts, 0, sizeof (_ts));
+  memset (&_tq, 0, sizeof (ne_test_query_data_s));
+
+  /* Prepare servers (127.0.0.1:port) */
+  for (i = 0; i < 2U; i++) {
+    port[i] = nns_edge_get_available_port ();
+    val = nns_edge_strdup_printf ("%d", port[i]);
+    ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_ts[i].server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_set_event_callback (_ts[i].server_h, _test_lb_server_cb, &_ts[i]);
+    nns_edge_set_info (_ts[i].server_h, "IP", "127.0.0.1");
+    nns_edge_set_info (_ts[i].server_h, "PORT", val);
+    nns_edge_set_info (_ts[i].server_h, "CAPS", "test server");
+    SAFE_FREE (val);
+
+    ret = nns_edge_start (_ts[i].server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Prepare client */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (client_h, _test_query_client_cb, &_tq);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  nns_edge_set_info (client_h, "LB_POLICY", "least-outstanding");
+  nns_edge_set_info (client_h, "HEDGE_PERCENTILE", "90");
+
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_connect (client_h, "127.0.0.1", port[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Get the latencies of the servers. */
+  for (i = 0; i < 16U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_query (client_h, data_h, &response_h, 2000U);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    if (ret == NNS_EDGE_ERROR_NONE)
+      nns_edge_data_destroy (response_h);
+
+    nns_edge_data_destroy (data_h);
+  }
+
+  /* The first server stalls, the response of the duplicate is received. */
+  _ts[0].mode = 3;
+  _ts[0].received = 0U;
+
+  for (i = 0; i < 4U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    start = nns_edge_get_monotonic_time ();
+    ret = nns_edge_query (client_h, data_h, &response_h, 2000U);
+    elapsed = nns_edge_get_monotonic_time () - start;
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_LT (elapsed, 200000);
+    if (ret == NNS_EDGE_ERROR_NONE)
+      nns_edge_data_destroy (response_h);
+
+    nns_edge_data_destroy (data_h);
+  }
+
+  EXPECT_GT (_ts[0].received, 0U);
+
+  /* The responses of the stalled server are dropped. */
+  usleep (1500000);
+  EXPECT_EQ (_tq.events, 0U);
+
+  ret = nns_edge_get_info (client_h, "OUTSTANDING_REQUESTS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_release_handle (_ts[i].server_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+}
+
+/**
+ * @brief Data struct to check the deadline of the requests.
+ */
+typedef struct
+{
+  nns_edge_h server_h;
+  unsigned int received; /**< the number of requests delivered to query server */
+  int64_t order[8]; /**< the index of the requests in delivered order */
+  unsigned int responses; /**< the number of responses received in query client */
+  unsigned int expired; /**< the number of expired requests in query client */
+} ne_test_deadline_data_s;
+
+/**
+ * @brief Edge event callback for test, query server responds the batch after 300 ms.
+ */
+static int
+_test_deadline_server_cb (nns_edge_event_h event_h, void *user_data)
+{
+  ne_test_deadline_data_s *_td = (ne_test_deadline_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h *batch;
+  unsigned int i, num;
+  int64_t index;
+  int ret;
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  if (event != NNS_EDGE_EVENT_NEW_BATCH_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
+
+  ret = nns_edge_event_parse_new_batch (event_h, &batch, &num);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  if (ret != NNS_EDGE_ERROR_NONE)
+    return ret;
+
+  usleep (300000);
+
+  for (i = 0; i < num; i++) {
+    index = -1;
+    nns_edge_data_get_info_int64 (batch[i], "index", &index);
+    if (_td->received < 8U)
+      _td->order[_td->received] = index;
+    __atomic_add_fetch (&_td->received, 1U, __ATOMIC_SEQ_CST);
+
+    ret = nns_edge_send (_td->server_h, batch[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_destroy (batch[i]);
+  }
+  SAFE_FREE (batch);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Edge event callback for test, count the responses and expired requests in query client.
+ */
+static int
+_test_deadline_client_cb (nns_edge_event_h event_h, void *user_data)
+{
+  ne_test_deadline_data_s *_td = (ne_test_deadline_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  int64_t request_id;
+  int ret;
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  if (event == NNS_EDGE_EVENT_NEW_DATA_RECEIVED) {
+    __atomic_add_fetch (&_td->responses, 1U, __ATOMIC_SEQ_CST);
+  } else if (event == NNS_EDGE_EVENT_REQUEST_EXPIRED) {
+    ret = nns_edge_event_parse_new_data (event_h, &data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    if (ret != NNS_EDGE_ERROR_NONE)
+      return ret;
+
+    ret = nns_edge_data_get_info_int64 (data_h, "request_id", &request_id);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_GT (request_id, 0);
+    nns_edge_data_destroy (data_h);
+
+    __atomic_add_fetch (&_td->expired, 1U, __ATOMIC_SEQ_CST);
+  }
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Query server delivers the request with earliest deadline first, and drops the expired request.
+ */
+TEST(edge, connectQueryDeadline)
+{
+  nns_edge_h client_h;
+  ne_test_deadline_data_s _td;
+  nns_edge_data_h data_h, response_h;
+  const char *timeouts[6] = { "0", "0", "2000", "0", "1000", "100" };
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
+
+  memset (&_td, 0, sizeof (ne_test_deadline_data_s));
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &_td.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (_td.server_h, _test_deadline_server_cb, &_td);
+  nns_edge_set_info (_td.server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (_td.server_h, "PORT", val);
+  nns_edge_set_info (_td.server_h, "CAPS", "test server");
+  nns_edge_set_info (_td.server_h, "BATCH_SIZE", "2");
+  nns_edge_set_info (_td.server_h, "BATCH_TIMEOUT", "1");
+  SAFE_FREE (val);
+
+  ret = nns_edge_start (_td.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Prepare client */
+  ret = nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (client_h, _test_deadline_client_cb, &_td);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  /**
+   * The first request is delivered, and the others are pending while the server handles it.
+   * The requests having the deadline are delivered first, and the last one is expired.
+   */
+  for (i = 0; i < 6U; i++) {
+    ret = nns_edge_set_info (client_h, "REQUEST_TIMEOUT", timeouts[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_set_info_int64 (data_h, "index", (int64_t) i);
+
+    ret = nns_edge_send (client_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    nns_edge_data_destroy (data_h);
+
+    if (i == 0U)
+      usleep (50000);
+  }
+
+  /* The timeout of the query is sent as the deadline, it is expired in the server. */
+  ret = nns_edge_set_info (client_h, "REQUEST_TIMEOUT", "0");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_data_set_info_int64 (data_h, "index", 6);
+
+  ret = nns_edge_query (client_h, data_h, &response_h, 100U);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_TIMEOUT);
+
+  nns_edge_data_destroy (data_h);
+
+  /* Wait for the responses (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (__atomic_load_n (&_td.responses, __ATOMIC_SEQ_CST) >= 5U &&
+        __atomic_load_n (&_td.expired, __ATOMIC_SEQ_CST) >= 1U)
+      break;
+  } while (retry++ < 100U);
+
+  EXPECT_EQ (_td.responses, 5U);
+  EXPECT_EQ (_td.expired, 1U);
+  EXPECT_EQ (_td.received, 5U);
+  EXPECT_EQ (_td.order[0], 0);
+  EXPECT_EQ (_td.order[1], 4);
+  EXPECT_EQ (_td.order[2], 2);
+  EXPECT_EQ (_td.order[3], 1);
+  EXPECT_EQ (_td.order[4], 3);
+
+  ret = nns_edge_get_info (client_h, "OUTSTANDING_REQUESTS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "0");
+  SAFE_FREE (val);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (_td.server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect to local host, the peer stalled in handshake should not block other client.
+ */
+TEST(edge, connectStalledPeer)
+{
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, retry;
+  int ret, port, stalled_fd;
+  struct sockaddr_in saddr = { 0 };
+  struct timeval start, end;
+  char *val, *client_id;
+
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  nns_edge_set_info (server_h, "HANDSHAKE_TIMEOUT", "10000");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  /* Prepare client */
+  nns_edge_create_handle ("temp-client", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  /* Connect raw socket and do not send host info. */
+  stalled_fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  ASSERT_TRUE (stalled_fd >= 0);
+  saddr.sin_family = AF_INET;
+  saddr.sin_port = htons (port);
+  saddr.sin_addr.s_addr = inet_addr ("127.0.0.1");
+  ret = connect (stalled_fd, (struct sockaddr *) &saddr, sizeof (saddr));
+  EXPECT_EQ (ret, 0);
+
+  gettimeofday (&start, NULL);
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  gettimeofday (&end, NULL);
+
+  /* Handshake timeout of stalled peer is 10 seconds. */
+  EXPECT_LT (end.tv_sec - start.tv_sec, 3);
+
+  usleep (200000);
+
+  /* Send request to server */
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  client_id = NULL;
+  ret = nns_edge_get_info (client_h, "client_id", &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "client_id", client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_send (client_h, data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for responding data (3 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_client->received > 0)
+      break;
+  } while (retry++ < 30U);
+
+  EXPECT_TRUE (_td_server->received > 0);
+  EXPECT_TRUE (_td_client->received > 0);
+
+  close (stalled_fd);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (client_id);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
+}
+
+/**
+ * @brief Connect to local host, the peer sending the handshake slowly is closed after handshake timeout.
+ */
+TEST(edge, connectSlowPeer)
+{
+  nns_edge_h server_h;
+  unsigned int i;
+  int ret, port, slow_fd;
+  struct sockaddr_in saddr = { 0 };
+  struct timeval start, end;
+  char *val, byte = 0;
+
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, NULL);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  nns_edge_set_info (server_h, "HANDSHAKE_TIMEOUT", "500");
+  SAFE_FREE (val);
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  slow_fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  ASSERT_TRUE (slow_fd >= 0);
+  saddr.sin_family = AF_INET;
+  saddr.sin_port = htons (port);
+  saddr.sin_addr.s_addr = inet_addr ("127.0.0.1");
+  ret = connect (slow_fd, (struct sockaddr *) &saddr, sizeof (saddr));
+  EXPECT_EQ (ret, 0);
+
+  /* Send host info one byte at a time, each byte is sent within handshake timeout. */
+  gettimeofday (&start, NULL);
+  for (i = 0; i < 50U; i++) {
+    usleep (100000);
+    if (send (slow_fd, &byte, 1, MSG_NOSIGNAL) < 0)
+      break;
+  }
+  gettimeofday (&end, NULL);
+
+  /* Server closes the socket after handshake timeout (500 milliseconds). */
+  EXPECT_LT (i, 50U);
+  EXPECT_LT (end.tv_sec - start.tv_sec, 3);
+
+  close (slow_fd);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect to local host, server opens multiple listeners on the same port.
+ */
+TEST(edge, connectMultiListeners)
+{
+  nns_edge_h server_h, client_h[3];
+  ne_test_data_s *_td_server, *_td_client[3];
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, n, retry;
+  int ret, port;
+  char *val, *client_id;
+
+  _td_server = _get_test_data (true);
+  ASSERT_TRUE (_td_server != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "BACKLOG", "128");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (server_h, "LISTENERS", "3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  ret = nns_edge_get_info (server_h, "BACKLOG", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "128");
+  SAFE_FREE (val);
+
+  ret = nns_edge_get_info (server_h, "LISTENERS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "3");
+  SAFE_FREE (val);
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Prepare clients */
+  for (n = 0; n < 3U; n++) {
+    _td_client[n] = _get_test_data (false);
+    ASSERT_TRUE (_td_client[n] != NULL);
+
+    nns_edge_create_handle (NULL, NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h[n]);
+    nns_edge_set_event_callback (client_h[n], _test_edge_event_cb, _td_client[n]);
+    nns_edge_set_info (client_h[n], "CAPS", "test client");
+    _td_client[n]->handle = client_h[n];
+
+    ret = nns_edge_start (client_h[n]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  usleep (200000);
+
+  for (n = 0; n < 3U; n++) {
+    ret = nns_edge_connect (client_h[n], "127.0.0.1", port);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  usleep (500000);
+
+  /* Send request to server */
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (n = 0; n < 3U; n++) {
+    client_id = NULL;
+    ret = nns_edge_get_info (client_h[n], "client_id", &client_id);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_set_info (data_h, "client_id", client_id);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    SAFE_FREE (client_id);
+
+    ret = nns_edge_send (client_h[n], data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_client[0]->received > 0 && _td_client[1]->received > 0 &&
+        _td_client[2]->received > 0)
+      break;
+  } while (retry++ < 50U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_server->received, 3U);
+  _free_test_data (_td_server);
+
+  for (n = 0; n < 3U; n++) {
+    ret = nns_edge_release_handle (client_h[n]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_TRUE (_td_client[n]->received > 0);
+    _free_test_data (_td_client[n]);
+  }
+}
+
+/**
+ * @brief Query client opens single listener, the number of listeners set by the application is kept.
+ */
+TEST(edge, connectMultiListenersClient)
+{
+  nns_edge_h client_h;
+  int ret;
+  char *val;
+
+  nns_edge_create_handle (NULL, NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, NULL);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "LISTENERS", "3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (client_h, "LISTENERS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "3");
+  SAFE_FREE (val);
+
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Reconnect to the server, client skips the capability check.
+ */
+TEST(edge, connectFastReconnect)
+{
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, retry;
+  int ret, port;
+  char *val, *client_id;
+
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_info (server_h, "FAST_RECONNECT", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  /* Prepare client */
+  nns_edge_create_handle (NULL, NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_info (client_h, "FAST_RECONNECT", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
+
+  ret = nns_edge_get_info (client_h, "FAST_RECONNECT", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "true");
+  SAFE_FREE (val);
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot update the option after starting the handle. */
+  ret = nns_edge_set_info (client_h, "FAST_RECONNECT", "false");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->capability, 1U);
+
+  ret = nns_edge_disconnect (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  /* The capability is not changed, server resumes the handshake and client does not check it again. */
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->capability, 1U);
+
+  usleep (200000);
+
+  /* Send request to server */
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  client_id = NULL;
+  ret = nns_edge_get_info (client_h, "client_id", &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "client_id", client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (client_id);
+
+  ret = nns_edge_send (client_h, data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_client->received > 0)
+      break;
+  } while (retry++ < 50U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_server->received, 1U);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->received, 1U);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
+}
+
+/**
+ * @brief Reconnect to the server which does not enable fast reconnect, client checks the capability again.
+ */
+TEST(edge, connectFastReconnectServerDisabled)
+{
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  int ret, port;
+  char *val;
+
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  /* Prepare client */
+  nns_edge_create_handle (NULL, NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  nns_edge_set_info (client_h, "FAST_RECONNECT", "true");
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->capability, 1U);
+
+  ret = nns_edge_disconnect (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  /* Server sends the capability string, client checks it again. */
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->capability, 2U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
+}
+
+/**
+ * @brief Publish data to local subscriber, the metadata is updated in each data.
+ */
+TEST(edge, connectPubSubMeta)
+{
+  nns_edge_h pub_h, sub_h;
+  ne_test_meta_data_s _tm = { 0U, 0U };
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, retry;
+  int ret, port;
+  char *val;
+
+  port = nns_edge_get_available_port ();
+
+  /* Prepare publisher (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  nns_edge_set_info (pub_h, "CAPS", "test pub");
+  SAFE_FREE (val);
+
+  /* Prepare subscriber */
+  ret = nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (sub_h, _test_meta_event_cb, &_tm);
+  nns_edge_set_info (sub_h, "CAPS", "test sub");
+
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for the publisher to register the subscriber. */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (nns_edge_is_connected (pub_h) != NNS_EDGE_ERROR_NONE &&
+      retry++ < 50U);
+
+  data_len = 10U * sizeof (unsigned int);
+
+  for (i = 0; i < 4U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    data = malloc (data_len);
+    ASSERT_TRUE (data != NULL);
+    ret = nns_edge_data_add (data_h, data, data_len, free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_set_info_int64 (data_h, "index", i);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_set_info (data_h, "test-key1",
+        (i < 2U) ? "test-value1" : "test-value1-changed");
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    if (i % 2U == 0U) {
+      ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    }
+
+    ret = nns_edge_send (pub_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Wait for received data (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_tm.received >= 4U)
+      break;
+  } while (retry++ < 100U);
+
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (_tm.received, 4U);
+  EXPECT_EQ (_tm.matched, 4U);
+}
+
+/**
+ * @brief Data struct to check the data decoded in subscriber.
+ */
+typedef struct
+{
+  unsigned int received;
+  unsigned int matched;
+} ne_test_codec_data_s;
+
+/**
+ * @brief Fill the memory with compressible data for test.
+ */
+static void
+_test_codec_fill (uint8_t *data, nns_size_t size, unsigned int seed)
+{
+  nns_size_t i;
+
+  for (i = 0; i < size; i++)
+    data[i] = (uint8_t) ((i / 64U) % 7U + seed);
+}
+
+/**
+ * @brief Edge event callback for test, check the data decoded in subscriber.
+ */
+static int
+_test_codec_event_cb (nns_edge_event_h event_h, void *user_data)
+{
+  ne_test_codec_data_s *_tc = (ne_test_codec_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  uint8_t *expected;
+  void *data;
+  nns_size_t data_len;
+  unsigned int i, count;
+  bool matched;
+  int ret;
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
+
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  matched = (ret == NNS_EDGE_ERROR_NONE && count == 3U);
+
+  /* 1st and 3rd memories are encoded, 2nd one is smaller than the threshold. */
+  for (i = 0; i < count && matched; i++) {
+    ret = nns_edge_data_get (data_h, i, &data, &data_len);
+    matched = (ret == NNS_EDGE_ERROR_NONE &&
+        data_len == ((i == 1U) ? 100U : 65536U));
+
+    if (matched) {
+      expected = (uint8_t *) malloc (data_len);
+      if (expected) {
+        _test_codec_fill (expected, data_len, i);
+        matched = (memcmp (data, expected, data_len) == 0);
+        free (expected);
+      }
+    }
+  }
+
+  if (matched)
+    _tc->matched++;
+  _tc->received++;
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Publish the data encoded with built-in codec to local subscriber.
+ */
+static void
+_test_pub_sub_codec (const char *filter)
+{
+  nns_edge_h pub_h, sub_h;
+  ne_test_codec_data_s _tc = { 0U, 0U };
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, j, retry;
+  unsigned long long sent_raw, sent_encoded, received_raw, received_encoded;
+  int ret, port;
+  char *val;
+
+  port = nns_edge_get_available_port ();
+
+  /* Prepare publisher (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  nns_edge_set_info (pub_h, "CAPS", "test pub");
+  ret = nns_edge_set_info (pub_h, "CODEC", "lz");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (pub_h, "CODEC_FILTER", filter);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (val);
+
+  /* Prepare subscriber */
+  ret = nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (sub_h, _test_codec_event_cb, &_tc);
+  nns_edge_set_info (sub_h, "CAPS", "test sub");
+
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot update the codec after starting the handle. */
+  ret = nns_edge_set_info (pub_h, "CODEC", "none");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for the publisher to register the subscriber. */
+  retry = 0U;
+  do {
+    usleep (100000);
+  } while (nns_edge_is_connected (pub_h) != NNS_EDGE_ERROR_NONE &&
+      retry++ < 50U);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    for (j = 0; j < 3U; j++) {
+      data_len = (j == 1U) ? 100U : 65536U;
+      data = malloc (data_len);
+      ASSERT_TRUE (data != NULL);
+      _test_codec_fill ((uint8_t *) data, data_len, j);
+
+      ret = nns_edge_data_add (data_h, data, data_len, free);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    }
+
+    /* The element size of 2nd data is different from the default. */
+    if (i == 1U) {
+      ret = nns_edge_data_set_info_int64 (data_h, "element_size", 2);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    }
+
+    ret = nns_edge_send (pub_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Wait for received data (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_tc.received >= 2U)
+      break;
+  } while (retry++ < 100U);
+
+  EXPECT_EQ (_tc.received, 2U);
+  EXPECT_EQ (_tc.matched, 2U);
+
+  /* Compare the byte size of raw and encoded data. */
+  ret = nns_edge_get_info (pub_h, "CODEC_STATS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (sscanf (val, "sent_raw=%llu,sent_encoded=%llu", &sent_raw,
+          &sent_encoded), 2);
+  SAFE_FREE (val);
+
+  ret = nns_edge_get_info (sub_h, "CODEC_STATS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (sscanf (val, "sent_raw=%*u,sent_encoded=%*u,"
+          "received_raw=%llu,received_encoded=%llu", &received_raw,
+          &received_encoded), 2);
+  SAFE_FREE (val);
+
+  EXPECT_EQ (sent_raw, 2ULL * (65536U * 2U + 100U));
+  EXPECT_LT (sent_encoded, sent_raw);
+  EXPECT_EQ (received_raw, sent_raw);
+  EXPECT_EQ (received_encoded, sent_encoded);
+
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Publish the data encoded with built-in codec to local subscriber.
+ */
+TEST(edge, connectPubSubCodec)
+{
+  _test_pub_sub_codec ("none");
+}
+
+/**
+ * @brief Publish the data shuffled and encoded with built-in codec to local subscriber.
+ */
+TEST(edge, connectPubSubCodecShuffle)
+{
+  _test_pub_sub_codec ("shuffle");
+}
+
+/**
+ * @brief Data struct to check the data with reduced precision in subscriber.
+ */
+typedef struct
+{
+  bool restore;
+  unsigned int received;
+  unsigned int matched;
+} ne_test_precision_data_s;
+
+/**
+ * @brief Edge event callback for test, check the data with reduced precision in subscriber.
+ */
+static int
+_test_precision_event_cb (nns_edge_event_h event_h, void *user_data)
+{
+  ne_test_precision_data_s *_tp = (ne_test_precision_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  unsigned int i, count;
+  int64_t mask;
+  char *val = NULL;
+  bool matched, marked;
+  int ret;
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
+
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  matched = (ret == NNS_EDGE_ERROR_NONE && count == 2U);
+
+  /* 1st memory has float32 values, 2nd memory is not converted. */
+  ret = nns_edge_data_get (data_h, 0, &data, &data_len);
+  matched = matched && (ret == NNS_EDGE_ERROR_NONE);
+
+  marked = (nns_edge_data_get_info_int64 (data_h, "float32_mask", &mask) ==
+      NNS_EDGE_ERROR_NONE);
+
+  if (matched && (_tp->restore || !marked)) {
+    /* The float32 values are restored, or the memory not marked is sent as it is. */
+    matched = (data_len == 1024U * sizeof (float));
+    for (i = 0; i < 1024U && matched; i++)
+      matched = (((float *) data)[i] == (float) i * 0.5f);
+
+    if (!marked) {
+      matched = matched && (nns_edge_data_get_info (data_h, "wire_precision",
+              &val) != NNS_EDGE_ERROR_NONE);
+    }
+  } else if (matched) {
+    /* 0.5 in float16 */
+    matched = (data_len == 1024U * sizeof (uint16_t) &&
+        ((uint16_t *) data)[0] == 0U && ((uint16_t *) data)[1] == 0x3800U);
+
+    ret = nns_edge_data_get_info (data_h, "wire_precision", &val);
+    matched = matched && (ret == NNS_EDGE_ERROR_NONE) &&
+        (strcmp (val, "fp16") == 0);
+    SAFE_FREE (val);
+  }
+
+  ret = nns_edge_data_get (data_h, 1, &data, &data_len);
+  matched = matched && (ret == NNS_EDGE_ERROR_NONE) && (data_len == 4096U);
+  for (i = 0; i < 4096U && matched; i++)
+    matched = (((uint8_t *) data)[i] == (uint8_t) i);
+
+  if (matched)
+    _tp->matched++;
+  _tp->received++;
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Publish float32 data in half precision and encoded with built-in codec to local subscribers.
+ */
+TEST(edge, connectPubSubPrecision)
+{
+  nns_edge_h pub_h, sub_h[2];
+  ne_test_precision_data_s _tp[2] = { { true, 0U, 0U }, { false, 0U, 0U } };
+  nns_edge_data_h data_h;
+  float *values;
+  uint8_t *bytes;
+  unsigned int i, n, retry;
+  unsigned long long sent_raw, sent_encoded;
+  int ret, port;
+  char *val;
+
+  port = nns_edge_get_available_port ();
+
+  /* Prepare publisher (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  nns_edge_set_info (pub_h, "CAPS", "test pub");
+  ret = nns_edge_set_info (pub_h, "WIRE_PRECISION", "fp16");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (pub_h, "CODEC", "lz");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (pub_h, "CODEC_FILTER", "shuffle");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (val);
+
+  /* Prepare subscribers, 2nd one does not restore the precision. */
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+        NNS_EDGE_NODE_TYPE_SUB, &sub_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_set_event_callback (sub_h[i], _test_precision_event_cb, &_tp[i]);
+    nns_edge_set_info (sub_h[i], "CAPS", "test sub");
+    ret = nns_edge_set_info (sub_h[i], "RESTORE_PRECISION",
+        _tp[i].restore ? "true" : "false");
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_start (sub_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_connect (sub_h[i], "127.0.0.1", port);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Wait for the publisher to register the subscribers. */
+  usleep (500000);
+
+  /* 1st data marks the float32 memory, 2nd data has the memories not marked. */
+  for (n = 0; n < 2U; n++) {
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    values = (float *) malloc (1024U * sizeof (float));
+    bytes = (uint8_t *) malloc (4096U);
+    ASSERT_TRUE (values != NULL && bytes != NULL);
+
+    for (i = 0; i < 1024U; i++)
+      values[i] = (float) i * 0.5f;
+    for (i = 0; i < 4096U; i++)
+      bytes[i] = (uint8_t) i;
+
+    ret = nns_edge_data_add (data_h, values, 1024U * sizeof (float), free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_add (data_h, bytes, 4096U, free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    /* Only 1st memory has float32 values. */
+    if (n == 0U) {
+      ret = nns_edge_data_set_info_int64 (data_h, "float32_mask", 0x1);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    }
+
+    ret = nns_edge_send (pub_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    /* Wait for received data (10 seconds) */
+    retry = 0U;
+    do {
+      usleep (100000);
+      if (_tp[0].received > n && _tp[1].received > n)
+        break;
+    } while (retry++ < 100U);
+
+    if (n == 0U) {
+      /* The float32 values are sent in half size, and then compressed. */
+      ret = nns_edge_get_info (pub_h, "CODEC_STATS", &val);
+      EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      EXPECT_EQ (sscanf (val, "sent_raw=%llu,sent_encoded=%llu", &sent_raw,
+              &sent_encoded), 2);
+      SAFE_FREE (val);
+
+      EXPECT_EQ (sent_raw, 2ULL * 8192U);
+      EXPECT_LT (sent_encoded, 2ULL * (2048U + 4096U));
+    }
+  }
+
+  for (i = 0; i < 2U; i++) {
+    EXPECT_EQ (_tp[i].received, 2U);
+    EXPECT_EQ (_tp[i].matched, 2U);
+  }
+
+  for (i = 0; i < 2U; i++) {
+    ret = nns_edge_release_handle (sub_h[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Fill the frame for delta test, a few bytes are changed in each frame.
+ */
+static void
+_test_delta_fill_frame (uint8_t *frame, unsigned int index)
+{
+  unsigned int i, k, seed = 0x1234U;
+
+  /* Random bytes, it cannot be compressed without the delta. */
+  for (i = 0; i < 65536U; i++) {
+    seed = seed * 1103515245U + 12345U;
+    frame[i] = (uint8_t) (seed >> 16);
+  }
+
+  for (k = 1; k <= index; k++) {
+    for (i = 0; i < 64U; i++)
+      frame[k * 1000U + i] = (uint8_t) k;
+  }
+}
+
+/**
+ * @brief Data struct to check the frames received with the delta.
+ */
+typedef struct
+{
+  unsigned int received;
+  unsigned int matched;
+} ne_test_delta_data_s;
+
+/**
+ * @brief Edge event callback for test, check the frames received with the delta.
+ */
+static int
+_test_delta_event_cb (nns_edge_event_h event_h, void *user_data)
+{
+  ne_test_delta_data_s *_td = (ne_test_delta_data_s *) user_data;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  uint8_t *expected;
+  int ret;
+
+  ret = nns_edge_event_get_type (event_h, &event);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  if (event != NNS_EDGE_EVENT_NEW_DATA_RECEIVED)
+    return NNS_EDGE_ERROR_NONE;
+
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  expected = (uint8_t *) malloc (65536U);
+  if (expected) {
+    _test_delta_fill_frame (expected, _td->received);
+
+    ret = nns_edge_data_get (data_h, 0, &data, &data_len);
+    if (ret == NNS_EDGE_ERROR_NONE && data_len == 65536U &&
+        memcmp (data, expected, 65536U) == 0)
+      _td->matched++;
+
+    free (expected);
+  }
+
+  _td->received++;
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Publish the delta of successive frames to local subscriber.
+ */
+TEST(edge, connectPubSubDelta)
+{
+  nns_edge_h pub_h, sub_h;
+  ne_test_delta_data_s _td = { 0U, 0U };
+  nns_edge_data_h data_h;
+  uint8_t *frame;
+  unsigned int i, retry;
+  unsigned long long sent_raw, sent_encoded;
+  int ret, port;
+  char *val;
+
+  port = nns_edge_get_available_port ();
+
+  /* Prepare publisher (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  ret = nns_edge_create_handle ("temp-pub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_PUB, &pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_info (pub_h, "IP", "127.0.0.1");
+  nns_edge_set_info (pub_h, "PORT", val);
+  nns_edge_set_info (pub_h, "CAPS", "test pub");
+  ret = nns_edge_set_info (pub_h, "CODEC", "lz");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (pub_h, "DELTA", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (pub_h, "DELTA_KEYFRAME", "3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (val);
+
+  /* Prepare subscriber */
+  ret = nns_edge_create_handle ("temp-sub", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_SUB, &sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_set_event_callback (sub_h, _test_delta_event_cb, &_td);
+  nns_edge_set_info (sub_h, "CAPS", "test sub");
+
+  ret = nns_edge_start (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_start (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (sub_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for the publisher to register the subscriber. */
+  usleep (500000);
+
+  /* Send 6 frames, 1st and 4th frames are keyframes. */
+  for (i = 0; i < 6U; i++) {
+    frame = (uint8_t *) malloc (65536U);
+    ASSERT_TRUE (frame != NULL);
+    _test_delta_fill_frame (frame, i);
+
+    ret = nns_edge_data_create (&data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_add (data_h, frame, 65536U, free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_send (pub_h, data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    ret = nns_edge_data_destroy (data_h);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  /* Wait for received data (10 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td.received >= 6U)
+      break;
+  } while (retry++ < 100U);
+
+  EXPECT_EQ (_td.received, 6U);
+  EXPECT_EQ (_td.matched, 6U);
+
+  /* The keyframes cannot be compressed, other frames are the delta. */
+  ret = nns_edge_get_info (pub_h, "CODEC_STATS", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (sscanf (val, "sent_raw=%llu,sent_encoded=%llu", &sent_raw,
+          &sent_encoded), 2);
+  SAFE_FREE (val);
+
+  EXPECT_EQ (sent_raw, 6ULL * 65536U);
+  EXPECT_LT (sent_encoded, 3ULL * 65536U);
+
+  ret = nns_edge_release_handle (sub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (pub_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Receive data with the allocator of edge handle.
+ */
+TEST(edge, setAllocator)
+{
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  ne_test_allocator_s ta_server = { 0U, 0U }, ta_client = { 0U, 0U };
+  nns_edge_allocator_s allocator;
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, retry;
+  int ret, port;
+  char *val, *client_id;
+
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+
+  allocator.alloc = _test_alloc;
+  allocator.aligned_alloc = _test_aligned_alloc;
+  allocator.free = _test_free;
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  allocator.user_data = &ta_server;
+  ret = nns_edge_set_allocator (server_h, &allocator);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  /* Prepare client */
+  nns_edge_create_handle (NULL, NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  allocator.user_data = &ta_client;
+  ret = nns_edge_set_allocator (client_h, &allocator);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot change the allocator after starting the handle. */
+  ret = nns_edge_set_allocator (client_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  /* Send request to server */
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  client_id = NULL;
+  ret = nns_edge_get_info (client_h, "client_id", &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "client_id", client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (client_id);
+
+  ret = nns_edge_send (client_h, data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_client->received > 0)
+      break;
+  } while (retry++ < 50U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_server->received, 1U);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->received, 1U);
+
+  /* The handles, metadata and buffers of received data are allocated with the allocator, and all released. */
+  EXPECT_TRUE (ta_server.allocated > 0U);
+  EXPECT_EQ (ta_server.allocated, ta_server.released);
+  EXPECT_TRUE (ta_client.allocated > 0U);
+  EXPECT_EQ (ta_client.allocated, ta_client.released);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
+}
+
+/**
+ * @brief Set allocator - invalid param.
+ */
+TEST(edge, setAllocatorInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_set_allocator (NULL, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set allocator - invalid param.
+ */
+TEST(edge, setAllocatorInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  nns_edge_allocator_s allocator;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* All callbacks are mandatory. */
+  allocator.alloc = _test_alloc;
+  allocator.aligned_alloc = NULL;
+  allocator.free = _test_free;
+  allocator.user_data = NULL;
+
+  ret = nns_edge_set_allocator (edge_h, &allocator);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Receive data into the memory allocated with the callback.
+ */
+TEST(edge, setAllocCallback)
+{
+  nns_edge_h server_h, client_h;
+  ne_test_data_s *_td_server, *_td_client;
+  ne_test_allocator_s ta_server = { 0U, 0U }, ta_client = { 0U, 0U };
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
+  void *data;
+  unsigned int i, retry;
+  int ret, port;
+  char *val, *client_id;
+
+  _td_server = _get_test_data (true);
+  _td_client = _get_test_data (false);
+  ASSERT_TRUE (_td_server != NULL && _td_client != NULL);
+  port = nns_edge_get_available_port ();
+  g_test_released = 0U;
+
+  /* Prepare server (127.0.0.1:port) */
+  val = nns_edge_strdup_printf ("%d", port);
+  nns_edge_create_handle ("temp-server", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &server_h);
+  nns_edge_set_event_callback (server_h, _test_edge_event_cb, _td_server);
+  nns_edge_set_info (server_h, "IP", "127.0.0.1");
+  nns_edge_set_info (server_h, "PORT", val);
+  nns_edge_set_info (server_h, "CAPS", "test server");
+  ret = nns_edge_set_alloc_callback (server_h, _test_alloc_cb, &ta_server);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_server->handle = server_h;
+  SAFE_FREE (val);
+
+  /* Prepare client */
+  nns_edge_create_handle (NULL, NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &client_h);
+  nns_edge_set_event_callback (client_h, _test_edge_event_cb, _td_client);
+  nns_edge_set_info (client_h, "CAPS", "test client");
+  ret = nns_edge_set_alloc_callback (client_h, _test_alloc_cb, &ta_client);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  _td_client->handle = client_h;
+
+  ret = nns_edge_start (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_start (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot change the callback after starting the handle. */
+  ret = nns_edge_set_alloc_callback (client_h, NULL, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  ret = nns_edge_connect (client_h, "127.0.0.1", port);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  usleep (200000);
+
+  /* Send request to server */
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key1", "test-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "test-key2", "test-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  client_id = NULL;
+  ret = nns_edge_get_info (client_h, "client_id", &client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "client_id", client_id);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (client_id);
+
+  ret = nns_edge_send (client_h, data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Wait for responding data (5 seconds) */
+  retry = 0U;
+  do {
+    usleep (100000);
+    if (_td_client->received > 0)
+      break;
+  } while (retry++ < 50U);
+
+  ret = nns_edge_release_handle (server_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_server->received, 1U);
+  ret = nns_edge_release_handle (client_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (_td_client->received, 1U);
+
+  /* Received data is in the memory from the callback, and released with given destroy callback. */
+  EXPECT_EQ (ta_server.allocated, 1U);
+  EXPECT_EQ (ta_client.allocated, 1U);
+  EXPECT_EQ (g_test_released, 2U);
+
+  _free_test_data (_td_server);
+  _free_test_data (_td_client);
+}
+
+/**
+ * @brief Set alloc callback - invalid param.
+ */
+TEST(edge, setAllocCallbackInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_set_alloc_callback (NULL, _test_alloc_cb, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set alloc callback - invalid param.
+ */
+TEST(edge, setAllocCallbackInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_set_alloc_callback (edge_h, _test_alloc_cb, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create edge handle - invalid param.
+ */
+TEST(edge, createHandleInvalidParam01_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_UNKNOWN,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create edge handle - invalid param.
+ */
+TEST(edge, createHandleInvalidParam02_n)
+{
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create edge handle - invalid param.
+ */
+TEST(edge, createHandleInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_HYBRID,
+      NNS_EDGE_NODE_TYPE_UNKNOWN, &edge_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Start - invalid param.
+ */
+TEST(edge, startInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_start (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Start - invalid param.
+ */
+TEST(edge, startInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_start (edge_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Release edge handle - invalid param.
+ */
+TEST(edge, releaseHandleInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_release_handle (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Release edge handle - invalid param.
+ */
+TEST(edge, releaseHandleInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set event callback - null param to clear event callback.
+ */
+TEST(edge, setEventCbSetNullCallback)
+{
+  nns_edge_h edge_h;
+  ne_test_data_s *_td;
+  int ret;
+
+  _td = _get_test_data (false);
+  ASSERT_TRUE (_td != NULL);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Set null param to clear event callback. */
+  ret = nns_edge_set_event_callback (edge_h, NULL, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  EXPECT_TRUE (_td->event_cb_released);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td);
+}
+
+/**
+ * @brief Set event callback - invalid param.
+ */
+TEST(edge, setEventCbInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_set_event_callback (NULL, _test_edge_event_cb, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set event callback - invalid param.
+ */
+TEST(edge, setEventCbInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  ne_test_data_s *_td;
+  int ret;
+
+  _td = _get_test_data (false);
+  ASSERT_TRUE (_td != NULL);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, _td);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  _free_test_data (_td);
+}
+
+/**
+ * @brief Connect - invalid param.
+ */
+TEST(edge, connectInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_connect (NULL, "127.0.0.1", 80);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect - invalid param.
+ */
+TEST(edge, connectInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect - invalid param.
+ */
+TEST(edge, connectInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_connect (edge_h, NULL, 80);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect - invalid param.
+ */
+TEST(edge, connectInvalidParam04_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_connect (edge_h, "", 80);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect - invalid param.
+ */
+TEST(edge, connectInvalidParam05_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid port number */
+  ret = nns_edge_connect (edge_h, "127.0.0.1", -1);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 0);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 77777);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect - invalid param.
+ */
+TEST(edge, connectInvalidParam06_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* not started */
+  ret = nns_edge_connect (edge_h, "127.0.0.1", 80);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Connect to the node which does not respond, connection should be failed within timeout.
+ */
+TEST(edge, connectTimeout_n)
+{
+  nns_edge_h edge_h;
+  struct sockaddr_in saddr = { 0 };
+  socklen_t saddr_len = sizeof (saddr);
+  struct timeval start, end;
+  int ret, port, listen_fd;
+
+  /* Listener socket which never sends capability. */
+  listen_fd = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  ASSERT_TRUE (listen_fd >= 0);
+  saddr.sin_family = AF_INET;
+  saddr.sin_port = 0;
+  saddr.sin_addr.s_addr = inet_addr ("127.0.0.1");
+  ret = bind (listen_fd, (struct sockaddr *) &saddr, saddr_len);
+  EXPECT_EQ (ret, 0);
+  ret = listen (listen_fd, 1);
+  EXPECT_EQ (ret, 0);
+  ret = getsockname (listen_fd, (struct sockaddr *) &saddr, &saddr_len);
+  EXPECT_EQ (ret, 0);
+  port = ntohs (saddr.sin_port);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_event_callback (edge_h, _test_edge_event_cb, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CONNECT_TIMEOUT", "500");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_start (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  gettimeofday (&start, NULL);
+  ret = nns_edge_connect (edge_h, "127.0.0.1", port);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  gettimeofday (&end, NULL);
+
+  EXPECT_LT (end.tv_sec - start.tv_sec, 3);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  close (listen_fd);
+}
+
+/**
+ * @brief Disconnect - invalid param.
+ */
+TEST(edge, disconnectInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_disconnect (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Disconnect - invalid param.
+ */
+TEST(edge, disconnectInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_disconnect (edge_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Send - invalid param.
+ */
+TEST(edge, sendInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "client_id", "10");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_send (NULL, data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Send - invalid param.
+ */
+TEST(edge, sendInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "client_id", "10");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_send (edge_h, data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Send - invalid param.
+ */
+TEST(edge, sendInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_send (edge_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Query - invalid param.
+ */
+TEST(edge, queryInvalidParam01_n)
+{
+  nns_edge_data_h data_h, response_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_query (NULL, data_h, &response_h, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Query - invalid param.
+ */
+TEST(edge, queryInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  nns_edge_data_h data_h, response_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_query (edge_h, NULL, &response_h, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_query (edge_h, data_h, NULL, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Not connected. */
+  ret = nns_edge_query (edge_h, data_h, &response_h, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Query - invalid param.
+ */
+TEST(edge, queryInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  nns_edge_data_h data_h, response_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Only query client can send the query. */
+  ret = nns_edge_query (edge_h, data_h, &response_h, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_set_info (NULL, "caps", "temp-caps");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_set_info (edge_h, "caps", "temp-caps");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, NULL, "temp-caps");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam04_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "", "temp-caps");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam05_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "caps", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam06_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "caps", "");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam07_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Not allowed key */
+  ret = nns_edge_set_info (edge_h, "id", "temp-id2");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "client_id", "temp-cid");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam08_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid port number */
+  ret = nns_edge_set_info (edge_h, "port", "-1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "port", "77777");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam09_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid option */
+  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "15:INVALID_LEAKY");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam10_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "HANDSHAKE_WORKERS", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam11_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "BACKLOG", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "LISTENERS", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam12_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Read-only key */
+  ret = nns_edge_set_info (edge_h, "POOL_STATS", "data_hit=1");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam13_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The alignment should be power of 2 */
+  ret = nns_edge_set_info (edge_h, "DATA_ALIGNMENT", "100");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "DATA_ALIGNMENT", "4");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam14_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The codec is not registered */
+  ret = nns_edge_set_info (edge_h, "CODEC", "temp-codec");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Read-only key */
+  ret = nns_edge_set_info (edge_h, "CODEC_STATS", "sent_raw=0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "OUTSTANDING_REQUESTS", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam15_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "CODEC_FILTER", "temp-filter");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CODEC_ELEMENT_SIZE", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CODEC_ELEMENT_SIZE", "1024");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam16_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "WIRE_PRECISION", "fp8");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam17_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "DELTA_KEYFRAME", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "DELTA_KEYFRAME", "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam18_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Only query server gathers the requests into a batch. */
+  ret = nns_edge_set_info (edge_h, "BATCH_SIZE", "4");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_TIMEOUT", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BATCH_TIMEOUT", "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "BATCH_SIZE", "70000");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam19_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Only query client balances the requests. */
+  ret = nns_edge_set_info (edge_h, "LB_POLICY", "ewma");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "LB_POLICY", "random");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "LB_EJECT_FAILURES", "0");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam20_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Only query client sends the duplicated request. */
+  ret = nns_edge_set_info (edge_h, "HEDGE_PERCENTILE", "95");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "HEDGE_PERCENTILE", "100");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set info - invalid param.
+ */
+TEST(edge, setInfoInvalidParam21_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Only query client sends the deadline of the request. */
+  ret = nns_edge_set_info (edge_h, "REQUEST_TIMEOUT", "1000");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "REQUEST_TIMEOUT", "4294967296");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info.
+ */
+TEST(edge, getInfo)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_set_info (edge_h, "capability", "capa-for-test");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "topic", "topic-for-test");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "ip", "165.213.201.100");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "port", "2000");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "dest_ip", "165.213.201.101");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "dest_port", "2001");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "ID", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-id");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "capability", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "capa-for-test");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "topic", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "topic-for-test");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "ip", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "165.213.201.100");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "port", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2000");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "dest_ip", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "165.213.201.101");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "dest_port", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2001");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "DATA_POOL_SIZE", "4");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "BUFFER_POOL_SIZE", "1048576");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "POOL_STATS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "data_hit=0,data_miss=0,data_cached=0,buffer_hit=0,buffer_miss=0,buffer_cached_bytes=0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "DATA_ALIGNMENT", "64");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DATA_ALIGNMENT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "64");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CODEC", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "none");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CODEC", "lz");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CODEC_THRESHOLD", "4096");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CODEC", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "lz");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CODEC_THRESHOLD", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "4096");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CODEC_STATS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "sent_raw=0,sent_encoded=0,received_raw=0,received_encoded=0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "CODEC_FILTER", "shuffle");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CODEC_ELEMENT_SIZE", "2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "CODEC_FILTER", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "shuffle");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "CODEC_ELEMENT_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "WIRE_PRECISION", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "none");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "WIRE_PRECISION", "bf16");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "RESTORE_PRECISION", "false");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "WIRE_PRECISION", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "bf16");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "RESTORE_PRECISION", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "false");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "DELTA", "true");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "DELTA_KEYFRAME", "10");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "DELTA", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "true");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "DELTA_KEYFRAME", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "10");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "BATCH_SIZE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "LB_POLICY", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "none");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "HEDGE_PERCENTILE", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "REQUEST_TIMEOUT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "LB_POLICY", "EWMA");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "LB_EJECT_FAILURES", "5");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "LB_EJECT_TIME", "3000");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "LB_POLICY", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "ewma");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "LB_EJECT_FAILURES", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "5");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "LB_EJECT_TIME", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "3000");
+  SAFE_FREE (value);
+
+  ret = nns_edge_set_info (edge_h, "BATCH_TIMEOUT", "20");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_get_info (edge_h, "BATCH_TIMEOUT", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "20");
+  SAFE_FREE (value);
+
+  ret = nns_edge_get_info (edge_h, "OUTSTANDING_REQUESTS", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "0");
+  SAFE_FREE (value);
+
+  /* Replace old value */
+  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2-replaced");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2-replaced");
+  SAFE_FREE (value);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam01_n)
+{
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_get_info (NULL, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam02_n)
+{
+  nns_edge_h edge_h;
+  char *value;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_get_info (edge_h, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam03_n)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, NULL, &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam04_n)
+{
+  nns_edge_h edge_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam05_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_get_info (edge_h, "temp-key", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_release_handle (edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get info - invalid param.
+ */
+TEST(edge, getInfoInvalidParam06_n)
+{
+  nns_edge_h edge_h;
+  int ret;
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Cannot get the client ID if handle is server */
+  ret = nns_edge_get_info (edge_h, "client_id", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Clear info of edge-data - invalid param.
+ */
+TEST(edgeData, clearInfoInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_clear_info (NULL);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Clear info of edge-data - invalid param.
+ */
+TEST(edgeData, clearInfoInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_clear_info (data_h);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+}
+
+/**
+ * @brief Clear info of edge data.
+ */
+TEST(edgeData, clearInfo)
+{
+  nns_edge_data_h data_h;
+  char *value = NULL;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_STREQ ("temp-value", value);
+  SAFE_FREE (value);
+
+  ret = nns_edge_data_clear_info (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_STREQ ("temp-value", value);
+  SAFE_FREE (value);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create edge-data - invalid param.
+ */
+TEST(edgeData, createInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_create (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Destroy edge-data - invalid param.
+ */
+TEST(edgeData, destroyInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_destroy (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Destroy edge-data - invalid param.
+ */
+TEST(edgeData, destroyInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Validate edge-data.
+ */
+TEST(edgeData, validate)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_is_valid (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Validate edge-data - invalid param.
+ */
+TEST(edgeData, validateInvalidParam01_n)
+{
+  int ret;
+
+  ret = nns_edge_data_is_valid (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Validate edge-data - invalid param.
+ */
+TEST(edgeData, validateInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_is_valid (data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data.
+ */
+TEST(edgeData, copy)
+{
+  nns_edge_data_h src_h, desc_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  char *result_value;
+  unsigned int i, result_count;
+  int ret;
+
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (src_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_copy (src_h, &desc_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Compare data and info */
+  ret = nns_edge_data_get_count (desc_h, &result_count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_count, 1U);
+
+  ret = nns_edge_data_get (desc_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get_info (desc_h, "temp-key1", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val1");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_get_info (desc_h, "temp-key2", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val2");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_destroy (desc_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data with multiple memories.
+ */
+TEST(edgeData, copyMultiMemories)
+{
+  nns_edge_data_h src_h, desc_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  unsigned int i, n, result_count;
+  int ret;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  data_len = 10U * sizeof (unsigned int);
+  for (n = 0; n < 20U; n++) {
+    data = malloc (data_len);
+    ASSERT_TRUE (data != NULL);
+
+    for (i = 0; i < 10U; i++)
+      ((unsigned int *) data)[i] = n * 10U + i;
+
+    ret = nns_edge_data_add (src_h, data, data_len, nns_edge_free);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_data_copy (src_h, &desc_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (desc_h, &result_count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_count, 20U);
+
+  for (n = 0; n < 20U; n++) {
+    ret = nns_edge_data_get (desc_h, n, &result, &result_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (result_len, data_len);
+    for (i = 0; i < 10U; i++)
+      EXPECT_EQ (((unsigned int *) result)[i], n * 10U + i);
+  }
+
+  ret = nns_edge_data_destroy (desc_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data - invalid param.
+ */
+TEST(edgeData, copyInvalidParam01_n)
+{
+  nns_edge_data_h desc_h;
+  int ret;
+
+  ret = nns_edge_data_copy (NULL, &desc_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data - invalid param.
+ */
+TEST(edgeData, copyInvalidParam02_n)
+{
+  nns_edge_data_h src_h, desc_h;
+  int ret;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_copy (src_h, &desc_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Copy edge-data - invalid param.
+ */
+TEST(edgeData, copyInvalidParam03_n)
+{
+  nns_edge_data_h src_h;
+  int ret;
+
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_copy (src_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Add edge-data - max data limit.
+ */
+TEST(edgeData, addMaxData_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int i, ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < NNS_EDGE_DATA_LIMIT; i++) {
+    ret = nns_edge_data_add (data_h, data, data_len, NULL);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
+ */
+TEST(edgeData, addInvalidParam01_n)
+{
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_add (NULL, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
+ */
+TEST(edgeData, addInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
+ */
+TEST(edgeData, addInvalidParam03_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_add (data_h, NULL, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
+}
+
+/**
+ * @brief Add edge-data - invalid param.
  */
-TEST(edge, setInfoInvalidParam03_n)
+TEST(edgeData, addInvalidParam04_n)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_info (edge_h, NULL, "temp-caps");
+  ret = nns_edge_data_add (data_h, data, 0, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Get edge-data.
  */
-TEST(edge, setInfoInvalidParam04_n)
+TEST(edgeData, get)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  unsigned int count;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_info (edge_h, "", "temp-caps");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
+
+  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result, data);
+  EXPECT_EQ (result_len, data_len);
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Get edge-data - invalid param.
  */
-TEST(edge, setInfoInvalidParam05_n)
+TEST(edgeData, getInvalidParam01_n)
 {
-  nns_edge_h edge_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_data_get (NULL, 0, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get edge-data - invalid param.
+ */
+TEST(edgeData, getInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_info (edge_h, "caps", NULL);
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Get edge-data - invalid param.
  */
-TEST(edge, setInfoInvalidParam06_n)
+TEST(edgeData, getInvalidParam03_n)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_set_info (edge_h, "caps", "");
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid index */
+  ret = nns_edge_data_get (data_h, 1, &result, &result_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Get edge-data - invalid param.
  */
-TEST(edge, setInfoInvalidParam07_n)
+TEST(edgeData, getInvalidParam04_n)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len, result_len;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Not allowed key */
-  ret = nns_edge_set_info (edge_h, "id", "temp-id2");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "client_id", "temp-cid");
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get (data_h, 0, NULL, &result_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Get edge-data - invalid param.
  */
-TEST(edge, setInfoInvalidParam08_n)
+TEST(edgeData, getInvalidParam05_n)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Invalid port number */
-  ret = nns_edge_set_info (edge_h, "port", "-1");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "port", "77777");
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get (data_h, 0, &result, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Set info - invalid param.
+ * @brief Get count of edge-data - invalid param.
  */
-TEST(edge, setInfoInvalidParam09_n)
+TEST(edgeData, getCountInvalidParam01_n)
 {
-  nns_edge_h edge_h;
+  unsigned int count;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  ret = nns_edge_data_get_count (NULL, &count);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Get count of edge-data - invalid param.
+ */
+TEST(edgeData, getCountInvalidParam02_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
+  unsigned int count;
+  int ret;
+
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Invalid option */
-  ret = nns_edge_set_info (edge_h, "QUEUE_SIZE", "15:INVALID_LEAKY");
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_get_count (data_h, &count);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Get info.
+ * @brief Get count of edge-data - invalid param.
  */
-TEST(edge, getInfo)
+TEST(edgeData, getCountInvalidParam03_n)
 {
-  nns_edge_h edge_h;
-  char *value = NULL;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
 
-  ret = nns_edge_set_info (edge_h, "capability", "capa-for-test");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "topic", "topic-for-test");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "ip", "165.213.201.100");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "port", "2000");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "dest_ip", "165.213.201.101");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "dest_port", "2001");
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "temp-key1", "temp-value1");
+
+  ret = nns_edge_data_add (data_h, data, data_len, NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2");
+
+  ret = nns_edge_data_get_count (data_h, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_get_info (edge_h, "ID", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-id");
-  SAFE_FREE (value);
+  SAFE_FREE (data);
+}
 
-  ret = nns_edge_get_info (edge_h, "capability", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "capa-for-test");
-  SAFE_FREE (value);
+/**
+ * @brief Set typed info of edge-data.
+ */
+TEST(edgeData, setInfoTyped)
+{
+  nns_edge_data_h data_h, copied_h;
+  unsigned int bin[4] = { 1U, 2U, 3U, 4U };
+  int64_t ival;
+  double dval;
+  void *value;
+  nns_size_t value_len;
+  char *val;
+  int ret;
 
-  ret = nns_edge_get_info (edge_h, "topic", &value);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "topic-for-test");
-  SAFE_FREE (value);
 
-  ret = nns_edge_get_info (edge_h, "ip", &value);
+  ret = nns_edge_data_set_info_int64 (data_h, "temp-int", -1234567890123LL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "165.213.201.100");
-  SAFE_FREE (value);
-
-  ret = nns_edge_get_info (edge_h, "port", &value);
+  ret = nns_edge_data_set_info_double (data_h, "temp-double", 0.25);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info_binary (data_h, "temp-bin", bin, sizeof (bin));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "temp-str", "100");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "2000");
-  SAFE_FREE (value);
 
-  ret = nns_edge_get_info (edge_h, "dest_ip", &value);
+  ret = nns_edge_data_copy (data_h, &copied_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "165.213.201.101");
-  SAFE_FREE (value);
 
-  ret = nns_edge_get_info (edge_h, "dest_port", &value);
+  ret = nns_edge_data_get_info_int64 (copied_h, "TEMP-INT", &ival);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "2001");
-  SAFE_FREE (value);
+  EXPECT_EQ (ival, -1234567890123LL);
+  ret = nns_edge_data_get_info (copied_h, "temp-int", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "-1234567890123");
+  SAFE_FREE (val);
 
-  ret = nns_edge_get_info (edge_h, "temp-key1", &value);
+  ret = nns_edge_data_get_info_double (copied_h, "temp-double", &dval);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value1");
-  SAFE_FREE (value);
+  EXPECT_DOUBLE_EQ (dval, 0.25);
+  ret = nns_edge_data_get_info (copied_h, "temp-double", &val);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (val, "0.25");
+  SAFE_FREE (val);
 
-  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
+  ret = nns_edge_data_get_info_binary (copied_h, "temp-bin", &value, &value_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2");
+  EXPECT_EQ (value_len, sizeof (bin));
+  EXPECT_EQ (memcmp (value, bin, sizeof (bin)), 0);
   SAFE_FREE (value);
 
-  /* Replace old value */
-  ret = nns_edge_set_info (edge_h, "temp-key2", "temp-value2-replaced");
+  /* String value is converted to number. */
+  ret = nns_edge_data_get_info_int64 (copied_h, "temp-str", &ival);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_get_info (edge_h, "temp-key2", &value);
+  EXPECT_EQ (ival, 100);
+  ret = nns_edge_data_get_info_double (copied_h, "temp-str", &dval);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2-replaced");
-  SAFE_FREE (value);
+  EXPECT_DOUBLE_EQ (dval, 100.0);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (copied_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Set typed info of edge-data - invalid param.
  */
-TEST(edge, getInfoInvalidParam01_n)
+TEST(edgeData, setInfoTypedInvalidParam01_n)
 {
-  char *value = NULL;
+  nns_edge_data_h data_h;
+  unsigned int bin = 1U;
   int ret;
 
-  ret = nns_edge_get_info (NULL, "temp-key", &value);
+  ret = nns_edge_data_set_info_int64 (NULL, "temp-key", 1);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info_double (NULL, "temp-key", 1.0);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info_binary (NULL, "temp-key", &bin, sizeof (bin));
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info_int64 (data_h, "", 1);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info_double (data_h, NULL, 1.0);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info_binary (data_h, "temp-key", NULL, sizeof (bin));
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info_binary (data_h, "temp-key", &bin, 0U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Get typed info of edge-data - invalid param.
  */
-TEST(edge, getInfoInvalidParam02_n)
+TEST(edgeData, getInfoTypedInvalidParam01_n)
 {
-  nns_edge_h edge_h;
-  char *value;
+  nns_edge_data_h data_h;
+  unsigned int bin = 1U;
+  int64_t ival;
+  double dval;
+  void *value;
+  nns_size_t value_len;
+  char *val;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_set_info (data_h, "temp-str", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info_binary (data_h, "temp-bin", &bin, sizeof (bin));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_get_info (edge_h, "temp-key", &value);
+  ret = nns_edge_data_get_info_int64 (data_h, "temp-key", &ival);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_info_int64 (data_h, "temp-str", NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (edge_h, NNS_EDGE_MAGIC);
+  /* Cannot convert the value. */
+  ret = nns_edge_data_get_info_int64 (data_h, "temp-str", &ival);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_info_double (data_h, "temp-str", &dval);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_info_binary (data_h, "temp-str", &value, &value_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_info (data_h, "temp-bin", &val);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Set info of edge-data - invalid param.
  */
-TEST(edge, getInfoInvalidParam03_n)
+TEST(edgeData, setInfoInvalidParam01_n)
 {
-  nns_edge_h edge_h;
-  char *value = NULL;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_get_info (edge_h, NULL, &value);
+  ret = nns_edge_data_set_info (NULL, "temp-key", "temp-value");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_release_handle (edge_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Set info of edge-data - invalid param.
  */
-TEST(edge, getInfoInvalidParam04_n)
+TEST(edgeData, setInfoInvalidParam02_n)
 {
-  nns_edge_h edge_h;
-  char *value = NULL;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_get_info (edge_h, "", &value);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Set info of edge-data - invalid param.
  */
-TEST(edge, getInfoInvalidParam05_n)
+TEST(edgeData, setInfoInvalidParam03_n)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_CLIENT, &edge_h);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_get_info (edge_h, "temp-key", NULL);
+  ret = nns_edge_data_set_info (data_h, NULL, "temp-value");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get info - invalid param.
+ * @brief Set info of edge-data - invalid param.
  */
-TEST(edge, getInfoInvalidParam06_n)
+TEST(edgeData, setInfoInvalidParam04_n)
 {
-  nns_edge_h edge_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
-      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Cannot get the client ID if handle is server */
-  ret = nns_edge_get_info (edge_h, "client_id", NULL);
+  ret = nns_edge_data_set_info (data_h, "temp-key", NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_release_handle (edge_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Clear info of edge-data - invalid param.
+ * @brief Get info of edge-data - invalid param.
  */
-TEST(edgeData, clearInfoInvalidParam01_n)
+TEST(edgeData, getInfoInvalidParam01_n)
 {
+  char *value = NULL;
   int ret;
 
-  ret = nns_edge_data_clear_info (NULL);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_data_get_info (NULL, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Clear info of edge-data - invalid param.
+ * @brief Get info of edge-data - invalid param.
  */
-TEST(edgeData, clearInfoInvalidParam02_n)
+TEST(edgeData, getInfoInvalidParam02_n)
 {
   nns_edge_data_h data_h;
+  char *value = NULL;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_clear_info (data_h);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
 
   ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Clear info of edge data.
+ * @brief Get info of edge-data - invalid param.
  */
-TEST(edgeData, clearInfo)
+TEST(edgeData, getInfoInvalidParam03_n)
 {
   nns_edge_data_h data_h;
   char *value = NULL;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-  EXPECT_STREQ ("temp-value", value);
-  SAFE_FREE (value);
-
-  ret = nns_edge_data_clear_info (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-  EXPECT_STREQ ("temp-value", value);
-  SAFE_FREE (value);
-
-  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
-
-/**
- * @brief Create edge-data - invalid param.
- */
-TEST(edgeData, createInvalidParam01_n)
-{
-  int ret;
 
-  ret = nns_edge_data_create (NULL);
+  ret = nns_edge_data_get_info (data_h, NULL, &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
-
-/**
- * @brief Destroy edge-data - invalid param.
- */
-TEST(edgeData, destroyInvalidParam01_n)
-{
-  int ret;
 
-  ret = nns_edge_data_destroy (NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Destroy edge-data - invalid param.
+ * @brief Get info of edge-data - invalid param.
  */
-TEST(edgeData, destroyInvalidParam02_n)
+TEST(edgeData, getInfoInvalidParam04_n)
 {
   nns_edge_data_h data_h;
   int ret;
@@ -1160,21 +5568,20 @@ TEST(edgeData, destroyInvalidParam02_n)
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_data_get_info (data_h, "temp-key", NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
-
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Validate edge-data.
+ * @brief Get info of edge-data - invalid param.
  */
-TEST(edgeData, validate)
+TEST(edgeData, getInfoInvalidParam05_n)
 {
   nns_edge_data_h data_h;
   int ret;
@@ -1182,38 +5589,48 @@ TEST(edgeData, validate)
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_is_valid (data_h);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
+  ret = nns_edge_data_get_info (data_h, "", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Validate edge-data - invalid param.
+ * @brief Serialize meta in edge-data - invalid param.
  */
-TEST(edgeData, validateInvalidParam01_n)
+TEST(edgeData, serializeInvalidParam01_n)
 {
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_is_valid (NULL);
+  ret = nns_edge_data_serialize_meta (NULL, &data, &data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Validate edge-data - invalid param.
+ * @brief Serialize meta in edge-data - invalid param.
  */
-TEST(edgeData, validateInvalidParam02_n)
+TEST(edgeData, serializeInvalidParam02_n)
 {
   nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_is_valid (data_h);
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
@@ -1223,140 +5640,129 @@ TEST(edgeData, validateInvalidParam02_n)
 }
 
 /**
- * @brief Copy edge-data.
+ * @brief Serialize meta in edge-data - invalid param.
  */
-TEST(edgeData, copy)
+TEST(edgeData, serializeInvalidParam03_n)
 {
-  nns_edge_data_h src_h, desc_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  char *result_value;
-  unsigned int i, result_count;
+  nns_edge_data_h data_h;
+  nns_size_t data_len;
   int ret;
 
-  data_len = 10U * sizeof (unsigned int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  for (i = 0; i < 10U; i++)
-    ((unsigned int *) data)[i] = i;
-
-  ret = nns_edge_data_create (&src_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (src_h, data, data_len, nns_edge_free);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_copy (src_h, &desc_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_serialize_meta (data_h, NULL, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (src_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  /* Compare data and info */
-  ret = nns_edge_data_get_count (desc_h, &result_count);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (result_count, 1U);
+/**
+ * @brief Serialize meta in edge-data - invalid param.
+ */
+TEST(edgeData, serializeInvalidParam04_n)
+{
+  nns_edge_data_h data_h;
+  void *data;
+  int ret;
 
-  ret = nns_edge_data_get (desc_h, 0, &result, &result_len);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 10U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i);
 
-  ret = nns_edge_data_get_info (desc_h, "temp-key1", &result_value);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val1");
-  SAFE_FREE (result_value);
 
-  ret = nns_edge_data_get_info (desc_h, "temp-key2", &result_value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val2");
-  SAFE_FREE (result_value);
+  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (desc_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Copy edge-data - invalid param.
+ * @brief Deserialize meta to edge-data - invalid param.
  */
-TEST(edgeData, copyInvalidParam01_n)
+TEST(edgeData, deserializeInvalidParam01_n)
 {
-  nns_edge_data_h desc_h;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_copy (NULL, &desc_h);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
-
-/**
- * @brief Copy edge-data - invalid param.
- */
-TEST(edgeData, copyInvalidParam02_n)
-{
-  nns_edge_data_h src_h, desc_h;
-  int ret;
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_create (&src_h);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_copy (src_h, &desc_h);
+  ret = nns_edge_data_deserialize_meta (NULL, data, data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (src_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_data_destroy (src_h);
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Copy edge-data - invalid param.
+ * @brief Deserialize meta to edge-data - invalid param.
  */
-TEST(edgeData, copyInvalidParam03_n)
+TEST(edgeData, deserializeInvalidParam02_n)
 {
-  nns_edge_data_h src_h;
+  nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&src_h);
+  ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_copy (src_h, NULL);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_deserialize_meta (data_h, data, data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (src_h);
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Add edge-data - max data limit.
+ * @brief Deserialize meta to edge-data - invalid param.
  */
-TEST(edgeData, addMaxData_n)
+TEST(edgeData, deserializeInvalidParam03_n)
 {
   nns_edge_data_h data_h;
   void *data;
   nns_size_t data_len;
-  int i, ret;
-
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  int ret;
 
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  for (i = 0; i < NNS_EDGE_DATA_LIMIT; i++) {
-    ret = nns_edge_data_add (data_h, data, data_len, NULL);
-    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  }
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize_meta (data_h, NULL, data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
@@ -1366,396 +5772,609 @@ TEST(edgeData, addMaxData_n)
 }
 
 /**
- * @brief Add edge-data - invalid param.
+ * @brief Deserialize meta to edge-data - invalid param.
  */
-TEST(edgeData, addInvalidParam01_n)
+TEST(edgeData, deserializeInvalidParam04_n)
 {
+  nns_edge_data_h data_h;
   void *data;
   nns_size_t data_len;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (NULL, data, data_len, NULL);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize_meta (data_h, data, 0);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
   SAFE_FREE (data);
 }
 
+
 /**
- * @brief Add edge-data - invalid param.
+ * @brief Serialzie and deserialize the edge-data.
  */
-TEST(edgeData, addInvalidParam02_n)
+TEST(edgeDataSerialize, normal)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_data_h src_h, dest_h;
+  void *data1, *data2, *result, *serialized_data;
+  nns_size_t data_len, result_len, serialized_len;
+  char *result_value;
+  unsigned int i, result_count;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  data_len = 10U * sizeof (unsigned int);
+  data1 = malloc (data_len);
+  ASSERT_TRUE (data1 != NULL);
 
-  ret = nns_edge_data_create (&data_h);
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data1)[i] = i;
+
+  data2 = malloc (data_len * 2);
+  ASSERT_TRUE (data2 != NULL);
+
+  for (i = 0; i < 20U; i++)
+    ((unsigned int *) data2)[i] = 20 - i;
+
+  ret = nns_edge_data_create (&src_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data1, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (src_h, data2, data_len * 2, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_data_serialize (src_h, &serialized_data, &serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_data_destroy (src_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  ret = nns_edge_data_create (&dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (dest_h, serialized_data, serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Compare data and info */
+  ret = nns_edge_data_get_count (dest_h, &result_count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result_count, 2U);
+
+  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
+
+  ret = nns_edge_data_get (dest_h, 1, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 20U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], 20 - i);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key1", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val1");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_get_info (dest_h, "temp-key2", &result_value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val2");
+  SAFE_FREE (result_value);
+
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (serialized_data);
 }
 
+
 /**
- * @brief Add edge-data - invalid param.
+ * @brief Create edge-data with raw data and metadata for test.
  */
-TEST(edgeData, addInvalidParam03_n)
+static nns_edge_data_h
+_get_test_edge_data (void)
 {
-  nns_edge_data_h data_h;
+  nns_edge_data_h data_h = NULL;
   void *data;
-  nns_size_t data_len;
-  int ret;
+  unsigned int i;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  data = malloc (10U * sizeof (unsigned int));
+  if (!data)
+    return NULL;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
 
-  ret = nns_edge_data_add (data_h, NULL, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  if (nns_edge_data_create (&data_h) != NNS_EDGE_ERROR_NONE) {
+    free (data);
+    return NULL;
+  }
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_data_add (data_h, data, 10U * sizeof (unsigned int), free);
+  nns_edge_data_set_info (data_h, "temp-key1", "temp-data-val1");
+  nns_edge_data_set_info_int64 (data_h, "temp-key2", 100);
 
-  SAFE_FREE (data);
+  return data_h;
 }
 
 /**
- * @brief Add edge-data - invalid param.
+ * @brief Serialize the edge-data into given buffer.
  */
-TEST(edgeData, addInvalidParam04_n)
+TEST(edgeDataSerialize, into)
 {
   nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  void *serialized, *buffer = NULL;
+  nns_size_t serialized_len, size, buffer_size = 0U, len = 0U;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_data_serialize (data_h, &serialized, &serialized_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, 0, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_serialized_size (data_h, 0U, &size);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (size, serialized_len);
 
-  ret = nns_edge_data_destroy (data_h);
+  buffer = nns_edge_malloc (size);
+  ASSERT_TRUE (buffer != NULL);
+
+  ret = nns_edge_data_serialize_into (data_h, 0U, buffer, size);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (memcmp (buffer, serialized, size), 0);
 
-  SAFE_FREE (data);
+  nns_edge_free (buffer);
+  buffer = NULL;
+
+  /* The buffer is allocated once and reused. */
+  ret = nns_edge_data_serialize_reuse (data_h, 0U, &buffer, &buffer_size, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, serialized_len);
+  EXPECT_EQ (buffer_size, serialized_len);
+  EXPECT_EQ (memcmp (buffer, serialized, len), 0);
+
+  nns_edge_free (serialized);
+  serialized = buffer;
+  ret = nns_edge_data_clear (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_serialize_reuse (data_h, 0U, &buffer, &buffer_size, &len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (buffer == serialized);
+  EXPECT_TRUE (len < buffer_size);
+  EXPECT_EQ (nns_edge_data_is_serialized (buffer, len), NNS_EDGE_ERROR_NONE);
+
+  nns_edge_free (buffer);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge-data.
+ * @brief Serialize the edge-data into reusable buffer, the buffer is aligned to given bytes.
  */
-TEST(edgeData, get)
+TEST(edgeDataSerialize, reuseAligned)
 {
   nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  unsigned int count;
+  void *buffer = NULL, *reused;
+  nns_size_t buffer_size = 0U, len = 0U, size;
+  const nns_size_t alignment = 64U;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_data_get_serialized_size (data_h, alignment, &size);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_data_serialize_reuse (data_h, alignment, &buffer,
+      &buffer_size, &len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (len, size);
+  EXPECT_EQ (((uintptr_t) buffer % alignment), 0U);
+  EXPECT_EQ (nns_edge_data_is_serialized (buffer, len), NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_count (data_h, &count);
+  /* The aligned buffer is reused. */
+  reused = buffer;
+  ret = nns_edge_data_serialize_reuse (data_h, alignment, &buffer,
+      &buffer_size, &len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
+  EXPECT_TRUE (buffer == reused);
 
-  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (result, data);
-  EXPECT_EQ (result_len, data_len);
+  nns_edge_free (buffer);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Serialize the edge-data into given buffer - invalid param.
  */
-TEST(edgeData, getInvalidParam01_n)
+TEST(edgeDataSerialize, intoInvalidParam01_n)
 {
-  void *data;
-  nns_size_t data_len;
+  nns_edge_data_h data_h;
+  void *buffer;
+  nns_size_t size;
   int ret;
 
-  ret = nns_edge_data_get (NULL, 0, &data, &data_len);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
+
+  ret = nns_edge_data_get_serialized_size (NULL, 0U, &size);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_serialized_size (data_h, 0U, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_serialized_size (data_h, 0U, &size);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  buffer = nns_edge_malloc (size);
+  ASSERT_TRUE (buffer != NULL);
+
+  ret = nns_edge_data_serialize_into (NULL, 0U, buffer, size);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_serialize_into (data_h, 0U, NULL, size);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Small buffer */
+  ret = nns_edge_data_serialize_into (data_h, 0U, buffer, size - 1);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_free (buffer);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Serialize the edge-data into the list of memory chunks.
  */
-TEST(edgeData, getInvalidParam02_n)
+TEST(edgeDataSerialize, iov)
 {
-  nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
+  nns_edge_data_h data_h, result_h;
+  nns_edge_data_iov_s iov;
+  void *serialized, *data, *result;
+  nns_size_t serialized_len, data_len, result_len, cur;
+  char *value = NULL;
+  unsigned int i;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_data_serialize (data_h, &serialized, &serialized_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_data_serialize_iov (data_h, &iov);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (iov.num, 3U);
+  EXPECT_EQ (iov.total, serialized_len);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  /* The chunk of raw data refers to the memory in edge data. */
+  ret = nns_edge_data_get (data_h, 0, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (iov.iov[1].iov_base == data);
+  EXPECT_EQ (iov.iov[1].iov_len, data_len);
 
-  ret = nns_edge_data_get (data_h, 0, &result, &result_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  result = nns_edge_malloc (iov.total);
+  ASSERT_TRUE (result != NULL);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  for (i = 0, cur = 0; i < iov.num; i++) {
+    memcpy ((char *) result + cur, iov.iov[i].iov_base, iov.iov[i].iov_len);
+    cur += iov.iov[i].iov_len;
+  }
+
+  EXPECT_EQ (cur, serialized_len);
+  EXPECT_EQ (memcmp (result, serialized, serialized_len), 0);
+
+  nns_edge_data_release_iov (&iov);
+  EXPECT_TRUE (iov.buffer == NULL);
+
+  ret = nns_edge_data_create (&result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_deserialize (result_h, result, cur);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
+  ret = nns_edge_data_get_info (result_h, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-data-val1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_data_destroy (result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  nns_edge_free (result);
+  nns_edge_free (serialized);
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Serialize the edge-data into the list of memory chunks - invalid param.
  */
-TEST(edgeData, getInvalidParam03_n)
+TEST(edgeDataSerialize, iovInvalidParam01_n)
 {
   nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
+  nns_edge_data_iov_s iov;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
 
-  /* Invalid index */
-  ret = nns_edge_data_get (data_h, 1, &result, &result_len);
+  ret = nns_edge_data_serialize_iov (NULL, &iov);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_serialize_iov (data_h, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Serialize the edge-data with aligned format.
  */
-TEST(edgeData, getInvalidParam04_n)
+TEST(edgeDataSerialize, aligned)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len, result_len;
+  nns_edge_data_h data_h, result_h;
+  void *serialized, *data, *result;
+  nns_size_t serialized_len, size, data_len, result_len;
+  unsigned int i, count;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
+
+  /* Odd size to make the padding before the next memory. */
+  data = malloc (33U);
   ASSERT_TRUE (data != NULL);
+  memset (data, 0x5a, 33U);
+  ret = nns_edge_data_add (data_h, data, 33U, free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_create (&data_h);
+  data = malloc (16U);
+  ASSERT_TRUE (data != NULL);
+  memset (data, 0xa5, 16U);
+  ret = nns_edge_data_add (data_h, data, 16U, free);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_data_serialize_aligned (data_h, 64U, &serialized,
+      &serialized_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (((uintptr_t) serialized) % 64U, 0U);
+  EXPECT_EQ (nns_edge_data_is_serialized (serialized, serialized_len),
+      NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get (data_h, 0, NULL, &result_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_serialized_size (data_h, 64U, &size);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (size, serialized_len);
+
+  ret = nns_edge_data_create (&result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The memories in place are aligned. */
+  ret = nns_edge_data_deserialize_view (result_h, serialized, serialized_len,
+      NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (result_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 3U);
+
+  for (i = 0; i < count; i++) {
+    ret = nns_edge_data_get (data_h, i, &data, &data_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_get (result_h, i, &result, &result_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    EXPECT_TRUE ((char *) result > (char *) serialized);
+    EXPECT_TRUE ((char *) result < (char *) serialized + serialized_len);
+    EXPECT_EQ (((uintptr_t) result) % 64U, 0U);
+    EXPECT_EQ (result_len, data_len);
+    EXPECT_EQ (memcmp (result, data, data_len), 0);
+  }
+
+  /* Copy the memories into aligned buffer. */
+  ret = nns_edge_data_deserialize (result_h, serialized, serialized_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
+  for (i = 0; i < count; i++) {
+    ret = nns_edge_data_get (data_h, i, &data, &data_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    ret = nns_edge_data_get (result_h, i, &result, &result_len);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+    EXPECT_FALSE ((char *) result >= (char *) serialized &&
+        (char *) result < (char *) serialized + serialized_len);
+    EXPECT_EQ (((uintptr_t) result) % 64U, 0U);
+    EXPECT_EQ (memcmp (result, data, data_len), 0);
+  }
+
+  ret = nns_edge_data_destroy (result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  nns_edge_free (serialized);
 }
 
 /**
- * @brief Get edge-data - invalid param.
+ * @brief Serialize the edge-data with aligned format - invalid param.
  */
-TEST(edgeData, getInvalidParam05_n)
+TEST(edgeDataSerialize, alignedInvalidParam01_n)
 {
   nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len;
+  void *serialized = NULL;
+  nns_size_t serialized_len, size;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_serialize_aligned (data_h, 0U, &serialized,
+      &serialized_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_serialize_aligned (data_h, 4U, &serialized,
+      &serialized_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_serialize_aligned (data_h, 100U, &serialized,
+      &serialized_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_serialized_size (data_h, 100U, &size);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_data_serialize_aligned (data_h, 64U, &serialized,
+      &serialized_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get (data_h, 0, &result, NULL);
+  /* Truncated data */
+  ret = nns_edge_data_is_serialized (serialized, serialized_len - 1);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  nns_edge_free (serialized);
 }
 
 /**
- * @brief Get count of edge-data - invalid param.
+ * @brief Serialize edge-data - invalid param.
  */
-TEST(edgeData, getCountInvalidParam01_n)
+TEST(edgeDataSerialize, invalidParam01_n)
 {
-  unsigned int count;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_get_count (NULL, &count);
+  ret = nns_edge_data_serialize (NULL, &data, &data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get count of edge-data - invalid param.
+ * @brief Serialize edge-data - invalid param.
  */
-TEST(edgeData, getCountInvalidParam02_n)
+TEST(edgeData, invalidParam02_n)
 {
   nns_edge_data_h data_h;
   void *data;
   nns_size_t data_len;
-  unsigned int count;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_get_count (data_h, &count);
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Get count of edge-data - invalid param.
+ * @brief Clear raw data in edge-data - invalid param.
  */
-TEST(edgeData, getCountInvalidParam03_n)
+TEST(edgeData, clearInvalidParam01_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_add (data_h, data, data_len, NULL);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_get_count (data_h, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
+  ret = nns_edge_data_clear (NULL);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
 }
 
 /**
- * @brief Set info of edge-data - invalid param.
+ * @brief Clear raw data in edge-data - invalid param.
  */
-TEST(edgeData, setInfoInvalidParam01_n)
+TEST(edgeData, clearInvalidParam02_n)
 {
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_data_set_info (NULL, "temp-key", "temp-value");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_create (&data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_data_clear (data_h);
+  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+
+  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
 }
 
 /**
- * @brief Set info of edge-data - invalid param.
+ * @brief Clear raw data in edge-data.
  */
-TEST(edgeData, setInfoInvalidParam02_n)
+TEST(edgeData, clear)
 {
   nns_edge_data_h data_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  unsigned int count;
   int ret;
 
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
   ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE , ret);
+  EXPECT_EQ (1U, count);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_data_clear (data_h);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+
+  ret = nns_edge_data_get_count (data_h, &count);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  EXPECT_EQ (0U, count);
 
   ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
 }
 
 /**
- * @brief Set info of edge-data - invalid param.
+ * @brief Serialize edge-data - invalid param.
  */
-TEST(edgeData, setInfoInvalidParam03_n)
+TEST(edgeDataSerialize, invalidParam03_n)
 {
   nns_edge_data_h data_h;
+  nns_size_t data_len;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, NULL, "temp-value");
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize (data_h, NULL, &data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
@@ -1763,17 +6382,21 @@ TEST(edgeData, setInfoInvalidParam03_n)
 }
 
 /**
- * @brief Set info of edge-data - invalid param.
+ * @brief Serialize edge-data - invalid param.
  */
-TEST(edgeData, setInfoInvalidParam04_n)
+TEST(edgeDataSerialize, invalidParam04_n)
 {
   nns_edge_data_h data_h;
+  void *data;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", NULL);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
@@ -1781,24 +6404,27 @@ TEST(edgeData, setInfoInvalidParam04_n)
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Deserialize edge-data - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam01_n)
+TEST(edgeDataDeserialize, invalidParam01_n)
 {
-  char *value = NULL;
+  void *data = NULL;
   int ret;
 
-  ret = nns_edge_data_get_info (NULL, "temp-key", &value);
+  ret = nns_edge_data_deserialize (NULL, data, 10U);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Deserialize edge-data - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam02_n)
+TEST(edgeDataDeserialize, invalidParam02_n)
 {
   nns_edge_data_h data_h;
-  char *value = NULL;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
@@ -1807,24 +6433,30 @@ TEST(edgeData, getInfoInvalidParam02_n)
   ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_get_info (data_h, "temp-key", &value);
+  ret = nns_edge_data_deserialize (data_h, data, data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Deserialize edge-data - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam03_n)
+TEST(edgeDataDeserialize, invalidParam03_n)
 {
   nns_edge_data_h data_h;
-  char *value = NULL;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
@@ -1833,19 +6465,26 @@ TEST(edgeData, getInfoInvalidParam03_n)
   ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (data_h, NULL, &value);
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (data_h, NULL, data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Deserialize edge-data - invalid param.
  */
-TEST(edgeData, getInfoInvalidParam04_n)
+TEST(edgeDataDeserialize, invalidParam04_n)
 {
   nns_edge_data_h data_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
   ret = nns_edge_data_create (&data_h);
@@ -1854,122 +6493,144 @@ TEST(edgeData, getInfoInvalidParam04_n)
   ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (data_h, "temp-key", NULL);
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_deserialize (data_h, data, 1U);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Get info of edge-data - invalid param.
+ * @brief Deserialize edge-data without copying raw data.
  */
-TEST(edgeData, getInfoInvalidParam05_n)
+TEST(edgeDataDeserialize, view)
 {
-  nns_edge_data_h data_h;
+  nns_edge_data_h data_h, result_h, copied_h;
+  void *serialized, *data, *result;
+  nns_size_t serialized_len, data_len;
+  char *value = NULL;
+  unsigned int count;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
+
+  ret = nns_edge_data_serialize (data_h, &serialized, &serialized_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_data_get (data_h, 0, &data, &data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (data_h, "", NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_create (&result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  /* The buffer is released when destroying the data handle. */
+  ret = nns_edge_data_deserialize_view (result_h, serialized, serialized_len,
+      nns_edge_free);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Serialize meta in edge-data - invalid param.
- */
-TEST(edgeData, serializeInvalidParam01_n)
-{
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  ret = nns_edge_data_get_count (result_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
 
-  ret = nns_edge_data_serialize_meta (NULL, &data, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_get (result_h, 0, &result, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE ((char *) result > (char *) serialized);
+  EXPECT_TRUE ((char *) result + data_len <= (char *) serialized + serialized_len);
+  EXPECT_EQ (memcmp (result, data, data_len), 0);
+
+  ret = nns_edge_data_get_info (result_h, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-data-val1");
+  SAFE_FREE (value);
+
+  /* Copied handle does not refer the buffer. */
+  ret = nns_edge_data_copy_transfer (result_h, &copied_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_destroy (result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get (copied_h, 0, &result, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (memcmp (result, data, data_len), 0);
+
+  ret = nns_edge_data_destroy (copied_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize meta in edge-data - invalid param.
+ * @brief Deserialize edge-data without copying raw data - invalid param.
  */
-TEST(edgeData, serializeInvalidParam02_n)
+TEST(edgeDataDeserialize, viewInvalidParam01_n)
 {
   nns_edge_data_h data_h;
   void *data;
   nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  data_h = _get_test_edge_data ();
+  ASSERT_TRUE (data_h != NULL);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  ret = nns_edge_data_deserialize_view (NULL, data, data_len, nns_edge_free);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_deserialize_view (data_h, NULL, data_len, nns_edge_free);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  /* The buffer is not released if failed to deserialize. */
+  ret = nns_edge_data_deserialize_view (data_h, data, 1U, nns_edge_free);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_free (data);
 }
 
 /**
- * @brief Serialize meta in edge-data - invalid param.
+ * @brief Util to check serialized data - invalid param.
  */
-TEST(edgeData, serializeInvalidParam03_n)
+TEST(edgeDataIsSerialized, invalidParam01_n)
 {
-  nns_edge_data_h data_h;
-  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_serialize_meta (data_h, NULL, &data_len);
+  ret = nns_edge_data_is_serialized (NULL, 1U);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize meta in edge-data - invalid param.
+ * @brief Util to check serialized data - invalid param.
  */
-TEST(edgeData, serializeInvalidParam04_n)
+TEST(edgeDataIsSerialized, invalidParam02_n)
 {
-  nns_edge_data_h data_h;
   void *data;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  data = nns_edge_malloc (100U);
+  ASSERT_TRUE (data != NULL);
+  memset (data, 0, 100U);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
+  /* invalid data key */
+  ret = nns_edge_data_is_serialized (data, 100U);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Util to check serialized data - invalid param.
  */
-TEST(edgeData, deserializeInvalidParam01_n)
+TEST(edgeDataIsSerialized, invalidParam03_n)
 {
   nns_edge_data_h data_h;
   void *data;
@@ -1982,10 +6643,11 @@ TEST(edgeData, deserializeInvalidParam01_n)
   ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  ret = nns_edge_data_serialize (data_h, &data, &data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize_meta (NULL, data, data_len);
+  /* invalid data size */
+  ret = nns_edge_data_is_serialized (data, 1U);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
@@ -1995,1117 +6657,1706 @@ TEST(edgeData, deserializeInvalidParam01_n)
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Get the max byte size of encoded data, test codec copies the data.
  */
-TEST(edgeData, deserializeInvalidParam02_n)
+static nns_size_t
+_test_codec_bound (nns_size_t size, void *user_data)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  UNUSED (user_data);
+  return size;
+}
+
+/**
+ * @brief Encode the data, test codec copies the data.
+ */
+static int
+_test_codec_encode (const void *src, nns_size_t src_len, void *dest,
+    nns_size_t *dest_len, void *user_data)
+{
+  UNUSED (user_data);
+
+  if (*dest_len < src_len)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  memcpy (dest, src, src_len);
+  *dest_len = src_len;
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Decode the data, test codec copies the data.
+ */
+static int
+_test_codec_decode (const void *src, nns_size_t src_len, void *dest,
+    nns_size_t dest_len, void *user_data)
+{
+  UNUSED (user_data);
+
+  if (src_len != dest_len)
+    return NNS_EDGE_ERROR_INVALID_PARAMETER;
+
+  memcpy (dest, src, src_len);
+  return NNS_EDGE_ERROR_NONE;
+}
+
+/**
+ * @brief Register and unregister the codec.
+ */
+TEST(edgeCodec, register)
+{
+  nns_edge_codec_s codec = { "temp-codec", _test_codec_bound,
+      _test_codec_encode, _test_codec_decode, NULL };
+  nns_edge_codec_s found;
+  nns_edge_h edge_h;
+  char *names;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_register_codec (&codec);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  /* Same name */
+  ret = nns_edge_register_codec (&codec);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_codec_find ("temp-codec", &found);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (found.name, "temp-codec");
+  EXPECT_TRUE (found.encode == _test_codec_encode);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  names = nns_edge_codec_get_names ();
+  EXPECT_STREQ (names, "lz,temp-codec");
+  EXPECT_TRUE (nns_edge_codec_is_listed (names, "temp-codec"));
+  EXPECT_TRUE (nns_edge_codec_is_listed (names, "lz"));
+  EXPECT_FALSE (nns_edge_codec_is_listed (names, "temp"));
+  SAFE_FREE (names);
+
+  ret = nns_edge_create_handle ("temp-id", NNS_EDGE_CONNECT_TYPE_TCP,
+      NNS_EDGE_NODE_TYPE_QUERY_SERVER, &edge_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_set_info (edge_h, "CODEC", "temp-codec");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_release_handle (edge_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_unregister_codec ("temp-codec");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize_meta (data_h, data, data_len);
+  ret = nns_edge_codec_find ("temp-codec", &found);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+/**
+ * @brief Register codec - invalid param.
+ */
+TEST(edgeCodec, registerInvalidParam01_n)
+{
+  nns_edge_codec_s codec = { "temp-codec", _test_codec_bound,
+      _test_codec_encode, NULL, NULL };
+  int ret;
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_register_codec (NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  /* Callback is missing */
+  ret = nns_edge_register_codec (&codec);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Invalid or reserved name */
+  codec.decode = _test_codec_decode;
+  codec.name = "temp codec";
+  ret = nns_edge_register_codec (&codec);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  codec.name = "none";
+  ret = nns_edge_register_codec (&codec);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  codec.name = "lz";
+  ret = nns_edge_register_codec (&codec);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Unregister codec - invalid param.
  */
-TEST(edgeData, deserializeInvalidParam03_n)
+TEST(edgeCodec, unregisterInvalidParam01_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_deserialize_meta (data_h, NULL, data_len);
+  ret = nns_edge_unregister_codec (NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_unregister_codec ("temp-unknown");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  /* Built-in codec */
+  ret = nns_edge_unregister_codec ("lz");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Deserialize meta to edge-data - invalid param.
+ * @brief Encode and decode the data with built-in codec.
  */
-TEST(edgeData, deserializeInvalidParam04_n)
+TEST(edgeCodec, builtin)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_codec_s codec;
+  uint8_t *src, *encoded, *decoded;
+  nns_size_t size, bound, len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_codec_find ("lz", &codec);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  size = 100000U;
+  src = (uint8_t *) malloc (size);
+  decoded = (uint8_t *) malloc (size);
+  ASSERT_TRUE (src != NULL && decoded != NULL);
+  _test_codec_fill (src, size, 0U);
+
+  /* Incompressible tail */
+  srand (0);
+  for (len = size - 1000U; len < size; len++)
+    src[len] = (uint8_t) rand ();
+
+  bound = codec.bound (size, codec.user_data);
+  EXPECT_GE (bound, size);
+  encoded = (uint8_t *) malloc (bound);
+  ASSERT_TRUE (encoded != NULL);
+
+  len = bound;
+  ret = codec.encode (src, size, encoded, &len, codec.user_data);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_LT (len, size / 10U);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, &data_len);
+  ret = codec.decode (encoded, len, decoded, size, codec.user_data);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (memcmp (src, decoded, size), 0);
 
-  ret = nns_edge_data_deserialize_meta (data_h, data, 0);
+  /* The size of original data is different. */
+  ret = codec.decode (encoded, len, decoded, size - 1U, codec.user_data);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Truncated data */
+  ret = codec.decode (encoded, len / 2U, decoded, size, codec.user_data);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  free (src);
+  free (encoded);
+  free (decoded);
 }
 
-
 /**
- * @brief Serialzie and deserialize the edge-data.
+ * @brief Shuffle and unshuffle the elements.
  */
-TEST(edgeDataSerialize, normal)
+TEST(edgeCodec, shuffle)
 {
-  nns_edge_data_h src_h, dest_h;
-  void *data1, *data2, *result, *serialized_data;
-  nns_size_t data_len, result_len, serialized_len;
-  char *result_value;
-  unsigned int i, result_count;
-  int ret;
+  const unsigned int element_sizes[] = { 1U, 2U, 3U, 4U, 8U, 16U };
+  const nns_size_t sizes[] = { 3U, 64U, 1000U, 4099U };
+  uint8_t *src, *shuffled, *restored;
+  nns_size_t size, num, n;
+  unsigned int i, j, t, b;
 
-  data_len = 10U * sizeof (unsigned int);
-  data1 = malloc (data_len);
-  ASSERT_TRUE (data1 != NULL);
+  src = (uint8_t *) malloc (4099U);
+  shuffled = (uint8_t *) malloc (4099U);
+  restored = (uint8_t *) malloc (4099U);
+  ASSERT_TRUE (src != NULL && shuffled != NULL && restored != NULL);
 
-  for (i = 0; i < 10U; i++)
-    ((unsigned int *) data1)[i] = i;
+  for (n = 0; n < 4099U; n++)
+    src[n] = (uint8_t) (n * 7U + n / 13U);
 
-  data2 = malloc (data_len * 2);
-  ASSERT_TRUE (data2 != NULL);
+  for (i = 0; i < sizeof (element_sizes) / sizeof (element_sizes[0]); i++) {
+    for (j = 0; j < sizeof (sizes) / sizeof (sizes[0]); j++) {
+      t = element_sizes[i];
+      size = sizes[j];
+      num = size / t;
 
-  for (i = 0; i < 20U; i++)
-    ((unsigned int *) data2)[i] = 20 - i;
+      nns_edge_codec_shuffle (src, shuffled, size, t);
 
-  ret = nns_edge_data_create (&src_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      /* Compare with the bytes grouped by significance. */
+      for (n = 0; n < num; n++) {
+        for (b = 0; b < t; b++)
+          EXPECT_EQ (shuffled[b * num + n], src[n * t + b]);
+      }
+      EXPECT_EQ (memcmp (shuffled + num * t, src + num * t, size - num * t), 0);
 
-  ret = nns_edge_data_set_info (src_h, "temp-key1", "temp-data-val1");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_set_info (src_h, "temp-key2", "temp-data-val2");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+      nns_edge_codec_unshuffle (shuffled, restored, size, t);
+      EXPECT_EQ (memcmp (src, restored, size), 0);
+    }
+  }
 
-  ret = nns_edge_data_add (src_h, data1, data_len, nns_edge_free);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_add (src_h, data2, data_len * 2, nns_edge_free);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  free (src);
+  free (shuffled);
+  free (restored);
+}
+
+/**
+ * @brief Convert float32 values to half precision.
+ */
+TEST(edgeCodec, precision)
+{
+  const uint32_t src[19] = {
+    0x00000000U, /* 0 */
+    0x3f800000U, /* 1 */
+    0xbf800000U, /* -1 */
+    0x477fe000U, /* 65504, max of fp16 */
+    0x49742400U, /* 1e6, overflow in fp16 */
+    0x33800000U, /* 2^-24, min subnormal of fp16 */
+    0x32aaaaabU, /* under 2^-25, underflow in fp16 */
+    0x7f800000U, /* inf */
+    0x3f801000U, /* 1 + 2^-10 * 0.5, tie to even in fp16 */
+    0x3f803000U, /* 1 + 2^-10 * 1.5, tie to even in fp16 */
+    0x3eaaaaabU, /* 1/3 */
+    0x40490fdbU, /* pi */
+    0xc2c80000U, /* -100 */
+    0x3f808000U, /* 1 + 2^-8, tie to even in bf16 */
+    0x3f818000U, /* 1 + 3 * 2^-8, tie to even in bf16 */
+    0x38800000U, /* 2^-14, min normal of fp16 */
+    0x7fc00000U, /* NaN */
+    0x3f800000U, /* 1 */
+    0x40000000U, /* 2 */
+  };
+  const uint16_t fp16[19] = {
+    0x0000U, 0x3c00U, 0xbc00U, 0x7bffU, 0x7c00U, 0x0001U, 0x0000U, 0x7c00U,
+    0x3c00U, 0x3c02U, 0x3555U, 0x4248U, 0xd640U, 0x3c04U, 0x3c0cU, 0x0400U,
+    0x7e00U, 0x3c00U, 0x4000U,
+  };
+  const uint16_t bf16[19] = {
+    0x0000U, 0x3f80U, 0xbf80U, 0x4780U, 0x4974U, 0x3380U, 0x32abU, 0x7f80U,
+    0x3f80U, 0x3f80U, 0x3eabU, 0x4049U, 0xc2c8U, 0x3f80U, 0x3f82U, 0x3880U,
+    0x7fc0U, 0x3f80U, 0x4000U,
+  };
+  uint16_t half[19];
+  uint32_t restored[19];
+  unsigned int i;
+
+  nns_edge_codec_convert_precision (src, half, 19U,
+      NNS_EDGE_CODEC_PRECISION_FP16);
+  for (i = 0; i < 19U; i++)
+    EXPECT_EQ (half[i], fp16[i]) << "index " << i;
+
+  nns_edge_codec_restore_precision (half, restored, 19U,
+      NNS_EDGE_CODEC_PRECISION_FP16);
+  EXPECT_EQ (restored[1], 0x3f800000U);
+  EXPECT_EQ (restored[3], 0x477fe000U);
+  EXPECT_EQ (restored[5], 0x33800000U);
+  EXPECT_EQ (restored[7], 0x7f800000U);
+  EXPECT_EQ (restored[15], 0x38800000U);
+  EXPECT_EQ (restored[18], 0x40000000U);
+
+  nns_edge_codec_convert_precision (src, half, 19U,
+      NNS_EDGE_CODEC_PRECISION_BF16);
+  for (i = 0; i < 19U; i++)
+    EXPECT_EQ (half[i], bf16[i]) << "index " << i;
+
+  nns_edge_codec_restore_precision (half, restored, 19U,
+      NNS_EDGE_CODEC_PRECISION_BF16);
+  for (i = 0; i < 19U; i++)
+    EXPECT_EQ (restored[i], (uint32_t) bf16[i] << 16);
+
+  EXPECT_EQ (nns_edge_codec_get_precision ("FP16"),
+      NNS_EDGE_CODEC_PRECISION_FP16);
+  EXPECT_EQ (nns_edge_codec_get_precision ("fp8"),
+      NNS_EDGE_CODEC_PRECISION_MAX);
+}
+
+/**
+ * @brief XOR the memory with the memory of previous frame.
+ */
+TEST(edgeCodec, delta)
+{
+  nns_edge_codec_delta_s delta;
+  uint8_t src[37], ref[37], xored[37], restored[37];
+  unsigned int i;
+  int ret;
+
+  memset (&delta, 0, sizeof (nns_edge_codec_delta_s));
+
+  for (i = 0; i < 37U; i++) {
+    src[i] = (uint8_t) (i * 3U);
+    ref[i] = (uint8_t) (i < 20U ? i * 3U : i);
+  }
 
-  ret = nns_edge_data_serialize (src_h, &serialized_data, &serialized_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Unchanged bytes are zero. */
+  nns_edge_codec_xor (src, ref, xored, 37U);
+  for (i = 0; i < 37U; i++)
+    EXPECT_EQ (xored[i], (uint8_t) (src[i] ^ ref[i]));
+  EXPECT_EQ (xored[0], 0U);
+  EXPECT_EQ (xored[19], 0U);
 
-  ret = nns_edge_data_destroy (src_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_codec_xor (xored, ref, restored, 37U);
+  EXPECT_EQ (memcmp (src, restored, 37U), 0);
 
-  ret = nns_edge_data_create (&dest_h);
+  ret = nns_edge_codec_delta_set (&delta, 1U, ref, 37U);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (delta.size[1], 37U);
+  EXPECT_EQ (memcmp (delta.ref[1], ref, 37U), 0);
 
-  ret = nns_edge_data_deserialize (dest_h, serialized_data, serialized_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  /* Apply the delta to the reference in place. */
+  nns_edge_codec_xor (xored, delta.ref[1], delta.ref[1], 37U);
+  EXPECT_EQ (memcmp (delta.ref[1], src, 37U), 0);
 
-  /* Compare data and info */
-  ret = nns_edge_data_get_count (dest_h, &result_count);
+  ret = nns_edge_codec_delta_set (&delta, 1U, src, 20U);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (result_count, 2U);
+  EXPECT_EQ (delta.size[1], 20U);
 
-  ret = nns_edge_data_get (dest_h, 0, &result, &result_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 10U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i);
+  ret = nns_edge_codec_delta_set (&delta, NNS_EDGE_DATA_LIMIT, src, 20U);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get (dest_h, 1, &result, &result_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 20U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], 20 - i);
+  nns_edge_codec_delta_clear (&delta);
+  EXPECT_TRUE (delta.ref[1] == NULL);
+  EXPECT_EQ (delta.size[1], 0U);
+}
 
-  ret = nns_edge_data_get_info (dest_h, "temp-key1", &result_value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val1");
-  SAFE_FREE (result_value);
+/**
+ * @brief Create edge event - invalid param.
+ */
+TEST(edgeEvent, createInvalidParam01_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
 
-  ret = nns_edge_data_get_info (dest_h, "temp-key2", &result_value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val2");
-  SAFE_FREE (result_value);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_UNKNOWN, &event_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  ret = nns_edge_data_destroy (dest_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Create edge event - invalid param.
+ */
+TEST(edgeEvent, createInvalidParam02_n)
+{
+  int ret;
 
-  SAFE_FREE (serialized_data);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
-
 /**
- * @brief Serialize edge-data - invalid param.
+ * @brief Destroy edge event - invalid param.
  */
-TEST(edgeDataSerialize, invalidParam01_n)
+TEST(edgeEvent, destroyInvalidParam01_n)
 {
-  void *data;
-  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_serialize (NULL, &data, &data_len);
+  ret = nns_edge_event_destroy (NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize edge-data - invalid param.
+ * @brief Destroy edge event - invalid param.
  */
-TEST(edgeData, invalidParam02_n)
+TEST(edgeEvent, destroyInvalidParam02_n)
 {
-  nns_edge_data_h data_h;
+  nns_edge_event_h event_h;
   void *data;
   nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_event_set_data (event_h, data, data_len, nns_edge_free);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_event_destroy (event_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Clear raw data in edge-data - invalid param.
+ * @brief Set edge event data - invalid param.
  */
-TEST(edgeData, clearInvalidParam01_n)
+TEST(edgeEvent, setDataInvalidParam01_n)
 {
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_clear (NULL);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_set_data (NULL, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Clear raw data in edge-data - invalid param.
+ * @brief Set edge event data - invalid param.
  */
-TEST(edgeData, clearInvalidParam02_n)
+TEST(edgeEvent, setDataInvalidParam02_n)
 {
-  nns_edge_data_h data_h;
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_clear (data_h);
-  EXPECT_NE (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_event_set_data (event_h, NULL, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Clear raw data in edge-data.
+ * @brief Set edge event data - invalid param.
  */
-TEST(edgeData, clear)
+TEST(edgeEvent, setDataInvalidParam03_n)
 {
-  nns_edge_data_h data_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  unsigned int count;
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
   data_len = 10U * sizeof (int);
   data = malloc (data_len);
   ASSERT_TRUE (data != NULL);
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  ret = nns_edge_event_set_data (event_h, data, 0, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_count (data_h, &count);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE , ret);
-  EXPECT_EQ (1U, count);
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_clear (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  SAFE_FREE (data);
+}
 
-  ret = nns_edge_data_get_count (data_h, &count);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
-  EXPECT_EQ (0U, count);
+/**
+ * @brief Set edge event data - invalid param.
+ */
+TEST(edgeEvent, setDataInvalidParam04_n)
+{
+  nns_edge_event_h event_h;
+  void *data;
+  nns_size_t data_len;
+  int ret;
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (NNS_EDGE_ERROR_NONE, ret);
+  data_len = 10U * sizeof (int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_set_data (event_h, data, data_len, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Serialize edge-data - invalid param.
+ * @brief Get edge event type.
  */
-TEST(edgeDataSerialize, invalidParam03_n)
+TEST(edgeEvent, getType)
 {
-  nns_edge_data_h data_h;
-  nns_size_t data_len;
+  nns_edge_event_h event_h;
+  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (event, NNS_EDGE_EVENT_CUSTOM);
 
-  ret = nns_edge_data_serialize (data_h, NULL, &data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize edge-data - invalid param.
+ * @brief Get edge event type - invalid param.
  */
-TEST(edgeDataSerialize, invalidParam04_n)
+TEST(edgeEvent, getTypeInvalidParam01_n)
 {
-  nns_edge_data_h data_h;
-  void *data;
+  nns_edge_event_e event;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_get_type (NULL, &event);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+/**
+ * @brief Get edge event type - invalid param.
+ */
+TEST(edgeEvent, getTypeInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize_meta (data_h, &data, NULL);
+  ret = nns_edge_event_get_type (event_h, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Deserialize edge-data - invalid param.
+ * @brief Get edge event type - invalid param.
  */
-TEST(edgeDataDeserialize, invalidParam01_n)
+TEST(edgeEvent, getTypeInvalidParam03_n)
 {
-  void *data = NULL;
+  nns_edge_event_h event_h;
+  nns_edge_event_e event;
   int ret;
 
-  ret = nns_edge_data_deserialize (NULL, data, 10U);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_get_type (event_h, &event);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Deserialize edge-data - invalid param.
+ * @brief Parse new data of edge event.
  */
-TEST(edgeDataDeserialize, invalidParam02_n)
+TEST(edgeEvent, parseNewData)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h, result_h;
+  void *data, *result;
+  nns_size_t data_len, result_len;
+  char *result_value;
+  unsigned int i, count;
   int ret;
 
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+
+  for (i = 0; i < 10U; i++)
+    ((unsigned int *) data)[i] = i;
+
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_data_set_info (data_h, "temp-key1", "temp-data-val1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "temp-key2", "temp-data-val2");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_data_deserialize (data_h, data, data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  nns_edge_handle_set_magic (data_h, NNS_EDGE_MAGIC);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_event_set_data (event_h, data_h, sizeof (nns_edge_data_h), NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
-}
+  ret = nns_edge_event_parse_new_data (event_h, &result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-/**
- * @brief Deserialize edge-data - invalid param.
- */
-TEST(edgeDataDeserialize, invalidParam03_n)
-{
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
-  int ret;
+  /* Compare data and info */
+  ret = nns_edge_data_get_count (result_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 1U);
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_data_get (result_h, 0, &result, &result_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  ret = nns_edge_data_get_info (result_h, "temp-key1", &result_value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val1");
+  SAFE_FREE (result_value);
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_data_get_info (result_h, "temp-key2", &result_value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (result_value, "temp-data-val2");
+  SAFE_FREE (result_value);
 
-  ret = nns_edge_data_deserialize (data_h, NULL, data_len);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  ret = nns_edge_data_destroy (result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Deserialize edge-data - invalid param.
+ * @brief Parse new data of edge event - invalid param.
  */
-TEST(edgeDataDeserialize, invalidParam04_n)
+TEST(edgeEvent, parseNewDataInvalidParam01_n)
 {
   nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_data_create (&data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_new_data (NULL, &data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Parse new data of edge event - invalid param.
+ */
+TEST(edgeEvent, parseNewDataInvalidParam02_n)
+{
+  nns_edge_event_h event_h;
+  int ret;
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_deserialize (data_h, data, 1U);
+  ret = nns_edge_event_parse_new_data (event_h, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
+  ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Util to check serialized data - invalid param.
+ * @brief Parse new data of edge event - invalid param.
  */
-TEST(edgeDataIsSerialized, invalidParam01_n)
+TEST(edgeEvent, parseNewDataInvalidParam03_n)
 {
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_data_is_serialized (NULL, 1U);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
+
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Util to check serialized data - invalid param.
+ * @brief Parse new data of edge event - invalid param.
  */
-TEST(edgeDataIsSerialized, invalidParam02_n)
+TEST(edgeEvent, parseNewDataInvalidParam04_n)
 {
-  void *data;
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  data = nns_edge_malloc (100U);
-  ASSERT_TRUE (data != NULL);
-  memset (data, 0, 100U);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* invalid data key */
-  ret = nns_edge_data_is_serialized (data, 100U);
+  ret = nns_edge_event_parse_new_data (event_h, &data_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Util to check serialized data - invalid param.
+ * @brief Take new data of edge event.
  */
-TEST(edgeDataIsSerialized, invalidParam03_n)
+TEST(edgeEvent, takeNewData)
 {
-  nns_edge_data_h data_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_event_h event_h;
+  nns_edge_data_h data_h, result_h;
+  void *data, *copied, *result;
+  nns_size_t data_len, result_len;
+  unsigned int i, count;
   int ret;
 
+  data_len = 10U * sizeof (unsigned int);
+  data = malloc (data_len);
+  ASSERT_TRUE (data != NULL);
+  copied = malloc (data_len);
+  ASSERT_TRUE (copied != NULL);
+
+  for (i = 0; i < 10U; i++) {
+    ((unsigned int *) data)[i] = i;
+    ((unsigned int *) copied)[i] = i + 10U;
+  }
+
   ret = nns_edge_data_create (&data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  /* The memory from the alloc callback is moved, other memory is copied. */
+  ret = nns_edge_data_add_transferable (data_h, data, data_len, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_add (data_h, copied, data_len, nns_edge_free);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_serialize (data_h, &data, &data_len);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* invalid data size */
-  ret = nns_edge_data_is_serialized (data, 1U);
+  ret = nns_edge_event_set_data (event_h, data_h, sizeof (nns_edge_data_h), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_take_new_data (event_h, &result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_data_get_count (result_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 2U);
+
+  ret = nns_edge_data_get (result_h, 0, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (result, data);
+  EXPECT_EQ (result_len, data_len);
+
+  ret = nns_edge_data_get (result_h, 1, &result, &result_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (result, copied);
+  for (i = 0; i < 10U; i++)
+    EXPECT_EQ (((unsigned int *) result)[i], i + 10U);
+
+  ret = nns_edge_data_destroy (result_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The memory was moved, the event cannot be taken or parsed again. */
+  ret = nns_edge_event_take_new_data (event_h, &result_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_new_data (event_h, &result_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
   ret = nns_edge_data_destroy (data_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  SAFE_FREE (data);
+/**
+ * @brief Take new data of edge event - invalid param.
+ */
+TEST(edgeEvent, takeNewDataInvalidParam01_n)
+{
+  nns_edge_data_h data_h;
+  int ret;
+
+  ret = nns_edge_event_take_new_data (NULL, &data_h);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Create edge event - invalid param.
+ * @brief Take new data of edge event - invalid param.
  */
-TEST(edgeEvent, createInvalidParam01_n)
+TEST(edgeEvent, takeNewDataInvalidParam02_n)
 {
   nns_edge_event_h event_h;
+  nns_edge_data_h data_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_UNKNOWN, &event_h);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_take_new_data (event_h, &data_h);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Create edge event - invalid param.
+ * @brief Parse the batch of edge event.
  */
-TEST(edgeEvent, createInvalidParam02_n)
+TEST(edgeEvent, parseNewBatch)
 {
+  nns_edge_event_h event_h;
+  nns_edge_data_h received[3], *batch = NULL;
+  unsigned int i, num = 0U;
+  int64_t index;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 3U; i++) {
+    ret = nns_edge_data_create (&received[i]);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    nns_edge_data_set_info_int64 (received[i], "index", (int64_t) i);
+  }
+
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_set_data (event_h, received, sizeof (received), NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_event_parse_new_batch (event_h, &batch, &num);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (num, 3U);
+
+  for (i = 0; i < num; i++) {
+    EXPECT_TRUE (batch[i] != received[i]);
+    ret = nns_edge_data_get_info_int64 (batch[i], "index", &index);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (index, (int64_t) i);
+    nns_edge_data_destroy (batch[i]);
+  }
+  SAFE_FREE (batch);
+
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 3U; i++)
+    nns_edge_data_destroy (received[i]);
 }
 
 /**
- * @brief Destroy edge event - invalid param.
+ * @brief Parse the batch of edge event - invalid param.
  */
-TEST(edgeEvent, destroyInvalidParam01_n)
+TEST(edgeEvent, parseNewBatchInvalidParam01_n)
 {
+  nns_edge_data_h *batch = NULL;
+  unsigned int num = 0U;
   int ret;
 
-  ret = nns_edge_event_destroy (NULL);
+  ret = nns_edge_event_parse_new_batch (NULL, &batch, &num);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Destroy edge event - invalid param.
+ * @brief Parse the batch of edge event - invalid param.
  */
-TEST(edgeEvent, destroyInvalidParam02_n)
+TEST(edgeEvent, parseNewBatchInvalidParam02_n)
 {
   nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
+  nns_edge_data_h *batch = NULL;
+  unsigned int num = 0U;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_event_set_data (event_h, data, data_len, nns_edge_free);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_BATCH_RECEIVED, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_event_parse_new_batch (event_h, NULL, &num);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_new_batch (event_h, &batch, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
 
   ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge event data - invalid param.
+ * @brief Parse the batch of edge event - invalid param.
  */
-TEST(edgeEvent, setDataInvalidParam01_n)
+TEST(edgeEvent, parseNewBatchInvalidParam03_n)
 {
-  void *data;
-  nns_size_t data_len;
+  nns_edge_event_h event_h;
+  nns_edge_data_h *batch = NULL;
+  unsigned int num = 0U;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_set_data (NULL, data, data_len, NULL);
+  ret = nns_edge_event_parse_new_batch (event_h, &batch, &num);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  ret = nns_edge_event_destroy (event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge event data - invalid param.
+ * @brief Parse capability of edge event.
  */
-TEST(edgeEvent, setDataInvalidParam02_n)
+TEST(edgeEvent, parseCapability)
 {
+  const char capability[] = "temp-capability";
   nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
+  char *caps = NULL;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_event_set_data (event_h, (void *) capability, strlen (capability), NULL);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_set_data (event_h, NULL, data_len, NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_event_parse_capability (event_h, &caps);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (caps, capability);
+  SAFE_FREE (caps);
 
   ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  SAFE_FREE (data);
+/**
+ * @brief Parse capability of edge event - invalid param.
+ */
+TEST(edgeEvent, parseCapabilityInvalidParam01_n)
+{
+  char *caps = NULL;
+  int ret;
+
+  ret = nns_edge_event_parse_capability (NULL, &caps);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge event data - invalid param.
+ * @brief Parse capability of edge event - invalid param.
  */
-TEST(edgeEvent, setDataInvalidParam03_n)
+TEST(edgeEvent, parseCapabilityInvalidParam02_n)
 {
   nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_set_data (event_h, data, 0, NULL);
+  ret = nns_edge_event_parse_capability (event_h, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Set edge event data - invalid param.
+ * @brief Parse capability of edge event - invalid param.
  */
-TEST(edgeEvent, setDataInvalidParam04_n)
+TEST(edgeEvent, parseCapabilityInvalidParam03_n)
 {
   nns_edge_event_h event_h;
-  void *data;
-  nns_size_t data_len;
+  char *caps = NULL;
   int ret;
 
-  data_len = 10U * sizeof (int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
-
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
 
-  ret = nns_edge_event_set_data (event_h, data, data_len, NULL);
+  ret = nns_edge_event_parse_capability (event_h, &caps);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
 
   ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  SAFE_FREE (data);
 }
 
 /**
- * @brief Get edge event type.
+ * @brief Parse capability of edge event - invalid param.
  */
-TEST(edgeEvent, getType)
+TEST(edgeEvent, parseCapabilityInvalidParam04_n)
 {
   nns_edge_event_h event_h;
-  nns_edge_event_e event = NNS_EDGE_EVENT_UNKNOWN;
+  char *caps = NULL;
   int ret;
 
   ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_get_type (event_h, &event);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (event, NNS_EDGE_EVENT_CUSTOM);
+  ret = nns_edge_event_parse_capability (event_h, &caps);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_event_destroy (event_h);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event type - invalid param.
+ * @brief Create edge metadata - invalid param.
  */
-TEST(edgeEvent, getTypeInvalidParam01_n)
+TEST(edgeMeta, createInvalidParam01_n)
 {
-  nns_edge_event_e event;
   int ret;
 
-  ret = nns_edge_event_get_type (NULL, &event);
+  ret = nns_edge_metadata_create (NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event type - invalid param.
+ * @brief Destroy edge metadata - invalid param.
  */
-TEST(edgeEvent, getTypeInvalidParam02_n)
+TEST(edgeMeta, destroyInvalidParam01_n)
 {
-  nns_edge_event_h event_h;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_event_get_type (event_h, NULL);
+  ret = nns_edge_metadata_destroy (NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_event_destroy (event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge event type - invalid param.
+ * @brief Set edge metadata - invalid param.
  */
-TEST(edgeEvent, getTypeInvalidParam03_n)
+TEST(edgeMeta, setInvalidParam01_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_event_e event;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_get_type (event_h, &event);
+  ret = nns_edge_metadata_set (NULL, "temp-key", "temp-value");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_event_destroy (event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event.
+ * @brief Set edge metadata - invalid param.
  */
-TEST(edgeEvent, parseNewData)
+TEST(edgeMeta, setInvalidParam02_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_data_h data_h, result_h;
-  void *data, *result;
-  nns_size_t data_len, result_len;
-  char *result_value;
-  unsigned int i, count;
+  nns_edge_metadata_h meta;
   int ret;
 
-  data_len = 10U * sizeof (unsigned int);
-  data = malloc (data_len);
-  ASSERT_TRUE (data != NULL);
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  for (i = 0; i < 10U; i++)
-    ((unsigned int *) data)[i] = i;
+  ret = nns_edge_metadata_set (meta, NULL, "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_create (&data_h);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  ret = nns_edge_data_add (data_h, data, data_len, nns_edge_free);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam03_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
 
-  ret = nns_edge_data_set_info (data_h, "temp-key1", "temp-data-val1");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_data_set_info (data_h, "temp-key2", "temp-data-val2");
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (meta, "", "temp-value");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_set_data (event_h, data_h, sizeof (nns_edge_data_h), NULL);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
 
-  ret = nns_edge_event_parse_new_data (event_h, &result_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam04_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
 
-  /* Compare data and info */
-  ret = nns_edge_data_get_count (result_h, &count);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_EQ (count, 1U);
 
-  ret = nns_edge_data_get (result_h, 0, &result, &result_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  for (i = 0; i < 10U; i++)
-    EXPECT_EQ (((unsigned int *) result)[i], i);
+  ret = nns_edge_metadata_set (meta, "temp-key", NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_get_info (result_h, "temp-key1", &result_value);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val1");
-  SAFE_FREE (result_value);
+}
 
-  ret = nns_edge_data_get_info (result_h, "temp-key2", &result_value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (result_value, "temp-data-val2");
-  SAFE_FREE (result_value);
+/**
+ * @brief Set edge metadata - invalid param.
+ */
+TEST(edgeMeta, setInvalidParam05_n)
+{
+  nns_edge_metadata_h meta;
+  int ret;
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (data_h);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (meta, "temp-key", "");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_data_destroy (result_h);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Get edge metadata - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam01_n)
+TEST(edgeMeta, getInvalidParam01_n)
 {
-  nns_edge_data_h data_h;
+  char *value = NULL;
   int ret;
 
-  ret = nns_edge_event_parse_new_data (NULL, &data_h);
+  ret = nns_edge_metadata_get (NULL, "temp-key", &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Get edge metadata - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam02_n)
+TEST(edgeMeta, getInvalidParam02_n)
 {
-  nns_edge_event_h event_h;
+  nns_edge_metadata_h meta;
+  char *value = NULL;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_new_data (event_h, NULL);
+  ret = nns_edge_metadata_get (meta, NULL, &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Get edge metadata - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam03_n)
+TEST(edgeMeta, getInvalidParam03_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_data_h data_h;
+  nns_edge_metadata_h meta;
+  char *value = NULL;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_NEW_DATA_RECEIVED, &event_h);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  ret = nns_edge_metadata_get (meta, "", &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse new data of edge event - invalid param.
+ * @brief Get edge metadata - invalid param.
  */
-TEST(edgeEvent, parseNewDataInvalidParam04_n)
+TEST(edgeMeta, getInvalidParam04_n)
 {
-  nns_edge_event_h event_h;
-  nns_edge_data_h data_h;
+  nns_edge_metadata_h meta;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_new_data (event_h, &data_h);
+  ret = nns_edge_metadata_get (meta, "temp-key", NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event.
+ * @brief Copy edge metadata.
  */
-TEST(edgeEvent, parseCapability)
+TEST(edgeMeta, copy)
 {
-  const char capability[] = "temp-capability";
-  nns_edge_event_h event_h;
-  char *caps = NULL;
+  nns_edge_metadata_h src, desc;
+  char *value = NULL;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_set_data (event_h, (void *) capability, strlen (capability), NULL);
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_capability (event_h, &caps);
+  /* Replace old value */
+  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2-replaced");
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (caps, capability);
-  SAFE_FREE (caps);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_copy (desc, src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2-replaced");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event - invalid param.
+ * @brief Copy edge metadata and update the copied one.
  */
-TEST(edgeEvent, parseCapabilityInvalidParam01_n)
+TEST(edgeMeta, copyOnWrite)
 {
-  char *caps = NULL;
+  nns_edge_metadata_h src, desc, desc2;
+  char *value = NULL;
+  int64_t ival = 0;
   int ret;
 
-  ret = nns_edge_event_parse_capability (NULL, &caps);
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc2);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_int64 (src, "temp-key2", 100);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_copy (desc, src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_copy (desc2, desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Update copied metadata, the source should not be changed. */
+  ret = nns_edge_metadata_set (desc, "temp-key1", "temp-value1-replaced");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (desc, "temp-key3", "temp-value3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (src, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (src, "temp-key3", &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Parse capability of edge event - invalid param.
- */
-TEST(edgeEvent, parseCapabilityInvalidParam02_n)
-{
-  nns_edge_event_h event_h;
-  int ret;
+  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1-replaced");
+  SAFE_FREE (value);
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  ret = nns_edge_metadata_get_int64 (desc, "temp-key2", &ival);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (ival, 100);
 
-  ret = nns_edge_event_parse_capability (event_h, NULL);
+  /* Clear the source, other copies should keep the items. */
+  ret = nns_edge_metadata_clear (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (src, "temp-key1", &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_get (desc2, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get_int64 (desc2, "temp-key2", &ival);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (ival, 100);
+
+  ret = nns_edge_metadata_destroy (desc2);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event - invalid param.
+ * @brief Copy edge metadata - invalid param.
  */
-TEST(edgeEvent, parseCapabilityInvalidParam03_n)
+TEST(edgeMeta, copyInvalidParam01_n)
 {
-  nns_edge_event_h event_h;
-  char *caps = NULL;
+  nns_edge_metadata_h src;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CAPABILITY, &event_h);
+  ret = nns_edge_metadata_create (&src);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC_DEAD);
-
-  ret = nns_edge_event_parse_capability (event_h, &caps);
+  ret = nns_edge_metadata_copy (NULL, src);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  nns_edge_handle_set_magic (event_h, NNS_EDGE_MAGIC);
-
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_destroy (src);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Parse capability of edge event - invalid param.
+ * @brief Copy edge metadata - invalid param.
  */
-TEST(edgeEvent, parseCapabilityInvalidParam04_n)
+TEST(edgeMeta, copyInvalidParam02_n)
 {
-  nns_edge_event_h event_h;
-  char *caps = NULL;
+  nns_edge_metadata_h desc;
   int ret;
 
-  ret = nns_edge_event_create (NNS_EDGE_EVENT_CUSTOM, &event_h);
+  ret = nns_edge_metadata_create (&desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_parse_capability (event_h, &caps);
+  ret = nns_edge_metadata_copy (desc, NULL);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_event_destroy (event_h);
+  ret = nns_edge_metadata_destroy (desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Create edge metadata - invalid param.
+ * @brief Remove the item of edge metadata.
  */
-TEST(edgeMeta, createInvalidParam01_n)
+TEST(edgeMeta, remove)
 {
+  nns_edge_metadata_h meta, copied;
+  char *value = NULL;
+  int64_t ival = 0;
   int ret;
 
-  ret = nns_edge_metadata_create (NULL);
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&copied);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (meta, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_int64 (meta, "temp-key2", 100);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_copy (copied, meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_remove (meta, "temp-key1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* The key not existing is ignored. */
+  ret = nns_edge_metadata_remove (meta, "temp-key3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (meta, "temp-key1", &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get_int64 (meta, "temp-key2", &ival);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (ival, 100);
+
+  /* The copied metadata should keep the items. */
+  ret = nns_edge_metadata_get (copied, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (copied);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Destroy edge metadata - invalid param.
+ * @brief Remove the item of edge metadata - invalid param.
  */
-TEST(edgeMeta, destroyInvalidParam01_n)
+TEST(edgeMeta, removeInvalidParam01_n)
 {
+  nns_edge_metadata_h meta;
   int ret;
 
-  ret = nns_edge_metadata_destroy (NULL);
+  ret = nns_edge_metadata_remove (NULL, "temp-key");
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_create (&meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_remove (meta, NULL);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_remove (meta, "");
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Serialize edge metadata.
  */
-TEST(edgeMeta, setInvalidParam01_n)
+TEST(edgeMeta, serialize)
 {
+  nns_edge_metadata_h src, desc;
+  char *value;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_metadata_set (NULL, "temp-key", "temp-value");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key3", "temp-value3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_serialize (src, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_deserialize (desc, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (desc, "temp-key3", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value3");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  SAFE_FREE (data);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Set and get many keys in edge metadata.
  */
-TEST(edgeMeta, setInvalidParam02_n)
+TEST(edgeMeta, setManyKeys)
 {
-  nns_edge_metadata_h meta;
-  int ret;
+  nns_edge_metadata_h meta, copied;
+  nns_edge_metadata_type_e type;
+  char key[32];
+  int64_t value;
+  int i, ret;
 
   ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&copied);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (meta, NULL, "temp-value");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  for (i = 0; i < 100; i++) {
+    snprintf (key, sizeof (key), "temp-key%d", i);
+    ret = nns_edge_metadata_set_int64 (meta, key, i);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  }
 
-  ret = nns_edge_metadata_destroy (meta);
+  /* Replace old value, key is case-insensitive. */
+  ret = nns_edge_metadata_set_int64 (meta, "TEMP-KEY50", 500);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Set edge metadata - invalid param.
- */
-TEST(edgeMeta, setInvalidParam03_n)
-{
-  nns_edge_metadata_h meta;
-  int ret;
+  ret = nns_edge_metadata_copy (copied, meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_create (&meta);
+  for (i = 0; i < 100; i++) {
+    snprintf (key, sizeof (key), "temp-key%d", i);
+    ret = nns_edge_metadata_get_int64 (copied, key, &value);
+    EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (value, (i == 50) ? 500 : i);
+  }
+
+  ret = nns_edge_metadata_get_type (copied, "temp-key1", &type);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (type, NNS_EDGE_METADATA_TYPE_INT64);
 
-  ret = nns_edge_metadata_set (meta, "", "temp-value");
+  ret = nns_edge_metadata_clear (copied);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_get_int64 (copied, "temp-key1", &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (copied);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Serialize edge metadata with typed values.
  */
-TEST(edgeMeta, setInvalidParam04_n)
+TEST(edgeMeta, serializeTyped)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_metadata_h src, desc;
+  nns_edge_metadata_type_e type;
+  unsigned char bin[5] = { 0U, 1U, 2U, 0U, 3U };
+  int64_t ival;
+  double dval;
+  void *data, *value;
+  nns_size_t data_len, value_len;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (meta, "temp-key", NULL);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_int64 (src, "temp-int", 9007199254740993LL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_double (src, "temp-double", 0.1);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_binary (src, "temp-bin", bin, sizeof (bin));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_metadata_serialize (src, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_deserialize (desc, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get_int64 (desc, "temp-int", &ival);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (ival, 9007199254740993LL);
+  ret = nns_edge_metadata_get_double (desc, "temp-double", &dval);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (dval, 0.1);
+  ret = nns_edge_metadata_get_type (desc, "temp-bin", &type);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (type, NNS_EDGE_METADATA_TYPE_BINARY);
+  ret = nns_edge_metadata_get_binary (desc, "temp-bin", &value, &value_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (value_len, sizeof (bin));
+  EXPECT_EQ (memcmp (value, bin, sizeof (bin)), 0);
+  nns_edge_free (value);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_free (data);
 }
 
 /**
- * @brief Set edge metadata - invalid param.
+ * @brief Update and copy deserialized edge metadata.
  */
-TEST(edgeMeta, setInvalidParam05_n)
+TEST(edgeMeta, deserializeUpdate)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_metadata_h src, desc, copied;
+  void *data;
+  nns_size_t data_len;
+  char *value;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&copied);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (meta, "temp-key", "");
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_int64 (src, "temp-key2", 2);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  ret = nns_edge_metadata_serialize (src, &data, &data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
 
-/**
- * @brief Get edge metadata - invalid param.
- */
-TEST(edgeMeta, getInvalidParam01_n)
-{
-  char *value = NULL;
-  int ret;
+  /* Metadata takes the serialized data. */
+  ret = nns_edge_metadata_deserialize_take (desc, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (NULL, "temp-key", &value);
+  ret = nns_edge_metadata_copy (copied, desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Update the metadata, others are not changed. */
+  ret = nns_edge_metadata_set (desc, "TEMP-KEY1", "new-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (desc, "temp-key3", "temp-value3");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "new-value1");
+  SAFE_FREE (value);
+  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "2");
+  SAFE_FREE (value);
+  ret = nns_edge_metadata_get (desc, "temp-key3", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value3");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_get (copied, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+  ret = nns_edge_metadata_get (copied, "temp-key3", &value);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (copied);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge metadata - invalid param.
+ * @brief Deserialize edge metadata with old version format.
  */
-TEST(edgeMeta, getInvalidParam02_n)
+TEST(edgeMeta, deserializeLegacy)
 {
   nns_edge_metadata_h meta;
-  char *value = NULL;
+  const char pairs[] = "temp-key1\0temp-value1\0temp-key2\0temp-value2";
+  char data[sizeof (uint32_t) + sizeof (pairs)];
+  char *value;
   int ret;
 
+  ((uint32_t *) data)[0] = 2U;
+  memcpy (data + sizeof (uint32_t), pairs, sizeof (pairs));
+
   ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (meta, NULL, &value);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_deserialize (meta, data, sizeof (data));
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get (meta, "temp-key1", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value1");
+  SAFE_FREE (value);
+  ret = nns_edge_metadata_get (meta, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
 
   ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Get edge metadata - invalid param.
+ * @brief Deserialize edge metadata - invalid data.
  */
-TEST(edgeMeta, getInvalidParam03_n)
+TEST(edgeMeta, deserializeInvalidData01_n)
 {
   nns_edge_metadata_h meta;
-  char *value = NULL;
+  char data[16];
   int ret;
 
   ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (meta, "", &value);
+  /* Key without terminating null. */
+  ((uint32_t *) data)[0] = 1U;
+  memset (data + sizeof (uint32_t), 'a', sizeof (data) - sizeof (uint32_t));
+
+  ret = nns_edge_metadata_deserialize (meta, data, sizeof (data));
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
   ret = nns_edge_metadata_destroy (meta);
@@ -3113,151 +8364,207 @@ TEST(edgeMeta, getInvalidParam03_n)
 }
 
 /**
- * @brief Get edge metadata - invalid param.
+ * @brief Deserialize edge metadata - invalid data.
  */
-TEST(edgeMeta, getInvalidParam04_n)
+TEST(edgeMeta, deserializeInvalidData02_n)
 {
-  nns_edge_metadata_h meta;
+  nns_edge_metadata_h src, desc;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_metadata_create (&meta);
+  ret = nns_edge_metadata_create (&src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (meta, "temp-key", NULL);
+  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_serialize (src, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Truncated data */
+  ret = nns_edge_metadata_deserialize (desc, data, data_len - 1);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (meta);
+  /* Value without terminating null */
+  ((char *) data)[data_len - 1] = 'a';
+  ret = nns_edge_metadata_deserialize (desc, data, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_destroy (src);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_free (data);
 }
 
 /**
- * @brief Copy edge metadata.
+ * @brief Serialize the delta of edge metadata and apply it.
  */
-TEST(edgeMeta, copy)
+TEST(edgeMeta, serializeDelta)
 {
-  nns_edge_metadata_h src, desc;
+  nns_edge_metadata_h base, meta, desc;
+  void *data;
+  nns_size_t data_len;
   char *value = NULL;
+  int64_t ival = 0;
   int ret;
 
-  ret = nns_edge_metadata_create (&src);
+  ret = nns_edge_metadata_create (&base);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
   ret = nns_edge_metadata_create (&desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
+  /* Both are empty */
+  ret = nns_edge_metadata_serialize_delta (base, meta, &data, &data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
+  EXPECT_TRUE (data == NULL);
+  EXPECT_EQ (data_len, 0U);
+
+  ret = nns_edge_metadata_set (base, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (base, "temp-key2", "temp-value2");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_int64 (base, "temp-key3", 300);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  /* Replace old value */
-  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2-replaced");
+  /* Same metadata, the delta has no entry. */
+  ret = nns_edge_metadata_copy (meta, base);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_copy (desc, base);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_copy (desc, src);
+  ret = nns_edge_metadata_serialize_delta (base, meta, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (nns_edge_metadata_is_delta (data, data_len));
+
+  ret = nns_edge_metadata_apply_delta (desc, data, data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_free (data);
+
+  /* Change, remove and add keys. */
+  ret = nns_edge_metadata_clear (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (meta, "temp-key1", "temp-value1-changed");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set_int64 (meta, "temp-key3", 300);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (meta, "temp-key4", "temp-value4");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_serialize_delta (base, meta, &data, &data_len);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (nns_edge_metadata_is_delta (data, data_len));
+
+  ret = nns_edge_metadata_apply_delta (desc, data, data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_free (data);
 
   ret = nns_edge_metadata_get (desc, "temp-key1", &value);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value1");
+  EXPECT_STREQ (value, "temp-value1-changed");
   SAFE_FREE (value);
 
   ret = nns_edge_metadata_get (desc, "temp-key2", &value);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_metadata_get_int64 (desc, "temp-key3", &ival);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2-replaced");
+  EXPECT_EQ (ival, 300);
+
+  ret = nns_edge_metadata_get (desc, "temp-key4", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value4");
   SAFE_FREE (value);
 
-  ret = nns_edge_metadata_destroy (src);
+  /* The base shared with desc should not be changed. */
+  ret = nns_edge_metadata_get (base, "temp-key2", &value);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_STREQ (value, "temp-value2");
+  SAFE_FREE (value);
+
+  ret = nns_edge_metadata_destroy (base);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
   ret = nns_edge_metadata_destroy (desc);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Copy edge metadata - invalid param.
+ * @brief Apply the delta of edge metadata - invalid data.
  */
-TEST(edgeMeta, copyInvalidParam01_n)
+TEST(edgeMeta, applyDeltaInvalidData01_n)
 {
-  nns_edge_metadata_h src;
+  nns_edge_metadata_h base, meta;
+  void *data;
+  nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_metadata_create (&src);
+  ret = nns_edge_metadata_create (&base);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_copy (NULL, src);
-  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_set (meta, "temp-key1", "temp-value1");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (src);
+  /* Full metadata is not a delta. */
+  ret = nns_edge_metadata_serialize (meta, &data, &data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-}
+  EXPECT_FALSE (nns_edge_metadata_is_delta (data, data_len));
 
-/**
- * @brief Copy edge metadata - invalid param.
- */
-TEST(edgeMeta, copyInvalidParam02_n)
-{
-  nns_edge_metadata_h desc;
-  int ret;
+  ret = nns_edge_metadata_apply_delta (base, data, data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_free (data);
 
-  ret = nns_edge_metadata_create (&desc);
+  /* The delta cannot be deserialized. */
+  ret = nns_edge_metadata_serialize_delta (base, meta, &data, &data_len);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_copy (desc, NULL);
+  ret = nns_edge_metadata_deserialize (base, data, data_len);
   EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (desc);
+  /* Truncated data */
+  ret = nns_edge_metadata_apply_delta (base, data, data_len - 1);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+  nns_edge_free (data);
+
+  ret = nns_edge_metadata_destroy (base);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_destroy (meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
- * @brief Serialize edge metadata.
+ * @brief Serialize the delta of edge metadata - invalid param.
  */
-TEST(edgeMeta, serialize)
+TEST(edgeMeta, serializeDeltaInvalidParam01_n)
 {
-  nns_edge_metadata_h src, desc;
-  char *value;
+  nns_edge_metadata_h meta;
   void *data;
   nns_size_t data_len;
   int ret;
 
-  ret = nns_edge_metadata_create (&src);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_create (&desc);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_metadata_set (src, "temp-key1", "temp-value1");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_set (src, "temp-key2", "temp-value2");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_set (src, "temp-key3", "temp-value3");
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_metadata_serialize (src, &data, &data_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_metadata_deserialize (desc, data, data_len);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-
-  ret = nns_edge_metadata_get (desc, "temp-key1", &value);
+  ret = nns_edge_metadata_create (&meta);
   EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value1");
-  SAFE_FREE (value);
 
-  ret = nns_edge_metadata_get (desc, "temp-key2", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value2");
-  SAFE_FREE (value);
+  ret = nns_edge_metadata_serialize_delta (NULL, meta, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_get (desc, "temp-key3", &value);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  EXPECT_STREQ (value, "temp-value3");
-  SAFE_FREE (value);
+  ret = nns_edge_metadata_serialize_delta (meta, NULL, &data, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  ret = nns_edge_metadata_destroy (src);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
-  ret = nns_edge_metadata_destroy (desc);
-  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_metadata_serialize_delta (meta, meta, NULL, &data_len);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
 
-  SAFE_FREE (data);
+  ret = nns_edge_metadata_destroy (meta);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
 }
 
 /**
@@ -3789,6 +9096,647 @@ TEST_F(edgeQueue, waitPopInvalidParam03_n)
   EXPECT_EQ (nns_edge_queue_wait_pop (queue_h, 0U, &data, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
 }
 
+/**
+ * @brief Recycle data handle in the pool.
+ */
+TEST(edgePool, recycleData)
+{
+  nns_edge_pool_h pool_h;
+  nns_edge_data_h data_h, recycled_h;
+  unsigned int count;
+  char *val;
+  void *data;
+  int ret;
+
+  ret = nns_edge_pool_create (&pool_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  ret = nns_edge_pool_get_data (pool_h, &data_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  data = malloc (64);
+  ASSERT_TRUE (data != NULL);
+  ret = nns_edge_data_add (data_h, data, 64, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_set_info (data_h, "temp-key", "temp-value");
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Returned handle should be cleared. */
+  nns_edge_pool_put_data (pool_h, data_h);
+
+  ret = nns_edge_pool_get_data (pool_h, &recycled_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (recycled_h == data_h);
+
+  ret = nns_edge_data_get_count (recycled_h, &count);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (count, 0U);
+  ret = nns_edge_data_get_info (recycled_h, "temp-key", &val);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+
+  nns_edge_pool_put_data (pool_h, recycled_h);
+
+  val = nns_edge_pool_get_stats (pool_h);
+  EXPECT_TRUE (strstr (val, "data_hit=1,data_miss=1,data_cached=1") != NULL);
+  SAFE_FREE (val);
+
+  /* Disable the pool, cached handle is released. */
+  ret = nns_edge_pool_set_data_limit (pool_h, 0U);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  val = nns_edge_pool_get_stats (pool_h);
+  EXPECT_TRUE (strstr (val, "data_cached=0") != NULL);
+  SAFE_FREE (val);
+
+  ret = nns_edge_pool_destroy (pool_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Recycle buffers in the pool.
+ */
+TEST(edgePool, recycleBuffer)
+{
+  nns_edge_pool_h pool_h;
+  void *buffer, *recycled;
+  char *val;
+  int ret;
+
+  ret = nns_edge_pool_create (&pool_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  buffer = nns_edge_pool_alloc (pool_h, 1000U);
+  ASSERT_TRUE (buffer != NULL);
+  memset (buffer, 0xff, 1000U);
+  nns_edge_pool_free (pool_h, buffer);
+
+  /* Same size class (1024 bytes) */
+  recycled = nns_edge_pool_alloc (pool_h, 1024U);
+  EXPECT_TRUE (recycled == buffer);
+  nns_edge_pool_free (pool_h, recycled);
+
+  /* Different size class */
+  recycled = nns_edge_pool_alloc (pool_h, 2000U);
+  ASSERT_TRUE (recycled != NULL);
+  EXPECT_TRUE (recycled != buffer);
+  nns_edge_pool_free (pool_h, recycled);
+
+  val = nns_edge_pool_get_stats (pool_h);
+  EXPECT_TRUE (strstr (val, "buffer_hit=1,buffer_miss=2,buffer_cached_bytes=3072") != NULL);
+  SAFE_FREE (val);
+
+  /* Shrink the pool, large buffer is released first. */
+  ret = nns_edge_pool_set_buffer_limit (pool_h, 1024U);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  val = nns_edge_pool_get_stats (pool_h);
+  EXPECT_TRUE (strstr (val, "buffer_cached_bytes=1024") != NULL);
+  SAFE_FREE (val);
+
+  /* Pool is full, the buffer is released. */
+  buffer = nns_edge_pool_alloc (pool_h, 4000U);
+  ASSERT_TRUE (buffer != NULL);
+  nns_edge_pool_free (pool_h, buffer);
+
+  val = nns_edge_pool_get_stats (pool_h);
+  EXPECT_TRUE (strstr (val, "buffer_cached_bytes=1024") != NULL);
+  SAFE_FREE (val);
+
+  ret = nns_edge_pool_destroy (pool_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create pool - invalid param.
+ */
+TEST(edgePool, createInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_pool_create (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Destroy pool - invalid param.
+ */
+TEST(edgePool, destroyInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_pool_destroy (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Get data from pool - invalid param.
+ */
+TEST(edgePool, getDataInvalidParam01_n)
+{
+  nns_edge_pool_h pool_h;
+  nns_edge_data_h data_h;
+
+  EXPECT_EQ (nns_edge_pool_get_data (NULL, &data_h), NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  EXPECT_EQ (nns_edge_pool_create (&pool_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_pool_get_data (pool_h, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (nns_edge_pool_destroy (pool_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Set limit of pool - invalid param.
+ */
+TEST(edgePool, setLimitInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_pool_set_data_limit (NULL, 1U), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (nns_edge_pool_set_buffer_limit (NULL, 1U), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Add and remove the outstanding requests.
+ */
+TEST(edgeRequest, addRemove)
+{
+  nns_edge_request_h req_h;
+  uint32_t id[300];
+  unsigned int i;
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+
+  /* Same bucket is used for the IDs having same lower bits. */
+  for (i = 0; i < 300U; i++) {
+    id[i] = nns_edge_request_new_id (req_h);
+    EXPECT_GT (id[i], 0U);
+    EXPECT_EQ (nns_edge_request_add (req_h, id[i]), NNS_EDGE_ERROR_NONE);
+  }
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 300U);
+
+  /* The request is already outstanding. */
+  EXPECT_NE (nns_edge_request_add (req_h, id[0]), NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 300U; i += 2U)
+    EXPECT_EQ (nns_edge_request_remove (req_h, id[i]), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 150U);
+
+  /* The request is not outstanding. */
+  EXPECT_NE (nns_edge_request_remove (req_h, id[0]), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_remove (req_h, id[1]), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_clear (req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Wait for the response of the request.
+ */
+TEST(edgeRequest, wait)
+{
+  nns_edge_request_h req_h;
+  nns_edge_data_h data_h, response_h;
+  int64_t index;
+  bool taken;
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_create (&data_h), NNS_EDGE_ERROR_NONE);
+  nns_edge_data_set_info_int64 (data_h, "index", 10);
+
+  /* The response is taken by the caller waiting for it. */
+  EXPECT_EQ (nns_edge_request_add_waiting (req_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_add (req_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_done (req_h, 1U, 0, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (taken);
+  EXPECT_EQ (nns_edge_request_wait (req_h, 1U, 100U, &response_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_get_info_int64 (response_h, "index", &index), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (index, 10);
+  EXPECT_EQ (nns_edge_data_destroy (response_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  /* The response is not received. */
+  EXPECT_EQ (nns_edge_request_add_waiting (req_h, 2U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_wait (req_h, 2U, 50U, &response_h), NNS_EDGE_ERROR_TIMEOUT);
+  EXPECT_TRUE (response_h == NULL);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  /* The request is removed, failed to send it. */
+  EXPECT_EQ (nns_edge_request_add_waiting (req_h, 3U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_remove (req_h, 3U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_wait (req_h, 3U, 0U, &response_h), NNS_EDGE_ERROR_IO);
+
+  /* The request without waiting caller is completed. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 4U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_done (req_h, 4U, 0, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_FALSE (taken);
+  EXPECT_NE (nns_edge_request_done (req_h, 4U, 0, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  EXPECT_EQ (nns_edge_data_destroy (data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Select the target of the request.
+ */
+TEST(edgeRequest, select)
+{
+  nns_edge_request_h req_h;
+  const int64_t targets[2] = { 10, 20 };
+  unsigned int i;
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+
+  /* The targets having same cost are selected in turn. */
+  EXPECT_NE (nns_edge_request_select (req_h, targets, 2U,
+          NNS_EDGE_REQUEST_POLICY_LEAST_OUTSTANDING),
+      nns_edge_request_select (req_h, targets, 2U,
+          NNS_EDGE_REQUEST_POLICY_LEAST_OUTSTANDING));
+
+  /* The target having the fewest outstanding requests. */
+  for (i = 1U; i <= 3U; i++) {
+    EXPECT_EQ (nns_edge_request_add (req_h, i), NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (nns_edge_request_set_target (req_h, i, 10), NNS_EDGE_ERROR_NONE);
+  }
+  EXPECT_EQ (nns_edge_request_add (req_h, 4U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 4U, 20), NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 4U; i++)
+    EXPECT_EQ (nns_edge_request_select (req_h, targets, 2U,
+            NNS_EDGE_REQUEST_POLICY_LEAST_OUTSTANDING), 20);
+
+  /* The target having the lowest latency. */
+  usleep (20000);
+  for (i = 1U; i <= 3U; i++)
+    EXPECT_EQ (nns_edge_request_remove (req_h, i), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_remove (req_h, 4U), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_add (req_h, 5U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 5U, 10), NNS_EDGE_ERROR_NONE);
+  usleep (20000);
+  EXPECT_EQ (nns_edge_request_remove (req_h, 5U), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_clear (req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_ejection (req_h, 1U, 10000U), NNS_EDGE_ERROR_NONE);
+
+  /* Target 10 takes 20 ms, and target 20 responds immediately. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 6U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 6U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_add (req_h, 7U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 7U, 20), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_done (req_h, 7U, 0, NULL, NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  {
+    nns_edge_data_h data_h;
+    bool taken;
+
+    EXPECT_EQ (nns_edge_data_create (&data_h), NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (nns_edge_request_done (req_h, 7U, 0, data_h, &taken), NNS_EDGE_ERROR_NONE);
+    usleep (20000);
+    EXPECT_EQ (nns_edge_request_done (req_h, 6U, 0, data_h, &taken), NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (nns_edge_data_destroy (data_h), NNS_EDGE_ERROR_NONE);
+  }
+
+  for (i = 0; i < 4U; i++)
+    EXPECT_EQ (nns_edge_request_select (req_h, targets, 2U,
+            NNS_EDGE_REQUEST_POLICY_EWMA), 20);
+
+  /* Target 20 is ejected after a failure, target 10 is selected. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 8U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 8U, 20), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_remove (req_h, 8U), NNS_EDGE_ERROR_NONE);
+
+  for (i = 0; i < 4U; i++)
+    EXPECT_EQ (nns_edge_request_select (req_h, targets, 2U,
+            NNS_EDGE_REQUEST_POLICY_EWMA), 10);
+
+  /* The requests sent to the target are removed. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 9U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 9U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_add (req_h, 10U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_clear_target (req_h, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 1U);
+
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Send the duplicate of the request which is not responded within the percentile of latency.
+ */
+TEST(edgeRequest, hedge)
+{
+  nns_edge_request_h req_h;
+  nns_edge_data_h data_h, req_data_h, hedge_h;
+  unsigned int wait_ms;
+  int64_t target;
+  uint32_t id;
+  bool taken;
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_create (&data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_hedge (req_h, 50U), NNS_EDGE_ERROR_NONE);
+
+  /* No request to be duplicated, the sender waits for new request. */
+  EXPECT_EQ (nns_edge_request_pop_hedge (req_h, &id, &target, &hedge_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (hedge_h == NULL);
+  EXPECT_EQ (wait_ms, 0U);
+
+  /* Not enough latencies. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 99U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 99U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_copy (data_h, &req_data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_data (req_h, 99U, req_data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_pop_hedge (req_h, &id, &target, &hedge_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (hedge_h == NULL);
+  EXPECT_GT (wait_ms, 0U);
+  EXPECT_EQ (nns_edge_request_remove (req_h, 99U), NNS_EDGE_ERROR_NONE);
+
+  for (id = 1U; id <= 8U; id++) {
+    EXPECT_EQ (nns_edge_request_add (req_h, id), NNS_EDGE_ERROR_NONE);
+    EXPECT_EQ (nns_edge_request_set_target (req_h, id, 10), NNS_EDGE_ERROR_NONE);
+    usleep (1000);
+    EXPECT_EQ (nns_edge_request_done (req_h, id, 10, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  }
+
+  /* The request is not delayed yet. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 100U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 100U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_copy (data_h, &req_data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_data (req_h, 100U, req_data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_pop_hedge (req_h, &id, &target, &hedge_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (hedge_h == NULL);
+  EXPECT_GT (wait_ms, 0U);
+
+  usleep (20000);
+  EXPECT_EQ (nns_edge_request_pop_hedge (req_h, &id, &target, &hedge_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (hedge_h == req_data_h);
+  EXPECT_EQ (id, 100U);
+  EXPECT_EQ (target, 10);
+  EXPECT_EQ (nns_edge_data_destroy (hedge_h), NNS_EDGE_ERROR_NONE);
+
+  /* The duplicate is sent to other target, the first response completes the request. */
+  EXPECT_NE (nns_edge_request_set_hedge_target (req_h, 100U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_hedge_target (req_h, 100U, 20), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_done (req_h, 100U, 20, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_FALSE (taken);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  /* The response received later is dropped. */
+  EXPECT_EQ (nns_edge_request_done (req_h, 100U, 10, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (taken);
+  EXPECT_NE (nns_edge_request_done (req_h, 100U, 10, data_h, &taken), NNS_EDGE_ERROR_NONE);
+
+  /* The connection is closed, wait for the response of the duplicate. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 101U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 101U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_copy (data_h, &req_data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_data (req_h, 101U, req_data_h), NNS_EDGE_ERROR_NONE);
+  usleep (20000);
+  EXPECT_EQ (nns_edge_request_pop_hedge (req_h, &id, &target, &hedge_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (id, 101U);
+  EXPECT_EQ (nns_edge_data_destroy (hedge_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_hedge_target (req_h, 101U, 20), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_clear_target (req_h, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 1U);
+  EXPECT_EQ (nns_edge_request_done (req_h, 101U, 20, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_FALSE (taken);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  /* All requests are responded. */
+  EXPECT_EQ (nns_edge_request_pop_hedge (req_h, &id, &target, &hedge_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (hedge_h == NULL);
+  EXPECT_EQ (wait_ms, 0U);
+
+  EXPECT_EQ (nns_edge_data_destroy (data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Send the duplicate of the request - invalid param.
+ */
+TEST(edgeRequest, hedgeInvalidParam01_n)
+{
+  nns_edge_request_h req_h;
+  nns_edge_data_h data_h;
+  unsigned int wait_ms;
+  int64_t target;
+  uint32_t id;
+
+  EXPECT_NE (nns_edge_request_set_hedge (NULL, 50U), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_pop_hedge (NULL, &id, &target, &data_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_set_hedge (req_h, 100U), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_pop_hedge (req_h, NULL, &target, &data_h, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_pop_hedge (req_h, &id, &target, NULL, &wait_ms), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_set_data (req_h, 1U, NULL), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_set_hedge_target (req_h, 1U, 0), NNS_EDGE_ERROR_NONE);
+
+  /* The hedged request is disabled. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 1U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_data_create (&data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_set_data (req_h, 1U, data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_set_hedge_target (req_h, 1U, 20), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_data_destroy (data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Complete the oldest request when the response without request ID is received.
+ */
+TEST(edgeRequest, doneOldest)
+{
+  nns_edge_request_h req_h;
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_add (req_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 1U, 10), NNS_EDGE_ERROR_NONE);
+  usleep (1000);
+  EXPECT_EQ (nns_edge_request_add (req_h, 2U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 2U, 20), NNS_EDGE_ERROR_NONE);
+  usleep (1000);
+  EXPECT_EQ (nns_edge_request_add_waiting (req_h, 3U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_add (req_h, 3U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 3U, 10), NNS_EDGE_ERROR_NONE);
+  usleep (1000);
+  EXPECT_EQ (nns_edge_request_add (req_h, 4U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_set_target (req_h, 4U, 10), NNS_EDGE_ERROR_NONE);
+
+  /* The oldest request sent to the target is completed. */
+  EXPECT_EQ (nns_edge_request_done_oldest (req_h, 20), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_remove (req_h, 2U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_done_oldest (req_h, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_remove (req_h, 1U), NNS_EDGE_ERROR_NONE);
+
+  /* The request waited by the caller is not completed. */
+  EXPECT_EQ (nns_edge_request_done_oldest (req_h, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_remove (req_h, 4U), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_done_oldest (req_h, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 1U);
+  EXPECT_EQ (nns_edge_request_remove (req_h, 3U), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_NE (nns_edge_request_done_oldest (NULL, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_done_oldest (req_h, 0), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief The table of outstanding requests is full.
+ */
+TEST(edgeRequest, full)
+{
+  nns_edge_request_h req_h;
+  uint32_t id;
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+
+  /* The oldest request is removed. */
+  for (id = 1U; id <= NNS_EDGE_REQUEST_MAX; id++)
+    EXPECT_EQ (nns_edge_request_add (req_h, id), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), NNS_EDGE_REQUEST_MAX);
+
+  EXPECT_EQ (nns_edge_request_add (req_h, id), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), NNS_EDGE_REQUEST_MAX);
+  EXPECT_NE (nns_edge_request_remove (req_h, 1U), NNS_EDGE_ERROR_NONE);
+
+  nns_edge_request_clear (req_h);
+
+  /* The requests waited by the callers are not removed. */
+  for (id = 1U; id <= NNS_EDGE_REQUEST_MAX; id++)
+    EXPECT_EQ (nns_edge_request_add_waiting (req_h, id), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_add (req_h, id), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_add_waiting (req_h, id), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), NNS_EDGE_REQUEST_MAX);
+
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Expire the request.
+ */
+TEST(edgeRequest, expire)
+{
+  nns_edge_request_h req_h;
+  nns_edge_data_h data_h, response_h;
+  bool waiting, taken;
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+
+  /* The caller waiting for the response is timed out. */
+  EXPECT_EQ (nns_edge_request_add_waiting (req_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_add (req_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_expire (req_h, 1U, &waiting), NNS_EDGE_ERROR_NONE);
+  EXPECT_TRUE (waiting);
+  EXPECT_NE (nns_edge_request_expire (req_h, 1U, &waiting), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_wait (req_h, 1U, 1000U, &response_h), NNS_EDGE_ERROR_TIMEOUT);
+  EXPECT_TRUE (response_h == NULL);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  /* The request without waiting caller is removed, the response is not expected. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 2U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_expire (req_h, 2U, &waiting), NNS_EDGE_ERROR_NONE);
+  EXPECT_FALSE (waiting);
+  EXPECT_EQ (nns_edge_request_get_count (req_h), 0U);
+
+  EXPECT_EQ (nns_edge_data_create (&data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_done (req_h, 2U, 0, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_expire (req_h, 2U, &waiting), NNS_EDGE_ERROR_NONE);
+
+  /* The request is already responded. */
+  EXPECT_EQ (nns_edge_request_add (req_h, 3U), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_done (req_h, 3U, 0, data_h, &taken), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_expire (req_h, 3U, &waiting), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_data_destroy (data_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Expire the request - invalid param.
+ */
+TEST(edgeRequest, expireInvalidParam01_n)
+{
+  nns_edge_request_h req_h;
+  bool waiting;
+
+  EXPECT_NE (nns_edge_request_expire (NULL, 1U, &waiting), NNS_EDGE_ERROR_NONE);
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_add (req_h, 1U), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_expire (req_h, 1U, NULL), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_expire (req_h, 0U, &waiting), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Policy of the request.
+ */
+TEST(edgeRequest, policy)
+{
+  int i;
+
+  for (i = 0; i < NNS_EDGE_REQUEST_POLICY_MAX; i++) {
+    EXPECT_EQ (nns_edge_request_get_policy (nns_edge_request_get_policy_name (
+                   (nns_edge_request_policy_e) i)),
+        (nns_edge_request_policy_e) i);
+  }
+
+  EXPECT_EQ (nns_edge_request_get_policy ("random"), NNS_EDGE_REQUEST_POLICY_MAX);
+  EXPECT_EQ (nns_edge_request_get_policy (NULL), NNS_EDGE_REQUEST_POLICY_MAX);
+  EXPECT_TRUE (nns_edge_request_get_policy_name (NNS_EDGE_REQUEST_POLICY_MAX) == NULL);
+}
+
+/**
+ * @brief Select the target - invalid param.
+ */
+TEST(edgeRequest, selectInvalidParam01_n)
+{
+  nns_edge_request_h req_h;
+  const int64_t targets[1] = { 10 };
+
+  EXPECT_EQ (nns_edge_request_select (NULL, targets, 1U,
+          NNS_EDGE_REQUEST_POLICY_EWMA), 0);
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_select (req_h, NULL, 1U,
+          NNS_EDGE_REQUEST_POLICY_EWMA), 0);
+  EXPECT_EQ (nns_edge_request_select (req_h, targets, 0U,
+          NNS_EDGE_REQUEST_POLICY_EWMA), 0);
+
+  /* The request is not outstanding. */
+  EXPECT_NE (nns_edge_request_set_target (req_h, 1U, 10), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_set_ejection (req_h, 0U, 100U), NNS_EDGE_ERROR_NONE);
+  EXPECT_NE (nns_edge_request_clear_target (req_h, 0), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
+/**
+ * @brief Create request table - invalid param.
+ */
+TEST(edgeRequest, createInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_request_create (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Destroy request table - invalid param.
+ */
+TEST(edgeRequest, destroyInvalidParam01_n)
+{
+  EXPECT_EQ (nns_edge_request_destroy (NULL), NNS_EDGE_ERROR_INVALID_PARAMETER);
+}
+
+/**
+ * @brief Add the request - invalid param.
+ */
+TEST(edgeRequest, addInvalidParam01_n)
+{
+  nns_edge_request_h req_h;
+
+  EXPECT_EQ (nns_edge_request_add (NULL, 1U), NNS_EDGE_ERROR_INVALID_PARAMETER);
+
+  EXPECT_EQ (nns_edge_request_create (&req_h), NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (nns_edge_request_add (req_h, 0U), NNS_EDGE_ERROR_INVALID_PARAMETER);
+  EXPECT_EQ (nns_edge_request_destroy (req_h), NNS_EDGE_ERROR_NONE);
+}
+
 /**
  * @brief Util to get the version.
  */
@@ -3811,6 +9759,80 @@ TEST(edgeUtil, getVersion)
   nns_edge_free (ver_string);
 }
 
+/**
+ * @brief Set the default allocator.
+ */
+TEST(edgeUtil, setDefaultAllocator)
+{
+  ne_test_allocator_s ta = { 0U, 0U };
+  nns_edge_allocator_s allocator;
+  nns_edge_data_h src_h, dest_h;
+  void *data, *aligned;
+  int ret;
+
+  allocator.alloc = _test_alloc;
+  allocator.aligned_alloc = _test_aligned_alloc;
+  allocator.free = _test_free;
+  allocator.user_data = &ta;
+
+  ret = nns_edge_set_default_allocator (&allocator);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  data = nns_edge_malloc (100U);
+  ASSERT_TRUE (data != NULL);
+  EXPECT_EQ (ta.allocated, 1U);
+
+  aligned = nns_edge_malloc_aligned (64U, 100U);
+  ASSERT_TRUE (aligned != NULL);
+  EXPECT_EQ (((uintptr_t) aligned) % 64U, 0U);
+  EXPECT_EQ (ta.allocated, 2U);
+  nns_edge_free (aligned);
+
+  /* The data handle and its metadata are allocated with the default allocator. */
+  ret = nns_edge_data_create (&src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (ta.allocated, 4U);
+  ret = nns_edge_data_add (src_h, data, 100U, nns_edge_free);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  /* Copied memory is allocated with the default allocator. */
+  ret = nns_edge_data_copy (src_h, &dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (ta.allocated, 7U);
+
+  ret = nns_edge_data_destroy (src_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  ret = nns_edge_data_destroy (dest_h);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+  EXPECT_EQ (ta.released, 7U);
+
+  ret = nns_edge_set_default_allocator (NULL);
+  EXPECT_EQ (ret, NNS_EDGE_ERROR_NONE);
+
+  data = nns_edge_malloc (100U);
+  ASSERT_TRUE (data != NULL);
+  nns_edge_free (data);
+  EXPECT_EQ (ta.allocated, 7U);
+  EXPECT_EQ (ta.released, 7U);
+}
+
+/**
+ * @brief Set the default allocator - invalid param.
+ */
+TEST(edgeUtil, setDefaultAllocatorInvalidParam01_n)
+{
+  nns_edge_allocator_s allocator;
+  int ret;
+
+  allocator.alloc = NULL;
+  allocator.aligned_alloc = _test_aligned_alloc;
+  allocator.free = _test_free;
+  allocator.user_data = NULL;
+
+  ret = nns_edge_set_default_allocator (&allocator);
+  EXPECT_NE (ret, NNS_EDGE_ERROR_NONE);
+}
+
 /**
  * @brief Main gtest
  */